@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file bench/bench.hpp
+ * @brief Minimal timing harness shared by the benchmarks
+ *
+ * Each case runs until it has taken at least `min_time`, then reports the
+ * mean time per iteration and, when a byte count is given, throughput.
+ *
+ * Macro workloads pass a bench::volume instead of a byte count; they run
+ * one whole pass per iteration and also report records per second.
+ *
+ * Usage:
+ *   bench::run("find/char", bytes, [&] { return s.find('x'); });
+ *   bench::run("csv group-by", {.records = rows, .bytes = csv.size()}, [&] { return group(csv); });
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+inline constexpr auto min_time = std::chrono::milliseconds(200);
+
+// Keep a result alive so the optimizer cannot drop the measured work
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+template <typename Fn>
+void run(const char* name, std::size_t bytes_per_iter, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+
+    std::size_t iterations = 0;
+    const auto start = clock::now();
+    auto elapsed = clock::duration{};
+
+    do {
+        for (int i = 0; i < 64; ++i) do_not_optimize(fn());
+        iterations += 64;
+        elapsed = clock::now() - start;
+    } while (elapsed < min_time);
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    if (bytes_per_iter != 0) {
+        std::printf("%-32s %10.1f ns %10.2f GB/s\n", name, ns, bytes_per_iter / ns);
+    } else {
+        std::printf("%-32s %10.1f ns\n", name, ns);
+    }
+}
+
+// Work done by one pass of a macro workload
+struct volume {
+    std::size_t records = 0;
+    std::size_t bytes = 0;
+};
+
+template <typename Fn>
+void run(const char* name, volume work, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+
+    std::size_t iterations = 0;
+    const auto start = clock::now();
+    auto elapsed = clock::duration{};
+
+    do {
+        do_not_optimize(fn());
+        ++iterations;
+        elapsed = clock::now() - start;
+    } while (elapsed < min_time || iterations < 3);
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    if (work.bytes != 0) {
+        std::printf("%-32s %10.2f ms %9.2f Mrec/s %8.2f GB/s\n", name, ns / 1e6, work.records * 1e3 / ns,
+                    work.bytes / ns);
+    } else {
+        std::printf("%-32s %10.2f ms %9.2f Mrec/s\n", name, ns / 1e6, work.records * 1e3 / ns);
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,68 @@
+/**
+ * @file bench/char_types.cpp
+ * @brief Kernel throughput per character type
+ *
+ * Runs find, charset matching, case mapping, comparison, hashing and
+ * statistics over a 1000 code unit string for char, wchar_t, char16_t and
+ * char32_t, next to the equivalent std::basic_string_view operation as a
+ * baseline.
+ */
+
+#include "bench.hpp"
+#include <zuu/fstring.hpp>
+#include <functional>
+#include <string>
+#include <string_view>
+
+using namespace zuu;
+
+namespace {
+
+template <typename CharT>
+void bench_char_type(const char* type_name) {
+    using string = basic_fstring<CharT, 1024>;
+    using view = std::basic_string_view<CharT>;
+
+    string text;
+    for (std::size_t i = 0; i < 1000; ++i) text.push_back(CharT('a' + i % 23));
+    string copy = text;
+
+    const view sv = text;
+    const CharT set[] = {CharT('#'), CharT('$'), CharT('%'), CharT('&')};
+    const view set_view{set, 4};
+    const std::size_t bytes = text.size() * sizeof(CharT);
+
+    auto label = [type_name](const char* op) {
+        static char buffer[64];
+        std::snprintf(buffer, sizeof buffer, "%s/%s", op, type_name);
+        return buffer;
+    };
+
+    std::printf("-- %s --\n", type_name);
+    bench::run(label("find"), bytes, [&] { return text.find(CharT('#')); });
+    bench::run(label("find (string_view)"), bytes, [&] { return sv.find(CharT('#')); });
+    bench::run(label("find_first_of"), bytes, [&] { return str::find_first_of(text, set_view); });
+    bench::run(label("find_first_of (string_view)"), bytes, [&] { return sv.find_first_of(set_view); });
+    bench::run(label("to_upper"), bytes, [&] { return (text | str::to_upper).size(); });
+    bench::run(label("to_upper (scalar)"), bytes, [&] {
+        return str::transform_output<string>(sv, [](CharT ch) { return str::char_to_upper(ch); }).size();
+    });
+    bench::run(label("compare"), bytes, [&] { return text == copy; });
+    bench::run(label("compare (string_view)"), bytes, [&] { return sv == view{copy}; });
+    bench::run(label("hash"), bytes, [&] { return std::hash<string>{}(text); });
+    bench::run(label("char_classes"), bytes, [&] { return text | str::char_classes; });
+    bench::run(label("stats"), bytes, [&] { return (text | str::stats).classes; });
+    if constexpr (std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t> ||
+                  std::is_same_v<CharT, char16_t> || std::is_same_v<CharT, char32_t>) {
+        bench::run(label("hash (std::hash<string_view>)"), bytes, [&] { return std::hash<view>{}(sv); });
+    }
+}
+
+} // namespace
+
+int main() {
+    bench_char_type<char>("char");
+    bench_char_type<wchar_t>("wchar_t");
+    bench_char_type<char16_t>("char16_t");
+    bench_char_type<char32_t>("char32_t");
+}
@@ -0,0 +1,294 @@
+#pragma once
+
+/**
+ * @file bench/datagen.hpp
+ * @brief Deterministic synthetic inputs for the macro benchmarks
+ *
+ * Every generator takes a seed and produces the same bytes on every
+ * platform (splitmix64, no std::*_distribution), so results can be compared
+ * across machines and runs.
+ *
+ * Usage:
+ *   auto log = datagen::access_log(1'000'000, 42);
+ *   auto csv = datagen::sales_csv(500'000, 7);
+ *   auto table = datagen::route_table(3);
+ *   auto paths = datagen::request_paths(table, 1'000'000, 3);
+ *   auto names = datagen::names(1'000'000, 11);
+ *   auto typo = datagen::misspell(names[0], 2, random);
+ *   auto docs = datagen::messages(100'000, 80, 250, 5);
+ *   auto files = datagen::file_names(1'000'000, 9);
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace datagen {
+
+class rng {
+public:
+    explicit rng(std::uint64_t seed) noexcept : state_{seed} {}
+
+    std::uint64_t next() noexcept {
+        std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [0, n); the modulo bias is irrelevant at these sizes
+    std::size_t below(std::size_t n) noexcept { return static_cast<std::size_t>(next() % n); }
+
+    template <typename T, std::size_t N>
+    const T& pick(const T (&items)[N]) noexcept { return items[below(N)]; }
+
+private:
+    std::uint64_t state_;
+};
+
+inline void append_number(std::string& out, std::size_t value) {
+    char digits[20];
+    int n = 0;
+    do {
+        digits[n++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (n != 0) out += digits[--n];
+}
+
+inline void append_padded(std::string& out, std::size_t value) {
+    if (value < 10) out += '0';
+    append_number(out, value);
+}
+
+// ==================== Access Log ====================
+
+/**
+ * @brief Whitespace-separated access log, one record per line:
+ *
+ *   2025-11-26T10:04:59Z INFO GET /api/users/4821 200 17 5120
+ *   (timestamp, level, method, path, status, latency ms, response bytes)
+ */
+inline std::string access_log(std::size_t records, std::uint64_t seed) {
+    static constexpr std::string_view levels[] = {"INFO", "INFO", "INFO", "INFO", "WARN", "ERROR", "DEBUG"};
+    static constexpr std::string_view methods[] = {"GET", "GET", "GET", "POST", "PUT", "DELETE"};
+    static constexpr std::string_view paths[] = {"/api/users/", "/api/orders/", "/api/items/",
+                                                 "/static/img/", "/health", "/api/search?q="};
+    static constexpr std::size_t statuses[] = {200, 200, 200, 200, 201, 204, 304, 404, 500, 503};
+
+    rng random(seed);
+    std::string text;
+    text.reserve(records * 64);
+
+    for (std::size_t i = 0; i < records; ++i) {
+        text += "2025-11-";
+        append_padded(text, 1 + random.below(28));
+        text += 'T';
+        append_padded(text, random.below(24));
+        text += ':';
+        append_padded(text, random.below(60));
+        text += ':';
+        append_padded(text, random.below(60));
+        text += "Z ";
+        text += random.pick(levels);
+        text += ' ';
+        text += random.pick(methods);
+        text += ' ';
+        const std::string_view path = random.pick(paths);
+        text += path;
+        if (path.back() == '/' || path.back() == '=') append_number(text, random.below(100000));
+        text += ' ';
+        append_number(text, random.pick(statuses));
+        text += ' ';
+        append_number(text, random.below(random.below(10) == 0 ? 5000 : 200));
+        text += ' ';
+        append_number(text, random.below(65536));
+        text += '\n';
+    }
+    return text;
+}
+
+// ==================== CSV ====================
+
+/**
+ * @brief Sales CSV with a header row: region,product,quantity,unit_price
+ *
+ * About one product in eight is quoted and contains a comma; prices have
+ * two decimals.
+ */
+inline std::string sales_csv(std::size_t rows, std::uint64_t seed) {
+    static constexpr std::string_view regions[] = {"north", "south", "east", "west", "central",
+                                                   "north-east", "south-west", "islands"};
+    static constexpr std::string_view products[] = {"widget", "gadget", "sprocket", "gizmo",
+                                                    "\"bolt, hex\"", "doohickey", "flange", "valve"};
+
+    rng random(seed);
+    std::string text = "region,product,quantity,unit_price\n";
+    text.reserve(rows * 40);
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        text += random.pick(regions);
+        text += ',';
+        text += random.pick(products);
+        text += ',';
+        append_number(text, 1 + random.below(50));
+        text += ',';
+        append_number(text, 1 + random.below(500));
+        text += '.';
+        append_padded(text, random.below(100));
+        text += '\n';
+    }
+    return text;
+}
+
+// ==================== URL Routing ====================
+
+/**
+ * @brief Route prefixes, nested several levels deep (some prefixes of others)
+ */
+inline std::vector<std::string> route_table(std::uint64_t seed) {
+    static constexpr std::string_view services[] = {"users", "orders", "items", "search", "billing",
+                                                    "auth", "reports", "inventory", "shipping", "admin"};
+    static constexpr std::string_view actions[] = {"list", "detail", "history", "export", "settings", "stats"};
+
+    rng random(seed);
+    std::vector<std::string> table = {"/", "/static/", "/static/img/", "/static/css/", "/health"};
+
+    for (const std::string_view version : {"/api/v1/", "/api/v2/"}) {
+        for (const auto service : services) {
+            std::string base = std::string(version) + std::string(service);
+            table.push_back(base);
+            for (const auto action : actions) {
+                if (random.below(3) != 0) table.push_back(base + "/" + std::string(action));
+            }
+        }
+    }
+    return table;
+}
+
+/**
+ * @brief Newline-separated request paths: route prefixes with ids and
+ *        query strings appended, plus some that only match "/"
+ */
+inline std::string request_paths(const std::vector<std::string>& table, std::size_t count, std::uint64_t seed) {
+    static constexpr std::string_view suffixes[] = {"", "/", "/42", "/12345/items", "?page=2", "?q=term&sort=asc"};
+    static constexpr std::string_view unrouted[] = {"/favicon.ico", "/robots.txt", "/wp-login.php", "/api/v3/users"};
+
+    rng random(seed);
+    std::string text;
+    text.reserve(count * 40);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        if (random.below(20) == 0) {
+            text += random.pick(unrouted);
+        } else {
+            text += table[random.below(table.size())];
+            text += random.pick(suffixes);
+        }
+        text += '\n';
+    }
+    return text;
+}
+
+// ==================== Names ====================
+
+/**
+ * @brief Pronounceable names built from syllables, 4 to 20 characters;
+ *        distinct enough that most near-misses have few neighbours
+ */
+inline std::vector<std::string> names(std::size_t count, std::uint64_t seed) {
+    static constexpr std::string_view onsets[] = {"b", "br", "c", "ch", "d", "f", "g", "gr", "h", "j", "k", "l",
+                                                  "m", "n", "p", "r", "s", "sh", "st", "t", "th", "v", "w", "z"};
+    static constexpr std::string_view vowels[] = {"a", "e", "i", "o", "u", "ai", "ea", "io", "y"};
+    static constexpr std::string_view codas[] = {"", "", "", "n", "r", "l", "s", "th", "ck", "m"};
+
+    rng random(seed);
+    std::vector<std::string> out;
+    out.reserve(count);
+    while (out.size() < count) {
+        std::string name;
+        const std::size_t syllables = 2 + random.below(3);
+        for (std::size_t i = 0; i < syllables; ++i) {
+            name += random.pick(onsets);
+            name += random.pick(vowels);
+            name += random.pick(codas);
+        }
+        if (name.size() >= 4 && name.size() <= 20) out.push_back(std::move(name));
+    }
+    return out;
+}
+
+/**
+ * @brief `text` with `edits` random substitutions, insertions or deletions
+ *        of lower-case letters (the result is within that edit distance)
+ */
+inline std::string misspell(std::string text, std::size_t edits, rng& random) {
+    for (std::size_t i = 0; i < edits; ++i) {
+        const char letter = static_cast<char>('a' + random.below(26));
+        const std::size_t at = random.below(text.size() + 1);
+        switch (text.empty() ? 1 : random.below(3)) {
+        case 0: text[std::min(at, text.size() - 1)] = letter; break;
+        case 1: text.insert(text.begin() + static_cast<std::ptrdiff_t>(at), letter); break;
+        default: text.erase(std::min(at, text.size() - 1), 1); break;
+        }
+    }
+    return text;
+}
+
+// ==================== Messages ====================
+
+/**
+ * @brief Free-text messages of `min_length` to `max_length` characters:
+ *        words drawn from a 2000-word vocabulary of names(), space-separated
+ */
+inline std::vector<std::string> messages(std::size_t count, std::size_t min_length, std::size_t max_length,
+                                         std::uint64_t seed) {
+    const auto vocabulary = names(2000, seed);
+    rng random(seed + 1);
+    std::vector<std::string> out;
+    out.reserve(count);
+    while (out.size() < count) {
+        const std::size_t target = min_length + random.below(max_length - min_length + 1);
+        std::string text;
+        while (text.size() < target) {
+            if (!text.empty()) text += ' ';
+            text += vocabulary[random.below(vocabulary.size())];
+        }
+        text.resize(target);
+        out.push_back(std::move(text));
+    }
+    return out;
+}
+
+// ==================== File Names ====================
+
+/**
+ * @brief File and version names with embedded numbers and mixed case:
+ *        "IMG_1042.jpg", "Report-v2.10.3.pdf", "track07.flac", ...
+ */
+inline std::vector<std::string> file_names(std::size_t count, std::uint64_t seed) {
+    static constexpr const char* stems[] = {"IMG_", "img_", "DSC", "Report-v", "report-v", "track", "Track ",
+                                            "build-", "chapter", "Chapter ", "scan", "log."};
+    static constexpr const char* extensions[] = {".jpg", ".JPG", ".pdf", ".flac", ".txt", ".tar.gz", ""};
+    rng random(seed);
+    std::vector<std::string> out;
+    out.reserve(count);
+    while (out.size() < count) {
+        std::string name = random.pick(stems);
+        const std::size_t parts = 1 + (name.find("-v") != std::string::npos ? 2 : random.below(2));
+        for (std::size_t p = 0; p < parts; ++p) {
+            if (p > 0) name += '.';
+            if (random.below(4) == 0) name += '0';
+            append_number(name, random.below(p == 0 ? 5000 : 20));
+        }
+        name += random.pick(extensions);
+        out.push_back(std::move(name));
+    }
+    return out;
+}
+
+} // namespace datagen
@@ -0,0 +1,175 @@
+/**
+ * @file bench/dedup.cpp
+ * @brief Near-duplicate detection: hashing throughput and LSH recall
+ *
+ * Throughput: MinHash signatures (128 rows) and SimHash fingerprints over
+ * msg_str documents (80 to 250 characters) and fstring<1024> documents (600
+ * to 1000), in documents and megabytes per second, with the bare rolling
+ * shingle hash as the baseline.
+ *
+ * Recall: a stream of msg_str messages in which a quarter are copies of an
+ * earlier message with 1 to 4 character edits. Each message is looked up
+ * in the indexes before it is inserted; recall is the fraction of planted
+ * copies whose original comes back. Candidates per lookup show what the
+ * recall costs.
+ *
+ * Duplicates: the same message inserted over and over, as a stream of
+ * exact repeats fills one bucket per band; inserts per second should not
+ * drop as the bucket grows.
+ *
+ * Usage: fstring_bench_dedup [documents] [seconds per case]
+ *        (defaults: 200000, 1 s)
+ */
+
+#include "datagen.hpp"
+#include "bench.hpp"
+#include <zuu/dedup.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start) {
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+template <typename Doc, typename Fn>
+void throughput(const char* name, const std::vector<Doc>& docs, double seconds, Fn&& fn) {
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+    const auto start = clock_type::now();
+    do {
+        const Doc& doc = docs[count++ % docs.size()];
+        bench::do_not_optimize(fn(doc));
+        bytes += doc.size();
+    } while ((count & 255) != 0 || seconds_since(start) < seconds);
+    const double elapsed = seconds_since(start);
+    std::printf("%-28s %12.0f %10.1f\n", name, static_cast<double>(count) / elapsed,
+                static_cast<double>(bytes) / elapsed / 1e6);
+}
+
+struct recall_result {
+    std::size_t found = 0;
+    std::size_t planted = 0;
+    std::size_t candidates = 0;
+    double seconds = 0;
+};
+
+void print_recall(const char* name, const recall_result& r, std::size_t docs) {
+    std::printf("%-28s %9.1f%% %12.1f %10.2f\n", name, 100.0 * static_cast<double>(r.found) / static_cast<double>(r.planted),
+                static_cast<double>(r.candidates) / static_cast<double>(docs), r.seconds * 1e6 / static_cast<double>(docs));
+}
+
+// Hash, look up, then insert every message; `source[i]` is the original
+// of a planted copy or i
+template <typename Hash, typename Index, typename Lookup>
+recall_result stream_through(const std::vector<types::msg_str>& stream, const std::vector<std::size_t>& source,
+                             Hash&& hash, Index& index, Lookup&& lookup) {
+    recall_result result;
+    std::vector<std::uint32_t> ids;
+    const auto start = clock_type::now();
+    for (std::size_t i = 0; i < stream.size(); ++i) {
+        const auto key = hash(stream[i]);
+        lookup(index, key, ids);
+        result.candidates += ids.size();
+        if (source[i] != i) {
+            ++result.planted;
+            result.found += std::binary_search(ids.begin(), ids.end(), static_cast<std::uint32_t>(source[i]));
+        }
+        index.insert(key);
+    }
+    result.seconds = seconds_since(start);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 1.0;
+
+    std::vector<types::msg_str> short_docs;
+    for (const auto& text : datagen::messages(count, 80, 250, 21)) short_docs.emplace_back(text);
+    std::vector<fstring<1024>> long_docs;
+    for (const auto& text : datagen::messages(count / 4 + 1, 600, 1000, 22)) long_docs.emplace_back(text);
+
+    const dedup::minhasher<128> minhash;
+    const dedup::simhasher simhash;
+    const dedup::shingler shingles;
+
+    std::printf("%-28s %12s %10s\n", "hashing", "docs/s", "MB/s");
+    auto rolling_only = [&](const auto& doc) {
+        std::uint64_t sum = 0;
+        shingles(doc, [&sum](std::uint64_t h) { sum += h; });
+        return sum;
+    };
+    throughput("shingles msg_str", short_docs, seconds, rolling_only);
+    throughput("minhash<128> msg_str", short_docs, seconds, [&](const auto& doc) { return minhash(doc)[0]; });
+    throughput("simhash msg_str", short_docs, seconds, [&](const auto& doc) { return simhash(doc); });
+    throughput("shingles fstring<1024>", long_docs, seconds, rolling_only);
+    throughput("minhash<128> fstring<1024>", long_docs, seconds, [&](const auto& doc) { return minhash(doc)[0]; });
+    throughput("simhash fstring<1024>", long_docs, seconds, [&](const auto& doc) { return simhash(doc); });
+
+    // A quarter of the stream are edited copies of earlier messages
+    datagen::rng random(23);
+    std::vector<types::msg_str> stream;
+    std::vector<std::size_t> source;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (i != 0 && random.below(4) == 0) {
+            const std::size_t original = random.below(i);
+            const auto& text = stream[original];
+            stream.emplace_back(datagen::misspell(std::string(text.data(), text.size()), 1 + random.below(4), random));
+            source.push_back(original);
+        } else {
+            stream.push_back(short_docs[i]);
+            source.push_back(i);
+        }
+    }
+
+    std::printf("\n%-28s %10s %12s %10s\n", "near-duplicate lookup", "recall", "cand/query", "us/doc");
+    for (const std::size_t bands : {16, 32}) {
+        dedup::minhash_lsh<128> lsh(bands);
+        const auto r = stream_through(stream, source, minhash, lsh,
+                                      [](const auto& index, const auto& key, auto& ids) { index.candidates(key, ids); });
+        char name[64];
+        std::snprintf(name, sizeof name, "minhash lsh %zux%zu", lsh.bands(), lsh.rows());
+        print_recall(name, r, stream.size());
+    }
+    for (const std::size_t distance : {3, 6, 9}) {
+        dedup::simhash_index index(distance);
+        const auto r = stream_through(stream, source, simhash, index,
+                                      [](const auto& index, const auto& key, auto& ids) { index.query(key, ids); });
+        char name[64];
+        std::snprintf(name, sizeof name, "simhash within %zu bits", distance);
+        print_recall(name, r, stream.size());
+    }
+
+    std::printf("\n%-28s %12s\n", "identical inserts", "inserts/s");
+    const auto signature = minhash(short_docs[0]);
+    const std::uint64_t fingerprint = simhash(short_docs[0]);
+    for (const std::size_t n : {count / 4, count}) {
+        dedup::minhash_lsh<128> lsh(16);
+        auto start = clock_type::now();
+        for (std::size_t i = 0; i < n; ++i) lsh.insert(signature);
+        double elapsed = seconds_since(start);
+        char name[64];
+        std::snprintf(name, sizeof name, "minhash lsh 16x8, %zu", n);
+        std::printf("%-28s %12.0f\n", name, static_cast<double>(n) / elapsed);
+
+        dedup::simhash_index index(3);
+        start = clock_type::now();
+        for (std::size_t i = 0; i < n; ++i) index.insert(fingerprint);
+        elapsed = seconds_since(start);
+        std::snprintf(name, sizeof name, "simhash within 3 bits, %zu", n);
+        std::printf("%-28s %12.0f\n", name, static_cast<double>(n) / elapsed);
+    }
+    return 0;
+}
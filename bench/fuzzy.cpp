@@ -0,0 +1,188 @@
+/**
+ * @file bench/fuzzy.cpp
+ * @brief Fuzzy dictionary lookup: SymSpell and BK-tree against a linear scan
+ *
+ * Builds both indexes over a name_str dictionary (datagen::names), then
+ * looks up misspelled dictionary names at distances 1 and 2 and reports
+ * query latency percentiles (latency.hpp) for each. Queries are issued at
+ * a fixed rate of half the index's measured throughput, so the tail shows
+ * the cost of unlucky queries rather than queueing.
+ *
+ * Before timing, every index answer is checked against a bit-parallel
+ * linear scan for a sample of queries; a mismatch fails the run (exit
+ * status 1). The scan itself is timed as the baseline.
+ *
+ * Last, the pairwise similarity scorers (similarity.hpp) are timed as in
+ * record linkage: one query against a block of candidates with
+ * score_batch, with and without a cutoff, in pairs per second.
+ *
+ * Usage: fstring_bench_fuzzy [dictionary size] [seconds per case]
+ *        (defaults: 1000000, 1 s)
+ */
+
+#include "datagen.hpp"
+#include "latency.hpp"
+#include <zuu/fuzzy.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start) {
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+// Best k by linear scan; the reference the indexes must agree with
+std::vector<fuzzy::fuzzy_match> scan(const std::vector<types::name_str>& dictionary, const types::name_str& query,
+                                     std::size_t max_distance, std::size_t k) {
+    std::vector<fuzzy::fuzzy_match> out;
+    fuzzy::detail::top_k<char> best(out, k, max_distance);
+    const fuzzy::levenshtein_pattern pattern(query);
+    for (const auto& term : dictionary) {
+        const std::size_t limit = best.limit();
+        const std::size_t d = pattern.distance(term, limit);
+        if (d <= limit) best.offer({std::string_view(term.data(), term.size()), d, 1});
+    }
+    return out;
+}
+
+// Distances and terms must agree (frequencies are equal here)
+bool same(const std::vector<fuzzy::fuzzy_match>& a, const std::vector<fuzzy::fuzzy_match>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].distance != b[i].distance || a[i].term != b[i].term) return false;
+    }
+    return true;
+}
+
+template <typename Lookup>
+bench::latency_result measure(const char* name, std::size_t distance, const std::vector<types::name_str>& queries,
+                              double seconds, Lookup&& lookup) {
+    // Closed-loop estimate of throughput, then run at half of it
+    std::size_t next = 0;
+    std::size_t calls = 0;
+    const auto start = clock_type::now();
+    do {
+        bench::do_not_optimize(lookup(queries[next++ % queries.size()]));
+        ++calls;
+    } while (seconds_since(start) < 0.2);
+
+    bench::load load;
+    load.rate = 0.5 * static_cast<double>(calls) / seconds_since(start);
+    load.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(seconds));
+    return bench::measure_latency(name, distance, load, [&] { return lookup(queries[next++ % queries.size()]); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 1.0;
+    constexpr std::size_t k = 5;
+
+    std::vector<types::name_str> dictionary;
+    dictionary.reserve(size);
+    for (const auto& name : datagen::names(size, 11)) dictionary.emplace_back(name);
+    // Unique terms, so the scan's ranking matches the indexes' merged frequencies
+    std::sort(dictionary.begin(), dictionary.end());
+    dictionary.erase(std::unique(dictionary.begin(), dictionary.end()), dictionary.end());
+
+    datagen::rng random(12);
+    std::vector<types::name_str> queries[3];
+    for (std::size_t d = 1; d <= 2; ++d) {
+        for (std::size_t i = 0; i < 4096; ++i) {
+            const auto& source = dictionary[random.below(dictionary.size())];
+            queries[d].emplace_back(datagen::misspell(std::string(source.data(), source.size()), d, random));
+        }
+    }
+
+    auto start = clock_type::now();
+    fuzzy::symspell_index symspell({.max_distance = 2, .prefix_length = 7});
+    for (const auto& term : dictionary) symspell.add(term);
+    symspell.build();
+    std::printf("symspell: %zu terms, %zu postings, built in %.2f s\n", symspell.size(), symspell.postings(),
+                seconds_since(start));
+
+    start = clock_type::now();
+    fuzzy::bk_tree tree;
+    for (const auto& term : dictionary) tree.add(term);
+    std::printf("bk-tree:  %zu nodes, built in %.2f s\n", tree.size(), seconds_since(start));
+
+    bool ok = true;
+    for (std::size_t d = 1; d <= 2; ++d) {
+        for (std::size_t i = 0; i < 64; ++i) {
+            const auto expected = scan(dictionary, queries[d][i], d, k);
+            ok &= same(symspell.lookup(queries[d][i], d, k), expected);
+            ok &= same(tree.lookup(queries[d][i], d, k), expected);
+        }
+    }
+    if (!ok) std::fprintf(stderr, "MISMATCH: an index disagrees with the linear scan\n");
+
+    std::vector<fuzzy::fuzzy_match> out;
+    std::vector<std::uint32_t> scratch;
+    std::vector<bench::latency_result> results;
+
+    std::printf("\nquery latency in ns (capacity column = max distance), top %zu\n", k);
+    bench::print_latency_header(stdout);
+    for (std::size_t d = 1; d <= 2; ++d) {
+        results.push_back(measure("symspell", d, queries[d], seconds, [&](const types::name_str& q) {
+            symspell.lookup(q, d, k, out, scratch);
+            return out.size();
+        }));
+        bench::print_latency(stdout, results.back());
+
+        results.push_back(measure("bk-tree", d, queries[d], seconds, [&](const types::name_str& q) {
+            tree.lookup(q, d, k, out, scratch);
+            return out.size();
+        }));
+        bench::print_latency(stdout, results.back());
+    }
+
+    // The baseline is too slow for a latency run: mean over a few scans
+    for (std::size_t d = 1; d <= 2; ++d) {
+        std::size_t n = 0;
+        start = clock_type::now();
+        do {
+            bench::do_not_optimize(scan(dictionary, queries[d][n++], d, k).size());
+        } while (seconds_since(start) < 0.5 || n < 3);
+        const double elapsed = seconds_since(start);
+        std::printf("%-20s %8zu %10.0f   mean %.0f ns\n", "linear scan", d, static_cast<double>(n) / elapsed,
+                    elapsed * 1e9 / static_cast<double>(n));
+    }
+
+    // Record linkage: misspelled names against blocks of 1024 dictionary names
+    std::vector<double> scores(1024);
+    std::printf("\n%-20s %8s %14s\n", "similarity", "cutoff", "pairs/s");
+    auto linkage = [&](const char* name, auto make_scorer) {
+        for (const double cutoff : {0.0, 0.9}) {
+            std::size_t pairs = 0;
+            std::size_t block = 0;
+            start = clock_type::now();
+            do {
+                const auto scorer = make_scorer(queries[1][block % queries[1].size()]);
+                const std::size_t count = std::min<std::size_t>(1024, dictionary.size());
+                const std::size_t first = (block * 1024) % (dictionary.size() - count + 1);
+                const std::span<const types::name_str> candidates(dictionary.data() + first, count);
+                bench::do_not_optimize(fuzzy::score_batch(scorer, candidates, scores, cutoff));
+                pairs += count;
+                ++block;
+            } while (seconds_since(start) < seconds);
+            std::printf("%-20s %8.1f %14.0f\n", name, cutoff, static_cast<double>(pairs) / seconds_since(start));
+        }
+    };
+    linkage("jaro-winkler", [](const types::name_str& q) { return fuzzy::jaro_winkler_scorer(q); });
+    linkage("token sort", [](const types::name_str& q) { return fuzzy::token_sort_scorer(q); });
+    linkage("token set", [](const types::name_str& q) { return fuzzy::token_set_scorer(q); });
+
+    return ok ? 0 : 1;
+}
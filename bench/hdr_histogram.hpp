@@ -0,0 +1,146 @@
+#pragma once
+
+/**
+ * @file bench/hdr_histogram.hpp
+ * @brief High dynamic range histogram for latency percentiles
+ *
+ * Records integer values (nanoseconds in the latency benchmarks) from 1 up
+ * to a configured maximum with a fixed number of significant decimal
+ * digits, in constant memory and O(1) per record. The layout follows
+ * HdrHistogram: buckets double in range, and each bucket is split into
+ * the same number of linear sub-buckets, so the relative error is bounded
+ * at every magnitude. That keeps p99.9 and p99.99 exact to the configured
+ * precision, which averaging or fixed-width bins cannot do.
+ *
+ * Usage:
+ *   bench::hdr_histogram h;                     // 1 ns .. 60 s, 3 digits
+ *   h.record(elapsed_ns);
+ *   std::printf("p99.9 %llu ns\n", (unsigned long long)h.percentile(99.9));
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bench {
+
+class hdr_histogram {
+public:
+    /**
+     * @param highest Largest value tracked exactly; larger values are
+     *        recorded as `highest` and counted in saturated()
+     * @param significant_digits Decimal precision kept at every magnitude (1-5)
+     */
+    explicit hdr_histogram(std::uint64_t highest = 60'000'000'000ull, int significant_digits = 3) {
+        significant_digits = std::clamp(significant_digits, 1, 5);
+        highest_ = std::max<std::uint64_t>(highest, 2);
+
+        std::uint64_t resolution = 2;
+        for (int i = 0; i < significant_digits; ++i) resolution *= 10;
+        sub_bucket_magnitude_ = static_cast<int>(std::bit_width(resolution - 1));
+        sub_bucket_count_ = std::uint64_t{1} << sub_bucket_magnitude_;
+        sub_bucket_half_count_ = sub_bucket_count_ / 2;
+        sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+        // Buckets needed until the first value that cannot be tracked exceeds highest
+        std::size_t buckets = 1;
+        for (std::uint64_t untrackable = sub_bucket_count_; untrackable <= highest_; untrackable <<= 1) {
+            ++buckets;
+            if (untrackable > (~std::uint64_t{0} >> 1)) break;
+        }
+        counts_.assign((buckets + 1) * sub_bucket_half_count_, 0);
+    }
+
+    void record(std::uint64_t value, std::uint64_t count = 1) noexcept {
+        if (value > highest_) {
+            value = highest_;
+            saturated_ += count;
+        }
+        counts_[index_of(value)] += count;
+        total_ += count;
+        sum_ += static_cast<double>(value) * static_cast<double>(count);
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    // Add another histogram's counts; both must have the same configuration
+    void merge(const hdr_histogram& other) noexcept {
+        const std::size_t n = std::min(counts_.size(), other.counts_.size());
+        for (std::size_t i = 0; i < n; ++i) counts_[i] += other.counts_[i];
+        total_ += other.total_;
+        saturated_ += other.saturated_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void reset() noexcept {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_ = saturated_ = 0;
+        sum_ = 0;
+        min_ = ~std::uint64_t{0};
+        max_ = 0;
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept { return total_; }
+    [[nodiscard]] std::uint64_t saturated() const noexcept { return saturated_; }
+    [[nodiscard]] std::uint64_t min() const noexcept { return total_ == 0 ? 0 : min_; }
+    [[nodiscard]] std::uint64_t max() const noexcept { return max_; }
+    [[nodiscard]] double mean() const noexcept { return total_ == 0 ? 0.0 : sum_ / static_cast<double>(total_); }
+
+    /**
+     * @brief Smallest recorded value (to the histogram's precision) that at
+     *        least `percent` percent of the records are less than or equal to
+     */
+    [[nodiscard]] std::uint64_t percentile(double percent) const noexcept {
+        if (total_ == 0) return 0;
+        percent = std::clamp(percent, 0.0, 100.0);
+        const auto wanted = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(total_))));
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= wanted) return std::min(highest_equivalent(i), max_);
+        }
+        return max_;
+    }
+
+private:
+    [[nodiscard]] std::size_t index_of(std::uint64_t value) const noexcept {
+        const int bucket = static_cast<int>(std::bit_width(value | sub_bucket_mask_)) - sub_bucket_magnitude_;
+        const std::uint64_t sub_bucket = value >> bucket;
+        return (static_cast<std::size_t>(bucket + 1) << (sub_bucket_magnitude_ - 1)) +
+               static_cast<std::size_t>(sub_bucket - sub_bucket_half_count_);
+    }
+
+    // Largest value that lands in the same slot as counts_[index]
+    [[nodiscard]] std::uint64_t highest_equivalent(std::size_t index) const noexcept {
+        int bucket = static_cast<int>(index >> (sub_bucket_magnitude_ - 1)) - 1;
+        std::uint64_t sub_bucket = (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+        if (bucket < 0) {
+            sub_bucket -= sub_bucket_half_count_;
+            bucket = 0;
+        }
+        const std::uint64_t lowest = sub_bucket << bucket;
+        return lowest + (std::uint64_t{1} << bucket) - 1;
+    }
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t highest_ = 0;
+    std::uint64_t sub_bucket_count_ = 0;
+    std::uint64_t sub_bucket_half_count_ = 0;
+    std::uint64_t sub_bucket_mask_ = 0;
+    int sub_bucket_magnitude_ = 0;
+
+    std::uint64_t total_ = 0;
+    std::uint64_t saturated_ = 0;
+    double sum_ = 0;
+    std::uint64_t min_ = ~std::uint64_t{0};
+    std::uint64_t max_ = 0;
+};
+
+} // namespace bench
@@ -0,0 +1,92 @@
+/**
+ * @file bench/latency.cpp
+ * @brief Latency distributions per algorithm and capacity under fixed-rate load
+ *
+ * Runs the same short URL through construction, copy, trim + case mapping,
+ * split and find at capacities 64, 256 and 2048 (url_str), each at a fixed
+ * request rate (see latency.hpp). The content is identical across
+ * capacities, so differences in the tail come from the capacity itself:
+ * zeroing and copying the whole buffer rather than the characters in use.
+ *
+ * Prints response-time percentiles per case; with a CSV path it also
+ * writes response and service percentiles for every case there.
+ *
+ * Usage: fstring_bench_latency [ops/s] [seconds per case] [out.csv]
+ *        (defaults: 200000 ops/s, 1 s)
+ */
+
+#include "latency.hpp"
+#include <zuu/fstring.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+constexpr std::string_view url = "https://example.com/api/v2/users/4821?f=name,email&sort=asc";
+constexpr std::string_view padded_url = "  https://example.com/api/v2/users/4821?f=name,email&sort=asc  ";
+
+template <std::size_t N>
+void measure_capacity(const bench::load& load, std::vector<bench::latency_result>& results) {
+    static_assert(N >= padded_url.size());
+    using string = fstring<N>;
+
+    const string padded(padded_url);
+    const string source(url);
+    std::string_view input = url;
+
+    auto measure = [&](const char* algorithm, auto&& fn) {
+        results.push_back(bench::measure_latency(algorithm, N, load, fn));
+        bench::print_latency(stdout, results.back());
+    };
+
+    // do_not_optimize makes `input` opaque, so construction is not hoisted
+    measure("construct", [&] {
+        bench::do_not_optimize(input);
+        return string(input).size();
+    });
+    measure("copy", [&] {
+        string copy = source;
+        bench::do_not_optimize(copy);
+        return copy.size();
+    });
+    measure("trim | to_lower", [&] { return (padded | str::trim | str::to_lower).size(); });
+    measure("split(',')", [&] { return (source | str::split(',')).size(); });
+    measure("find", [&] { return str::find(source, "sort="); });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bench::load load;
+    if (argc > 1) load.rate = std::strtod(argv[1], nullptr);
+    if (argc > 2) {
+        load.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double>(std::strtod(argv[2], nullptr)));
+    }
+    if (!(load.rate > 0) || load.duration.count() <= 0) {
+        std::fprintf(stderr, "usage: %s [ops/s] [seconds per case] [out.csv]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<bench::latency_result> results;
+    std::printf("response time in ns, %.0f ops/s scheduled\n", load.rate);
+    bench::print_latency_header(stdout);
+    measure_capacity<64>(load, results);
+    measure_capacity<256>(load, results);
+    measure_capacity<2048>(load, results);
+
+    if (argc > 3) {
+        std::FILE* out = std::fopen(argv[3], "w");
+        if (!out) {
+            std::perror(argv[3]);
+            return 2;
+        }
+        bench::write_latency_csv(out, results);
+        std::fclose(out);
+    }
+    return 0;
+}
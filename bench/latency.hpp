@@ -0,0 +1,146 @@
+#pragma once
+
+/**
+ * @file bench/latency.hpp
+ * @brief Latency mode: per-operation latency distributions under fixed-rate load
+ *
+ * bench::run reports a mean, which hides the tail. Latency mode issues
+ * operations on a fixed schedule (open loop) and records every one into an
+ * hdr_histogram, so percentiles up to p99.99 can be read off.
+ *
+ * The schedule is what avoids coordinated omission: operation i is due at
+ * start + i / rate whether or not operation i - 1 has finished. Response
+ * time is measured from the due time, so when one operation stalls, the
+ * ones queued behind it are charged for the wait, as real callers would
+ * be. A closed loop that just times back-to-back calls records one slow
+ * sample and silently skips the rest. Service time (from the actual start)
+ * is recorded alongside for comparison.
+ *
+ * Usage:
+ *   bench::load load{.rate = 200'000, .duration = std::chrono::seconds(1)};
+ *   auto r = bench::measure_latency("copy", 2048, load, [&] { return url; });
+ *   bench::print_latency_header(stdout);
+ *   bench::print_latency(stdout, r);
+ *   bench::write_latency_csv(file, results);
+ */
+
+#include "bench.hpp"
+#include "hdr_histogram.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+
+namespace bench {
+
+// Fixed-rate schedule for one latency case
+struct load {
+    double rate = 200'000;                                   // operations per second
+    std::chrono::nanoseconds duration = std::chrono::seconds(1);
+    std::chrono::nanoseconds warmup = std::chrono::milliseconds(100);
+};
+
+struct latency_result {
+    const char* algorithm = "";
+    std::size_t capacity = 0;
+    double target_rate = 0;      // operations per second asked for
+    double achieved_rate = 0;    // operations per second completed
+    hdr_histogram response;      // due time to completion
+    hdr_histogram service;       // actual start to completion
+};
+
+// The percentiles reported by print_latency and write_latency_csv
+inline constexpr double latency_percentiles[] = {50, 90, 99, 99.9, 99.99};
+
+/**
+ * @brief Run `fn` at `load.rate` operations per second and record the
+ *        latency of each call
+ *
+ * The driver spins between operations rather than sleeping; sleep
+ * granularity is far coarser than the intervals measured here.
+ */
+template <typename Fn>
+latency_result measure_latency(const char* algorithm, std::size_t capacity, const load& load, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+
+    latency_result result;
+    result.algorithm = algorithm;
+    result.capacity = capacity;
+    result.target_rate = load.rate;
+
+    const auto interval = std::chrono::duration<double, std::nano>(1e9 / load.rate);
+    auto run_for = [&](std::chrono::nanoseconds duration, bool keep) {
+        const auto start = clock::now();
+        const auto total = static_cast<std::uint64_t>(duration.count() / interval.count());
+        for (std::uint64_t i = 0; i < total; ++i) {
+            const auto due = start + std::chrono::duration_cast<clock::duration>(interval * static_cast<double>(i));
+            auto begin = clock::now();
+            while (begin < due) begin = clock::now();
+
+            do_not_optimize(fn());
+            const auto end = clock::now();
+
+            if (keep) {
+                result.response.record(static_cast<std::uint64_t>((end - due).count()));
+                result.service.record(static_cast<std::uint64_t>((end - begin).count()));
+            }
+        }
+        return clock::now() - start;
+    };
+
+    run_for(load.warmup, false);
+    const auto elapsed = run_for(load.duration, true);
+    result.achieved_rate =
+        static_cast<double>(result.response.count()) / std::chrono::duration<double>(elapsed).count();
+    return result;
+}
+
+inline void print_latency_header(std::FILE* out) {
+    std::fprintf(out, "%-20s %8s %10s", "algorithm", "capacity", "ops/s");
+    for (const double p : latency_percentiles) {
+        char label[16];
+        std::snprintf(label, sizeof label, "p%g", p);
+        std::fprintf(out, " %8s", label);
+    }
+    std::fprintf(out, " %10s %10s\n", "max", "svc p99.9");
+}
+
+// One row: response-time percentiles in ns, plus the service-time p99.9
+inline void print_latency(std::FILE* out, const latency_result& r) {
+    std::fprintf(out, "%-20s %8zu %10.0f", r.algorithm, r.capacity, r.achieved_rate);
+    for (const double p : latency_percentiles) {
+        std::fprintf(out, " %8llu", static_cast<unsigned long long>(r.response.percentile(p)));
+    }
+    std::fprintf(out, " %10llu %10llu\n", static_cast<unsigned long long>(r.response.max()),
+                 static_cast<unsigned long long>(r.service.percentile(99.9)));
+    if (r.achieved_rate < r.target_rate * 0.95) {
+        std::fprintf(out, "  (fell behind the %.0f ops/s schedule; the tail includes queueing)\n", r.target_rate);
+    }
+}
+
+/**
+ * @brief CSV with one row per (algorithm, capacity, clock), values in ns:
+ *        algorithm,capacity,clock,rate,count,mean,p50,p90,p99,p99.9,p99.99,max
+ *
+ * `clock` is "response" (from the scheduled time) or "service".
+ */
+inline void write_latency_csv(std::FILE* out, std::span<const latency_result> results) {
+    std::fprintf(out, "algorithm,capacity,clock,rate,count,mean");
+    for (const double p : latency_percentiles) std::fprintf(out, ",p%g", p);
+    std::fprintf(out, ",max\n");
+
+    for (const auto& r : results) {
+        for (const auto* h : {&r.response, &r.service}) {
+            std::fprintf(out, "%s,%zu,%s,%.0f,%llu,%.1f", r.algorithm, r.capacity,
+                         h == &r.response ? "response" : "service", r.achieved_rate,
+                         static_cast<unsigned long long>(h->count()), h->mean());
+            for (const double p : latency_percentiles) {
+                std::fprintf(out, ",%llu", static_cast<unsigned long long>(h->percentile(p)));
+            }
+            std::fprintf(out, ",%llu\n", static_cast<unsigned long long>(h->max()));
+        }
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,382 @@
+/**
+ * @file bench/macro.cpp
+ * @brief Macro workloads: log aggregation, CSV group-by and URL routing
+ *
+ * Each workload runs end to end over deterministic synthetic data
+ * (datagen.hpp) and reports records/s and bytes/s:
+ *
+ *   log aggregate   split lines, parse each into fstring fields, count per
+ *                   level and status class, latency per endpoint
+ *   csv group-by    load a quoted CSV into fstring/int columns, then sum
+ *                   quantity and revenue per region
+ *   url routing     longest-prefix match of request paths against a
+ *                   route table
+ *
+ * Before timing, every result is checked against a straightforward
+ * std::string implementation; a mismatch fails the run (exit status 1),
+ * so the binary doubles as an acceptance test when a kernel changes.
+ *
+ * Usage: fstring_bench_macro [records]   (default 1000000)
+ */
+
+#include "bench.hpp"
+#include "datagen.hpp"
+#include <zuu/stream.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+bool check(bool ok, const char* workload) {
+    if (!ok) std::printf("%-32s FAILED: result differs from the reference\n", workload);
+    return ok;
+}
+
+template <std::size_t Cap>
+fstring<Cap> field(std::string_view text) {
+    return fstring<Cap>(text.data(), text.size());
+}
+
+// ==================== Log Aggregation ====================
+
+constexpr std::string_view level_names[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+struct endpoint_stats {
+    std::size_t requests = 0;
+    std::size_t latency_ms = 0;
+
+    bool operator==(const endpoint_stats&) const = default;
+};
+
+struct log_summary {
+    std::array<std::size_t, 4> per_level{};
+    std::array<std::size_t, 6> per_class{};  // 0xx .. 5xx
+    std::size_t bytes_sent = 0;
+    std::map<std::string, endpoint_stats> endpoints;
+
+    bool operator==(const log_summary&) const = default;
+};
+
+struct log_record {
+    fstring<24> timestamp;
+    fstring<8> level;
+    fstring<8> method;
+    fstring<48> path;
+    fstring<8> status;
+    fstring<8> latency;
+    fstring<8> bytes;
+};
+
+// "/api/users/4821" -> "/api/users/", "/api/search?q=7" -> "/api/search"
+std::string_view endpoint_of(std::string_view path) {
+    path = path.substr(0, path.find('?'));
+    while (!path.empty() && path.back() >= '0' && path.back() <= '9') path.remove_suffix(1);
+    return path;
+}
+
+std::size_t level_index(std::string_view level) {
+    return static_cast<std::size_t>(std::find(std::begin(level_names), std::end(level_names), level) -
+                                    std::begin(level_names));
+}
+
+log_summary aggregate_log(std::string_view log) {
+    log_summary summary;
+    std::unordered_map<fstring<48>, endpoint_stats> endpoints;
+
+    stream::for_each_record(log, [&](std::size_t, std::string_view line) {
+        const auto fields = line | str::split_whitespace;
+        if (fields.size() != 7) return;
+
+        const log_record record{field<24>(fields[0]), field<8>(fields[1]), field<8>(fields[2]), field<48>(fields[3]),
+                                field<8>(fields[4]),  field<8>(fields[5]), field<8>(fields[6])};
+
+        const std::size_t level = level_index(record.level);
+        if (level < 4) ++summary.per_level[level];
+
+        const int status = fmt::parse_int<int>(record.status);
+        ++summary.per_class[static_cast<std::size_t>(std::clamp(status / 100, 0, 5))];
+        summary.bytes_sent += fmt::parse_int<std::size_t>(record.bytes);
+
+        auto& endpoint = endpoints[field<48>(endpoint_of(record.path))];
+        ++endpoint.requests;
+        endpoint.latency_ms += fmt::parse_int<std::size_t>(record.latency);
+    }, {.threads = 1});
+
+    for (const auto& [path, stats] : endpoints) summary.endpoints.emplace(std::string(str::as_view(path)), stats);
+    return summary;
+}
+
+log_summary aggregate_log_reference(const std::string& log) {
+    log_summary summary;
+    std::size_t start = 0;
+
+    while (start < log.size()) {
+        std::size_t eol = log.find('\n', start);
+        if (eol == std::string::npos) eol = log.size();
+        const std::string line = log.substr(start, eol - start);
+        start = eol + 1;
+
+        std::vector<std::string> fields;
+        std::size_t pos = 0;
+        while (pos <= line.size()) {
+            std::size_t space = line.find(' ', pos);
+            if (space == std::string::npos) space = line.size();
+            fields.push_back(line.substr(pos, space - pos));
+            pos = space + 1;
+        }
+        if (fields.size() != 7) continue;
+
+        const std::size_t level = level_index(fields[1]);
+        if (level < 4) ++summary.per_level[level];
+        ++summary.per_class[static_cast<std::size_t>(std::clamp(std::stoi(fields[4]) / 100, 0, 5))];
+        summary.bytes_sent += std::stoul(fields[6]);
+
+        auto& endpoint = summary.endpoints[std::string(endpoint_of(fields[3]))];
+        ++endpoint.requests;
+        endpoint.latency_ms += std::stoul(fields[5]);
+    }
+    return summary;
+}
+
+// ==================== CSV Group-By ====================
+
+struct region_totals {
+    std::size_t rows = 0;
+    std::size_t quantity = 0;
+    std::size_t revenue_cents = 0;
+
+    bool operator==(const region_totals&) const = default;
+};
+
+using group_result = std::map<std::string, region_totals>;
+
+// Column store for the sales CSV
+struct sales_table {
+    std::vector<fstring<16>> region;
+    std::vector<fstring<24>> product;
+    std::vector<int> quantity;
+    std::vector<int> price_cents;
+
+    void reserve(std::size_t rows) {
+        region.reserve(rows);
+        product.reserve(rows);
+        quantity.reserve(rows);
+        price_cents.reserve(rows);
+    }
+};
+
+// "123.45" -> 12345
+int to_cents(std::string_view text) {
+    const std::size_t dot = text.find('.');
+    const int whole = fmt::parse_int<int>(field<16>(text.substr(0, dot)));
+    if (dot == std::string_view::npos) return whole * 100;
+    return whole * 100 + fmt::parse_int<int>(field<4>(text.substr(dot + 1)));
+}
+
+std::string_view unquote(std::string_view text) {
+    if (text.size() >= 2 && text.front() == '"' && text.back() == '"') return text.substr(1, text.size() - 2);
+    return text;
+}
+
+sales_table load_sales(std::string_view csv, std::size_t rows_hint) {
+    sales_table table;
+    table.reserve(rows_hint);
+    bool header = true;
+
+    stream::for_each_record(csv, [&](std::size_t, std::string_view row) {
+        if (std::exchange(header, false)) return;
+
+        std::array<std::string_view, 4> cells;
+        std::size_t n = 0;
+        const char* start = row.data();
+        simd::for_each_delimiter(row.data(), row.data() + row.size(), ',', '"', [&](const char* comma) {
+            if (n < 3) cells[n++] = std::string_view(start, static_cast<std::size_t>(comma - start));
+            start = comma + 1;
+        });
+        if (n != 3) return;
+        cells[3] = std::string_view(start, static_cast<std::size_t>(row.data() + row.size() - start));
+
+        table.region.push_back(field<16>(cells[0]));
+        table.product.push_back(field<24>(unquote(cells[1])));
+        table.quantity.push_back(fmt::parse_int<int>(field<8>(cells[2])));
+        table.price_cents.push_back(to_cents(cells[3]));
+    }, {.quote_aware = true, .threads = 1});
+
+    return table;
+}
+
+group_result group_by_region(const sales_table& table) {
+    std::unordered_map<fstring<16>, region_totals> groups;
+    for (std::size_t i = 0; i < table.region.size(); ++i) {
+        auto& totals = groups[table.region[i]];
+        ++totals.rows;
+        totals.quantity += static_cast<std::size_t>(table.quantity[i]);
+        totals.revenue_cents += static_cast<std::size_t>(table.quantity[i]) * static_cast<std::size_t>(table.price_cents[i]);
+    }
+
+    group_result result;
+    for (const auto& [region, totals] : groups) result.emplace(std::string(str::as_view(region)), totals);
+    return result;
+}
+
+group_result group_by_region_reference(const std::string& csv) {
+    group_result result;
+    std::size_t start = csv.find('\n') + 1;  // skip the header
+
+    while (start < csv.size()) {
+        std::size_t eol = csv.find('\n', start);
+        if (eol == std::string::npos) eol = csv.size();
+        const std::string row = csv.substr(start, eol - start);
+        start = eol + 1;
+
+        std::vector<std::string> cells(1);
+        bool quoted = false;
+        for (const char ch : row) {
+            if (ch == '"') {
+                quoted = !quoted;
+            } else if (ch == ',' && !quoted) {
+                cells.emplace_back();
+            } else {
+                cells.back() += ch;
+            }
+        }
+        if (cells.size() != 4) continue;
+
+        const std::size_t dot = cells[3].find('.');
+        const std::size_t cents = std::stoul(cells[3].substr(0, dot)) * 100 + std::stoul(cells[3].substr(dot + 1));
+        auto& totals = result[cells[0]];
+        ++totals.rows;
+        totals.quantity += std::stoul(cells[2]);
+        totals.revenue_cents += std::stoul(cells[2]) * cents;
+    }
+    return result;
+}
+
+// ==================== URL Routing ====================
+
+/**
+ * Longest-prefix match over a sorted table. The longest route that is a
+ * prefix of a path is also a prefix of the path's sorted predecessor, so
+ * the lookup is one binary search followed by a walk up that
+ * predecessor's chain of prefix routes.
+ */
+class router {
+public:
+    static constexpr std::size_t no_route = static_cast<std::size_t>(-1);
+
+    explicit router(std::vector<std::string> table) {
+        std::sort(table.begin(), table.end());
+        table.erase(std::unique(table.begin(), table.end()), table.end());
+
+        for (const auto& route : table) routes_.push_back(field<48>(route));
+        parent_.assign(routes_.size(), no_route);
+
+        // Parent: the nearest earlier route that is a prefix
+        for (std::size_t i = 1; i < routes_.size(); ++i) {
+            for (std::size_t j = i - 1; j != no_route; j = parent_[j]) {
+                if (str::starts_with(routes_[i], routes_[j])) {
+                    parent_[i] = j;
+                    break;
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t route(std::string_view path) const {
+        const auto it = std::upper_bound(routes_.begin(), routes_.end(), path,
+                                         [](std::string_view p, const auto& r) { return p < str::as_view(r); });
+        std::size_t i = static_cast<std::size_t>(it - routes_.begin()) - 1;  // no_route if none is <= path
+
+        while (i != no_route && !str::starts_with(path, routes_[i])) i = parent_[i];
+        return i;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return routes_.size(); }
+    [[nodiscard]] std::string_view at(std::size_t i) const noexcept { return str::as_view(routes_[i]); }
+
+private:
+    std::vector<fstring<48>> routes_;
+    std::vector<std::size_t> parent_;
+};
+
+// Hits per route (sorted table order), then the unrouted count
+std::vector<std::size_t> route_all(const router& table, std::string_view paths) {
+    std::vector<std::size_t> hits(table.size() + 1);
+    stream::for_each_record(paths, [&](std::size_t, std::string_view path) {
+        const std::size_t i = table.route(path);
+        ++hits[i == router::no_route ? table.size() : i];
+    }, {.threads = 1});
+    return hits;
+}
+
+std::vector<std::size_t> route_all_reference(const router& table, const std::string& paths) {
+    std::vector<std::size_t> hits(table.size() + 1);
+    std::size_t start = 0;
+
+    while (start < paths.size()) {
+        std::size_t eol = paths.find('\n', start);
+        if (eol == std::string::npos) eol = paths.size();
+        const std::string path = paths.substr(start, eol - start);
+        start = eol + 1;
+
+        std::size_t best = table.size();
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            const std::string_view route = table.at(i);
+            if (path.compare(0, route.size(), route) == 0 &&
+                (best == table.size() || route.size() > table.at(best).size())) {
+                best = i;
+            }
+        }
+        ++hits[best];
+    }
+    return hits;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t records = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    bool ok = true;
+
+    {
+        const std::string log = datagen::access_log(records, 42);
+        ok &= check(aggregate_log(log) == aggregate_log_reference(log), "log aggregate");
+        bench::run("log aggregate", {.records = records, .bytes = log.size()}, [&] {
+            return aggregate_log(log).bytes_sent;
+        });
+    }
+
+    {
+        const std::string csv = datagen::sales_csv(records, 7);
+        ok &= check(group_by_region(load_sales(csv, records)) == group_by_region_reference(csv), "csv group-by");
+        bench::run("csv load + group-by", {.records = records, .bytes = csv.size()}, [&] {
+            return group_by_region(load_sales(csv, records)).size();
+        });
+
+        const sales_table table = load_sales(csv, records);
+        bench::run("csv group-by (loaded)", {.records = records}, [&] {
+            return group_by_region(table).size();
+        });
+    }
+
+    {
+        const router table(datagen::route_table(3));
+        const std::string paths = datagen::request_paths(datagen::route_table(3), records, 3);
+        ok &= check(route_all(table, paths) == route_all_reference(table, paths), "url routing");
+        bench::run("url routing", {.records = records, .bytes = paths.size()}, [&] {
+            return route_all(table, paths).back();
+        });
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file bench/natural.cpp
+ * @brief Natural-order sorting: comparator sort against sort keys
+ *
+ * Sorts generated file and version names ("IMG_1042.jpg",
+ * "Report-v2.10.3.pdf") case-insensitively in natural order, three ways:
+ * std::sort with str::natural_less_icase over std::string and over
+ * fstring<32>, and str::natural_sort_icase, which radix-sorts 24-byte
+ * memcmp keys and compares full strings only on ties. A plain
+ * lexicographic std::sort of the std::strings is the baseline. Each pass
+ * copies the unsorted input first, in every case. The results must agree
+ * (exit status 1 otherwise).
+ *
+ * Usage: fstring_bench_natural [names] (default: 1000000)
+ */
+
+#include "bench.hpp"
+#include "datagen.hpp"
+#include <zuu/fstring.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace zuu;
+
+int main(int argc, char** argv) {
+    const std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    const std::vector<std::string> names = datagen::file_names(count, 9);
+    std::vector<fstring<32>> fixed;
+    fixed.reserve(names.size());
+    for (const auto& name : names) fixed.emplace_back(name);
+    std::printf("%zu names, e.g. %s, %s\n\n", names.size(), names[0].c_str(), names[1].c_str());
+
+    const bench::volume work{.records = names.size()};
+    bench::run("std::sort lexicographic", work, [&] {
+        auto copy = names;
+        std::sort(copy.begin(), copy.end());
+        return copy.size();
+    });
+    bench::run("std::sort natural (string)", work, [&] {
+        auto copy = names;
+        std::sort(copy.begin(), copy.end(), str::natural_less_icase);
+        return copy.size();
+    });
+    bench::run("std::sort natural (fstring)", work, [&] {
+        auto copy = fixed;
+        std::sort(copy.begin(), copy.end(), str::natural_less_icase);
+        return copy.size();
+    });
+    bench::run("natural_sort keys (fstring)", work, [&] {
+        auto copy = fixed;
+        str::natural_sort_icase(std::span(copy));
+        return copy.size();
+    });
+
+    auto expected = fixed;
+    std::sort(expected.begin(), expected.end(), str::natural_less_icase);
+    auto sorted = fixed;
+    str::natural_sort_icase(std::span(sorted));
+    bool ok = true;
+    for (std::size_t i = 0; i < sorted.size(); ++i) ok &= str::natural_compare_icase(sorted[i], expected[i]) == 0;
+    if (!ok) std::fprintf(stderr, "MISMATCH: natural_sort disagrees with std::sort\n");
+    return ok ? 0 : 1;
+}
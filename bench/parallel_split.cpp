@@ -0,0 +1,65 @@
+/**
+ * @file bench/parallel_split.cpp
+ * @brief Parallel record splitting throughput against thread count
+ *
+ * Splits a 256 MiB buffer of log lines, and the same amount of CSV with
+ * quoted multi-line fields, with 1 to hardware_concurrency threads. The
+ * records are only counted, so the numbers approach the scan bandwidth.
+ */
+
+#include "bench.hpp"
+#include <zuu/stream.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+std::string make_text(std::size_t bytes, bool csv) {
+    std::string text;
+    text.reserve(bytes + 128);
+    for (std::size_t i = 0; text.size() < bytes; ++i) {
+        if (csv) {
+            text += std::to_string(i);
+            text += i % 5 == 0 ? ",\"note, with\nnewline\",42\n" : ",plain text field,42\n";
+        } else {
+            text += "2025-11-26T10:00:00Z INFO GET /api/users/";
+            text += std::to_string(i % 1000);
+            text += " 200 17ms\n";
+        }
+    }
+    return text;
+}
+
+void bench_split(const char* name, const std::string& text, bool quote_aware) {
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        char label[64];
+        std::snprintf(label, sizeof label, "%s/%zu threads", name, threads);
+
+        const stream::split_options options{.quote_aware = quote_aware, .threads = threads};
+        bench::run(label, text.size(), [&] {
+            // One counter per region, a cache line apart
+            std::vector<std::size_t> counts(threads * 8);
+            stream::for_each_record(text, [&](std::size_t region, std::string_view) {
+                ++counts[region * 8];
+            }, options);
+            return std::accumulate(counts.begin(), counts.end(), std::size_t{0});
+        });
+    }
+}
+
+} // namespace
+
+int main() {
+    const std::size_t bytes = std::size_t{256} << 20;
+    bench_split("lines", make_text(bytes, false), false);
+    bench_split("csv (quote-aware)", make_text(bytes, true), true);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file bench/pipeline.cpp
+ * @brief Throughput scaling of the staged pipeline executor
+ *
+ * Runs a log-processing chain (read -> parse -> normalize -> enrich ->
+ * serialize -> checksum) over 200k synthetic access-log lines with 1 to
+ * hardware_concurrency threads, once with one record per batch and once
+ * with 64, to show the cost of per-record hand-off.
+ */
+
+#include "bench.hpp"
+#include <zuu/stream.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+using namespace zuu;
+
+namespace {
+
+using line_t = fstring<128>;
+
+struct log_entry {
+    fstring<32> timestamp;
+    fstring<8> level;
+    fstring<64> path;
+    int status = 0;
+    int latency_ms = 0;
+    std::size_t shard = 0;
+};
+
+std::string make_log(std::size_t lines) {
+    static constexpr std::string_view levels[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+    static constexpr std::string_view paths[] = {"/api/Users/", "/api/Orders/", "/static/img/", "/Health/"};
+    static constexpr int statuses[] = {200, 200, 200, 304, 404, 500};
+
+    std::string text;
+    text.reserve(lines * 64);
+    for (std::size_t i = 0; i < lines; ++i) {
+        text += "2025-11-26T10:";
+        text += std::to_string(10 + i % 50);
+        text += ":00Z ";
+        text += levels[i % 4];
+        text += ' ';
+        text += paths[(i / 3) % 4];
+        text += std::to_string(i % 997);
+        text += "/ ";
+        text += std::to_string(statuses[i % 6]);
+        text += ' ';
+        text += std::to_string(i % 250);
+        text += "ms\n";
+    }
+    return text;
+}
+
+int to_int(std::string_view s) {
+    int value = 0;
+    std::from_chars(s.data(), s.data() + s.size(), value);
+    return value;
+}
+
+std::size_t run_chain(std::string_view log, std::size_t threads, std::size_t batch) {
+    std::size_t pos = 0;
+    std::size_t checksum = 0;
+
+    auto read = [&](stream::flow_control& fc) {
+        const std::size_t eol = log.find('\n', pos);
+        if (eol == std::string_view::npos) {
+            fc.stop();
+            return line_t{};
+        }
+        line_t line(log.data() + pos, eol - pos);
+        pos = eol + 1;
+        return line;
+    };
+
+    auto parse = [](const line_t& line) {
+        const auto fields = str::as_view(line) | str::split_whitespace;
+        log_entry entry;
+        if (fields.size() == 5) {
+            entry.timestamp = fstring<32>(fields[0].data(), fields[0].size());
+            entry.level = fstring<8>(fields[1].data(), fields[1].size());
+            entry.path = fstring<64>(fields[2].data(), fields[2].size());
+            entry.status = to_int(fields[3]);
+            entry.latency_ms = to_int(fields[4]);
+        }
+        return entry;
+    };
+
+    auto normalize = [](log_entry entry) {
+        entry.path = entry.path | str::to_lower | str::trim_if([](char c) { return c == '/'; });
+        return entry;
+    };
+
+    auto enrich = [](log_entry entry) {
+        entry.shard = std::hash<fstring<64>>{}(entry.path) % 16;
+        return entry;
+    };
+
+    auto serialize = [](const log_entry& entry) {
+        line_t out = "shard=";
+        out += fmt::to_fstring(entry.shard);
+        out += " class=";
+        out += static_cast<char>('0' + entry.status / 100);
+        out += "xx level=";
+        out += entry.level | str::to_lower;
+        out += " path=";
+        out += entry.path;
+        out += " ms=";
+        out += fmt::to_fstring(entry.latency_ms);
+        return out;
+    };
+
+    auto checksum_stage = [&](const line_t& out) { checksum += std::hash<line_t>{}(out); };
+
+    using enum stream::stage_mode;
+    stream::run_pipeline(
+        stream::make_stage<void, line_t>(serial_in_order, read)
+        & stream::make_stage<line_t, log_entry>(parallel, parse)
+        & stream::make_stage<log_entry, log_entry>(parallel, normalize)
+        & stream::make_stage<log_entry, log_entry>(parallel, enrich)
+        & stream::make_stage<log_entry, line_t>(parallel, serialize)
+        & stream::make_stage<line_t, void>(serial_in_order, checksum_stage),
+        {.threads = threads, .batch = batch});
+    return checksum;
+}
+
+} // namespace
+
+int main() {
+    const std::string log = make_log(200000);
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (const std::size_t batch : {std::size_t{1}, std::size_t{64}}) {
+        std::printf("-- batch %zu --\n", batch);
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+            char label[64];
+            std::snprintf(label, sizeof label, "log chain/%zu threads", threads);
+            bench::run(label, log.size(), [&] { return run_chain(log, threads, batch); });
+        }
+    }
+}
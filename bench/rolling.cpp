@@ -0,0 +1,139 @@
+/**
+ * @file bench/rolling.cpp
+ * @brief Rolling-hash throughput: multi-needle search and FastCDC chunking
+ *
+ * Multi-search: 1 to 4096 needles of 16 bytes, half of them taken from the
+ * text, so hits are real. Throughput is in GB/s. Match counts for small
+ * sets are checked against one std::string_view::find scan per needle; a
+ * mismatch fails the run (exit status 1).
+ *
+ * Chunking: FastCDC at 4, 8 and 16 KiB average chunk sizes, with the mean
+ * chunk size. The buffer is then edited (100 random 8-byte insertions) and
+ * chunked again; "reused" is the share of the edited buffer's bytes in
+ * chunks the original already had, i.e. what a dedup store would not
+ * write twice.
+ *
+ * Input is a generated access log, or any file given as the third
+ * argument (memory-mapped).
+ *
+ * Usage: fstring_bench_rolling [megabytes] [seconds per case] [file]
+ *        (defaults: 256, 1 s)
+ */
+
+#include "bench.hpp"
+#include "datagen.hpp"
+#include <zuu/rolling.hpp>
+#include <zuu/stream.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start) {
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+// GB/s of fn over `text`, repeated for at least `seconds`
+template <typename Fn>
+double gigabytes_per_second(std::string_view text, double seconds, Fn&& fn) {
+    std::size_t passes = 0;
+    const auto start = clock_type::now();
+    do {
+        bench::do_not_optimize(fn(text));
+        ++passes;
+    } while (seconds_since(start) < seconds);
+    return static_cast<double>(passes * text.size()) / seconds_since(start) / 1e9;
+}
+
+std::size_t scan_count(std::string_view text, std::string_view needle) {
+    std::size_t n = 0;
+    for (std::size_t pos = text.find(needle); pos != std::string_view::npos; pos = text.find(needle, pos + 1)) ++n;
+    return n;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+    const double seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 1.0;
+
+    std::string generated;
+    stream::mapped_file file;
+    if (argc > 3) {
+        file = stream::mapped_file(argv[3]);
+        if (!file) {
+            std::fprintf(stderr, "cannot read %s\n", argv[3]);
+            return 1;
+        }
+    } else {
+        generated = datagen::access_log(megabytes * 1024 * 1024 / 48, 31);
+    }
+    const std::string_view text = argc > 3 ? file.view() : std::string_view(generated);
+    std::printf("input: %.1f MB\n\n", static_cast<double>(text.size()) / 1e6);
+
+    bool ok = true;
+    datagen::rng random(32);
+    std::printf("%-24s %10s %12s\n", "multi-search (16 B)", "GB/s", "matches");
+    for (const std::size_t count : {1, 16, 256, 4096}) {
+        rolling::multi_search needles(16);
+        std::vector<std::string> list;
+        while (needles.size() < count && text.size() >= 16) {
+            std::string needle;
+            if (random.below(2) == 0) {
+                needle = std::string(text.substr(random.below(text.size() - 15), 16));
+            } else {
+                for (int i = 0; i < 16; ++i) needle += static_cast<char>('a' + random.below(26));
+            }
+            if (needles.add(needle) == list.size()) list.push_back(needle);
+        }
+
+        const std::size_t matches = needles.count(text);
+        if (count <= 16) {
+            std::size_t expected = 0;
+            for (const auto& needle : list) expected += scan_count(text, needle);
+            ok &= matches == expected;
+        }
+        const double rate = gigabytes_per_second(text, seconds, [&](std::string_view t) { return needles.count(t); });
+        std::printf("%-24zu %10.2f %12zu\n", count, rate, matches);
+    }
+    if (!ok) std::fprintf(stderr, "MISMATCH: multi-search disagrees with a per-needle scan\n");
+
+    // 100 insertions of 8 bytes at random offsets
+    std::string edited(text);
+    for (int i = 0; i < 100; ++i) edited.insert(random.below(edited.size() + 1), "EDITED!!");
+
+    std::printf("\n%-24s %10s %12s %10s\n", "fastcdc (avg)", "GB/s", "mean chunk", "reused");
+    for (const std::size_t avg : {4096, 8192, 16384}) {
+        const rolling::fastcdc chunker({.min_size = avg / 4, .avg_size = avg, .max_size = avg * 8});
+        const double rate = gigabytes_per_second(text, seconds, [&](std::string_view t) {
+            std::size_t chunks = 0;
+            chunker.for_each_chunk(t, [&chunks](std::size_t, std::size_t) { ++chunks; });
+            return chunks;
+        });
+
+        std::unordered_set<std::string_view> stored;
+        std::size_t chunks = 0;
+        chunker.for_each_chunk(text, [&](std::size_t offset, std::size_t size) {
+            stored.insert(text.substr(offset, size));
+            ++chunks;
+        });
+        std::size_t reused = 0;
+        chunker.for_each_chunk(edited, [&](std::size_t offset, std::size_t size) {
+            if (stored.count(std::string_view(edited).substr(offset, size)) != 0) reused += size;
+        });
+        std::printf("%-24zu %10.2f %12.0f %9.1f%%\n", avg, rate,
+                    static_cast<double>(text.size()) / static_cast<double>(std::max<std::size_t>(chunks, 1)),
+                    100.0 * static_cast<double>(reused) / static_cast<double>(edited.size()));
+    }
+    return ok ? 0 : 1;
+}
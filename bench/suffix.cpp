@@ -0,0 +1,119 @@
+/**
+ * @file bench/suffix.cpp
+ * @brief Suffix-array index: build throughput, query latency, save and load
+ *
+ * Records are the lines of a generated access log. The index is built with
+ * 1 shard and with one shard per hardware thread (at least 4), on all
+ * hardware threads (MB/s of corpus). Queries
+ * are substrings of 4 to 16 bytes cut from random records, so every query
+ * has hits; the mean time per count() is compared with scanning every
+ * record with std::string_view::find. Hit counts are checked against the
+ * scan, and a mismatch fails the run (exit status 1). Save and load times
+ * are reported for a file in the temp directory; load maps the file, so it
+ * should not depend on the corpus size.
+ *
+ * Usage: fstring_bench_suffix [megabytes] [queries] (defaults: 64, 2000)
+ */
+
+#include "bench.hpp"
+#include "datagen.hpp"
+#include <zuu/stream.hpp>
+#include <zuu/suffix.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double seconds_since(clock_type::time_point start) {
+    return std::chrono::duration<double>(clock_type::now() - start).count();
+}
+
+std::size_t scan_count(const std::vector<std::string_view>& records, std::string_view pattern) {
+    std::size_t n = 0;
+    for (const auto record : records) {
+        for (std::size_t pos = record.find(pattern); pos != std::string_view::npos; pos = record.find(pattern, pos + 1)) ++n;
+    }
+    return n;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64;
+    const std::size_t query_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000;
+
+    const std::string log = datagen::access_log(megabytes * 1024 * 1024 / 48, 41);
+    std::vector<std::string_view> records;
+    for (const std::string_view line : stream::mapped_lines(log)) records.push_back(line);
+    std::printf("corpus: %.1f MB, %zu records\n\n", static_cast<double>(log.size()) / 1e6, records.size());
+
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::printf("%-28s %10s %10s\n", "build", "seconds", "MB/s");
+    suffix::suffix_index index;
+    for (const std::size_t shards : {std::size_t{1}, std::max<std::size_t>(hardware, 4)}) {
+        suffix::suffix_index built;
+        for (const auto record : records) built.add(record);
+        const auto start = clock_type::now();
+        built.build({.shards = shards});
+        const double elapsed = seconds_since(start);
+        char label[64];  // two 20-digit counts and the text
+        std::snprintf(label, sizeof label, "%zu shard(s), %zu thread(s)", shards, std::min(shards, hardware));
+        std::printf("%-28s %10.2f %10.1f\n", label, elapsed, static_cast<double>(log.size()) / elapsed / 1e6);
+        index = std::move(built);
+    }
+
+    datagen::rng random(42);
+    std::vector<std::string> queries;
+    while (queries.size() < query_count) {
+        const std::string_view record = records[random.below(records.size())];
+        const std::size_t length = 4 + random.below(13);
+        if (record.size() < length) continue;
+        queries.emplace_back(record.substr(random.below(record.size() - length + 1), length));
+    }
+
+    std::size_t hits = 0;
+    auto start = clock_type::now();
+    for (const auto& query : queries) hits += index.count(query);
+    const double indexed = seconds_since(start) / static_cast<double>(queries.size());
+
+    // The scan is slow: time and check a sample
+    const std::size_t sample = std::min<std::size_t>(queries.size(), 20);
+    bool ok = true;
+    start = clock_type::now();
+    for (std::size_t i = 0; i < sample; ++i) {
+        const std::size_t expected = scan_count(records, queries[i]);
+        ok &= index.count(queries[i]) == expected && index.find_all(queries[i]).size() == expected;
+    }
+    const double scanned = seconds_since(start) / static_cast<double>(sample);
+    bench::do_not_optimize(hits);
+    if (!ok) std::fprintf(stderr, "MISMATCH: index counts disagree with a scan\n");
+
+    std::printf("\n%-24s %12s %12s\n", "count() per query", "index", "scan");
+    std::printf("%-24s %10.2f us %10.0f us   (%.0fx, %.1f hits/query)\n", "", indexed * 1e6, scanned * 1e6,
+                scanned / indexed, static_cast<double>(hits) / static_cast<double>(queries.size()));
+
+    const std::string path = (std::filesystem::temp_directory_path() / "fstring_bench_suffix.sa").string();
+    start = clock_type::now();
+    ok &= index.save(path.c_str());
+    const double saved = seconds_since(start);
+    suffix::suffix_index mapped;
+    start = clock_type::now();
+    ok &= mapped.load(path.c_str());
+    const double loaded = seconds_since(start);
+    ok &= mapped.count(queries.front()) == index.count(queries.front());
+    std::printf("\n%-24s %10.3f s\n%-24s %10.3f s   (%.0f MB file)\n", "save", saved, "load (mapped)", loaded,
+                static_cast<double>(std::filesystem::file_size(path)) / 1e6);
+    std::filesystem::remove(path);
+    return ok ? 0 : 1;
+}
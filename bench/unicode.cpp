@@ -0,0 +1,101 @@
+/**
+ * @file bench/unicode.cpp
+ * @brief NFC/NFD normalization throughput by script mix
+ *
+ * Generated text in four mixes: ASCII, Latin-1 prose in NFC, the same
+ * prose in NFD (combining marks after every accented letter) and Korean.
+ * For each, the NFC and NFD checks (unicode::is_nfc / is_nfd, run on
+ * text already in that form, so the whole input is scanned) and full
+ * normalization into std::string and into u8fstring<256> lines are timed. Results are checked against each other: every form must
+ * pass its own quick check and NFC and NFD must round-trip (exit status 1
+ * otherwise).
+ *
+ * Usage: fstring_bench_unicode [megabytes] (default: 16)
+ */
+
+#include "bench.hpp"
+#include "datagen.hpp"
+#include <zuu/unicode.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+// Random words, eight to a line, about `bytes` long
+std::string text(std::size_t bytes, const std::vector<std::string_view>& words, std::uint64_t seed) {
+    datagen::rng random(seed);
+    std::string out;
+    for (std::size_t i = 1; out.size() < bytes; ++i) {
+        out += words[random.below(words.size())];
+        out += i % 8 == 0 ? '\n' : ' ';
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16;
+    const std::size_t bytes = megabytes << 20;
+
+    const std::vector<std::string_view> latin = {
+        "the", "café", "naïve", "résumé", "Straße", "über", "façade",
+        "año", "coöperate", "Ångström", "and", "señor", "déjà", "vu"};
+    const std::vector<std::string_view> korean = {"한국어", "안녕", "하세요",
+                                                  "문자", "정규화", "각"};
+    const std::vector<std::string_view> plain = {"the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog"};
+
+    struct input {
+        const char* name;
+        std::string data;
+    };
+    const std::string latin_nfc = text(bytes, latin, 1);
+    const input inputs[] = {
+        {"ascii", text(bytes, plain, 2)},
+        {"latin nfc", latin_nfc},
+        {"latin nfd", unicode::to_nfd.into<std::string>(latin_nfc)},
+        {"korean", text(bytes, korean, 3)},
+    };
+
+    bool ok = true;
+    for (const input& in : inputs) {
+        const std::string nfc = unicode::to_nfc.into<std::string>(in.data);
+        const std::string nfd = unicode::to_nfd.into<std::string>(in.data);
+        ok &= unicode::is_nfc(nfc) && unicode::is_nfd(nfd);
+        ok &= unicode::to_nfc.into<std::string>(nfd) == nfc && unicode::to_nfd.into<std::string>(nfc) == nfd;
+
+        std::vector<u8fstring<256>> lines;
+        for (std::size_t start = 0; start < in.data.size();) {
+            std::size_t end = in.data.find('\n', start);
+            if (end == std::string::npos) end = in.data.size();
+            lines.emplace_back(std::u8string_view(reinterpret_cast<const char8_t*>(in.data.data()) + start, end - start));
+            start = end + 1;
+        }
+
+        std::printf("%s: %zu bytes, %zu lines\n", in.name, in.data.size(), lines.size());
+        const bench::volume work{.records = lines.size(), .bytes = in.data.size()};
+        bench::run("  is_nfc (nfc text)", work, [&] { return static_cast<std::size_t>(unicode::is_nfc(nfc)); });
+        bench::run("  is_nfd (nfd text)", work, [&] { return static_cast<std::size_t>(unicode::is_nfd(nfd)); });
+        bench::run("  to_nfc (string)", work, [&] { return unicode::to_nfc.into<std::string>(in.data).size(); });
+        bench::run("  to_nfd (string)", work, [&] { return unicode::to_nfd.into<std::string>(in.data).size(); });
+        bench::run("  normalize nfc (fstring lines)", work, [&] {
+            std::size_t total = 0;
+            for (auto line : lines) total += unicode::normalize(line, unicode::normal_form::nfc).written;
+            return total;
+        });
+        bench::run("  normalize nfd (fstring lines)", work, [&] {
+            std::size_t total = 0;
+            for (auto line : lines) total += unicode::normalize(line, unicode::normal_form::nfd).written;
+            return total;
+        });
+        std::printf("\n");
+    }
+
+    if (!ok) std::fprintf(stderr, "MISMATCH: normal forms do not round-trip\n");
+    return ok ? 0 : 1;
+}
@@ -13,7 +13,16 @@
 
 #include "../meta/concepts.hpp"
 #include "../meta/traits.hpp"
+#include "../simd/cstring.hpp"
+#include "../simd/hash.hpp"
+#include "../simd/search.hpp"
+#include "../simd/substring.hpp"
+#include "storage.hpp"
 #include <algorithm>
+#include <compare>
+#include <functional>
+#include <string>
+#include <string_view>
 #include <stdexcept>
 
 namespace zuu {
@@ -38,7 +47,11 @@ public:
     static constexpr size_type npos = static_cast<size_type>(-1);
 
 private:
-    alignas(CharT) CharT data_[Cap + 1]{}; 
+    using storage = storage_policy<CharT, Cap>;
+
+    // Aligned and padded to whole blocks that kernels may load in full; the
+    // bytes past the terminator can be stale and are masked off by them
+    alignas(storage::alignment) CharT data_[storage::length]{};
     size_type size_{};
 
     // Internal helpers
@@ -77,15 +90,8 @@ public:
 
     // From null-terminated string
     constexpr explicit basic_fstring(const_pointer str) noexcept {
-        if (str) {
-            size_type len = 0;
-            while (str[len] != CharT{} && len < Cap) {
-                data_[len] = str[len];
-                ++len;
-            }
-            size_ = len;
-            set_null_terminator();
-        }
+        size_ = simd::copy_cstring(data_, str, Cap);
+        set_null_terminator();
     }
 
     // Fill constructor
@@ -181,6 +187,15 @@ public:
         set_null_terminator();
     }
 
+    // Write directly into the buffer: op(data, count) fills up to `count`
+    // characters and returns the new size (mirrors std::string in C++23)
+    template <typename Operation>
+    constexpr void resize_and_overwrite(size_type count, Operation op) {
+        count = std::min(count, capacity);
+        size_ = std::min(static_cast<size_type>(op(data_, count)), count);
+        set_null_terminator();
+    }
+
     // Append (basic version)
     constexpr basic_fstring& append(const_pointer str, size_type len) noexcept {
         if (str && !full()) {
@@ -208,42 +223,37 @@ public:
 	// ==================== Search Operations ====================
 
 	[[nodiscard]] constexpr size_type find(CharT ch, size_type pos = 0) const noexcept {
-        for (size_type i = pos; i < size_; ++i) {
-            if (data_[i] == ch) return i;
+        if (pos >= size_) return npos;
+
+        size_type found;
+        if constexpr (storage::padded && storage::alignment >= 16) {
+            // Whole-block scan, no tail: the buffer is readable up to the padding
+            found = simd::find_char_padded(data_, size_, ch, pos);
+        } else {
+            found = static_cast<size_type>(simd::find_char(data_ + pos, data_ + size_, ch) - data_);
         }
-        return npos;
+        return found == size_ ? npos : found;
     }
     
     [[nodiscard]] constexpr size_type find(const_pointer str, size_type pos = 0) const noexcept {
         if (!str) return npos;
         
-        size_type str_len = 0;
-        while (str[str_len] != CharT{}) ++str_len;
+        // A needle longer than size() cannot match, so never measure past it
+        const size_type str_len = simd::strnlen(str, size_ + 1);
         
         if (str_len == 0) return pos;
         if (pos + str_len > size_) return npos;
         
-        for (size_type i = pos; i <= size_ - str_len; ++i) {
-            bool match = true;
-            for (size_type j = 0; j < str_len; ++j) {
-                if (data_[i + j] != str[j]) {
-                    match = false;
-                    break;
-                }
-            }
-            if (match) return i;
-        }
-        return npos;
+        const const_pointer found = simd::search(data_ + pos, data_ + size_, str, str_len);
+        return found == data_ + size_ ? npos : static_cast<size_type>(found - data_);
     }
     
     [[nodiscard]] constexpr size_type rfind(CharT ch, size_type pos = npos) const noexcept {
         if (size_ == 0) return npos;
         
-        size_type search_end = (pos >= size_) ? size_ - 1 : pos;
-        for (size_type i = search_end + 1; i > 0; --i) {
-            if (data_[i - 1] == ch) return i - 1;
-        }
-        return npos;
+        const size_type search_end = (pos >= size_) ? size_ : pos + 1;
+        const const_pointer found = simd::rfind_char(data_, data_ + search_end, ch);
+        return found == data_ + search_end ? npos : static_cast<size_type>(found - data_);
     }
     
     [[nodiscard]] constexpr bool contains(CharT ch) const noexcept {
@@ -260,12 +270,8 @@ public:
     
     [[nodiscard]] constexpr bool starts_with(const_pointer str) const noexcept {
         if (!str) return false;
-        size_type i = 0;
-        while (str[i] != CharT{}) {
-            if (i >= size_ || data_[i] != str[i]) return false;
-            ++i;
-        }
-        return true;
+        const size_type str_len = simd::strnlen(str, size_ + 1);
+        return std::basic_string_view<CharT>{data_, size_}.starts_with(std::basic_string_view<CharT>{str, str_len});
     }
     
     [[nodiscard]] constexpr bool ends_with(CharT ch) const noexcept {
@@ -274,15 +280,8 @@ public:
     
     [[nodiscard]] constexpr bool ends_with(const_pointer str) const noexcept {
         if (!str) return false;
-        size_type str_len = 0;
-        while (str[str_len] != CharT{}) ++str_len;
-        
-        if (str_len > size_) return false;
-        
-        for (size_type i = 0; i < str_len; ++i) {
-            if (data_[size_ - str_len + i] != str[i]) return false;
-        }
-        return true;
+        const size_type str_len = simd::strnlen(str, size_ + 1);
+        return std::basic_string_view<CharT>{data_, size_}.ends_with(std::basic_string_view<CharT>{str, str_len});
     }
 
 	// ==================== Substring ====================
@@ -304,10 +303,32 @@ public:
 
     // ==================== Comparison ====================
     
-    [[nodiscard]] constexpr auto operator<=>(const basic_fstring&) const noexcept = default;
+    // Only [0, size()) takes part: bytes past the terminator may be stale
+    [[nodiscard]] constexpr bool operator==(const basic_fstring& rhs) const noexcept {
+        if (size_ != rhs.size_) return false;
+
+        if constexpr (storage::padded && storage::alignment >= 16) {
+            return simd::equal_padded(data_, rhs.data_, size_);
+        } else {
+            return simd::mismatch(data_, rhs.data_, size_) == size_;
+        }
+    }
+
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const basic_fstring& rhs) const noexcept {
+        // Clamping to Cap (a no-op) tells the optimizer how far the kernel can read
+        const int cmp = simd::compare(data_, rhs.data_, std::min(std::min(size_, rhs.size_), size_type{Cap}));
+        if (cmp != 0) return cmp < 0 ? std::strong_ordering::less : std::strong_ordering::greater;
+        return size_ <=> rhs.size_;
+    }
     
     [[nodiscard]] constexpr bool operator==(std::basic_string_view<CharT> sv) const noexcept {
-        return std::basic_string_view<CharT>{data_, size_} == sv;
+        return size_ == sv.size() && simd::mismatch(data_, sv.data(), size_) == size_;
+    }
+
+    // Literals and character arrays (up to the first null)
+    template <size_type N>
+    [[nodiscard]] constexpr bool operator==(const CharT (&str)[N]) const noexcept {
+        return *this == std::basic_string_view<CharT>{str, simd::strnlen(str, N)};
     }
 
     // ==================== Conversions ====================
@@ -322,20 +343,25 @@ public:
 
     // ==================== Concatenation ====================
     
+    // Result capacity follows meta::result_capacity_v (size class, capped)
     template <std::size_t N>
     [[nodiscard]] constexpr auto operator+(const basic_fstring<CharT, N>& rhs) const noexcept {
-        basic_fstring<CharT, Cap + N> result;
-        result.append(data_, size_);
-        result.append(rhs.data(), rhs.size());
-        return result;
+        return concat_impl<meta::result_capacity_v<Cap + N, std::max(Cap, N)>>(rhs.data(), rhs.size());
     }
 
 	template <std::size_t N>
     [[nodiscard]] constexpr auto operator+(const CharT (&rhs)[N]) const noexcept {
-        basic_fstring<CharT, Cap + N> result;
-        result.append(data_, size_);
-        result.append(rhs, N);
-        return result;
+        return concat_impl<meta::result_capacity_v<Cap + N - 1, Cap>>(rhs, N - 1);
+    }
+
+    // Per-call ceiling: str.concat(rhs, meta::capacity_ceiling<64>{})
+    // (the result is never smaller than the larger operand)
+    template <std::size_t N, std::size_t Ceiling>
+    [[nodiscard]] constexpr auto concat(
+        const basic_fstring<CharT, N>& rhs,
+        meta::capacity_ceiling<Ceiling>
+    ) const noexcept {
+        return concat_impl<meta::result_capacity_v<Cap + N, std::max(Cap, N), Ceiling>>(rhs.data(), rhs.size());
     }
 
     template <std::size_t N>
@@ -345,12 +371,21 @@ public:
 
 	template <std::size_t N>
     constexpr basic_fstring& operator+=(const CharT (&rhs)[N]) noexcept {
-        return append(rhs, N);
+        return append(rhs, N - 1);
     }
 
     constexpr basic_fstring& operator+=(CharT ch) noexcept {
         return append(ch);
     }
+
+private:
+    template <std::size_t ResultCap>
+    constexpr basic_fstring<CharT, ResultCap> concat_impl(const_pointer rhs, size_type len) const noexcept {
+        basic_fstring<CharT, ResultCap> result;
+        result.append(data_, size_);
+        result.append(rhs, len);
+        return result;
+    }
 };
 
 // ==================== Deduction Guides ====================
@@ -385,4 +420,13 @@ std::basic_ostream<CharT>& operator<<(
     return os << str.data();
 }
 
-} // namespace zuu
\ No newline at end of file
+} // namespace zuu
+
+// ==================== Hashing ====================
+
+template <zuu::meta::character CharT, std::size_t Cap>
+struct std::hash<zuu::basic_fstring<CharT, Cap>> {
+    [[nodiscard]] constexpr std::size_t operator()(const zuu::basic_fstring<CharT, Cap>& str) const noexcept {
+        return zuu::simd::hash(str.data(), str.size());
+    }
+};
\ No newline at end of file
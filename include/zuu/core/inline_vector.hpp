@@ -0,0 +1,204 @@
+#pragma once
+
+/**
+ * @file zuu/core/inline_vector.hpp
+ * @brief Fixed-capacity vector with uninitialized inline storage
+ * @version 3.0.0
+ *
+ * Design Philosophy:
+ * - Slots are only constructed when an element is added
+ * - Cost scales with size(), not with capacity
+ * - Constexpr-friendly (storage is a union, elements use construct_at)
+ *
+ * Usage:
+ *   inline_vector<fstring<256>, 16> parts;   // no fstring constructed yet
+ *   parts.emplace_back("a", 1);               // constructs exactly one slot
+ */
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+// ==================== Inline Vector ====================
+
+template <typename T, std::size_t N>
+class inline_vector {
+public:
+    // Standard aliases
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    static constexpr size_type capacity = N;
+
+private:
+    // Union members are not initialized unless explicitly constructed
+    union storage {
+        constexpr storage() noexcept {}
+        constexpr ~storage() {}
+        T items[N > 0 ? N : 1];
+    };
+
+    storage storage_;
+    size_type size_{};
+
+    constexpr void destroy_all() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_type i = 0; i < size_; ++i) {
+                std::destroy_at(&storage_.items[i]);
+            }
+        }
+        size_ = 0;
+    }
+
+    // Copy (or move, for an rvalue) other's elements onto the end; size_
+    // counts each one as it is built, so a throw leaves a valid vector
+    template <typename Other>
+    constexpr void append_all(Other&& other) {
+        for (size_type i = 0; i < other.size_; ++i) {
+            if constexpr (std::is_rvalue_reference_v<Other&&>) {
+                std::construct_at(&storage_.items[size_], std::move(other.storage_.items[i]));
+            } else {
+                std::construct_at(&storage_.items[size_], other.storage_.items[i]);
+            }
+            ++size_;
+        }
+    }
+
+public:
+    // ==================== Construction ====================
+
+    constexpr inline_vector() noexcept {}
+
+    constexpr inline_vector(const inline_vector& other)
+        noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        try {
+            append_all(other);
+        } catch (...) {
+            destroy_all();
+            throw;
+        }
+    }
+
+    constexpr inline_vector(inline_vector&& other)
+        noexcept(std::is_nothrow_move_constructible_v<T>) {
+        try {
+            append_all(std::move(other));
+        } catch (...) {
+            destroy_all();
+            throw;
+        }
+    }
+
+    // If an element constructor throws, the elements built so far remain
+    constexpr inline_vector& operator=(const inline_vector& other)
+        noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        if (this != &other) {
+            destroy_all();
+            append_all(other);
+        }
+        return *this;
+    }
+
+    constexpr inline_vector& operator=(inline_vector&& other)
+        noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            destroy_all();
+            append_all(std::move(other));
+        }
+        return *this;
+    }
+
+    constexpr ~inline_vector() { destroy_all(); }
+
+    // ==================== Capacity ====================
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return capacity; }
+    [[nodiscard]] constexpr size_type available() const noexcept { return capacity - size_; }
+    [[nodiscard]] constexpr bool full() const noexcept { return size_ == capacity; }
+
+    // ==================== Element Access ====================
+
+    [[nodiscard]] constexpr reference operator[](size_type pos) noexcept {
+        return storage_.items[pos];
+    }
+
+    [[nodiscard]] constexpr const_reference operator[](size_type pos) const noexcept {
+        return storage_.items[pos];
+    }
+
+    [[nodiscard]] constexpr reference front() noexcept { return storage_.items[0]; }
+    [[nodiscard]] constexpr const_reference front() const noexcept { return storage_.items[0]; }
+    [[nodiscard]] constexpr reference back() noexcept { return storage_.items[size_ - 1]; }
+    [[nodiscard]] constexpr const_reference back() const noexcept { return storage_.items[size_ - 1]; }
+
+    [[nodiscard]] constexpr pointer data() noexcept { return storage_.items; }
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return storage_.items; }
+
+    // ==================== Iterators ====================
+
+    [[nodiscard]] constexpr iterator begin() noexcept { return storage_.items; }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return storage_.items; }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return storage_.items; }
+
+    [[nodiscard]] constexpr iterator end() noexcept { return storage_.items + size_; }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return storage_.items + size_; }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return storage_.items + size_; }
+
+    // ==================== Modifiers ====================
+
+    constexpr void clear() noexcept { destroy_all(); }
+
+    // Construct in place; silently ignored when full (same policy as basic_fstring)
+    template <typename... Args>
+    constexpr void emplace_back(Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        if (!full()) {
+            std::construct_at(&storage_.items[size_], std::forward<Args>(args)...);
+            ++size_;
+        }
+    }
+
+    constexpr void push_back(const T& value)
+        noexcept(std::is_nothrow_copy_constructible_v<T>) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(T&& value)
+        noexcept(std::is_nothrow_move_constructible_v<T>) {
+        emplace_back(std::move(value));
+    }
+
+    constexpr void pop_back() noexcept {
+        if (size_ > 0) {
+            --size_;
+            std::destroy_at(&storage_.items[size_]);
+        }
+    }
+
+    // ==================== Comparison ====================
+
+    [[nodiscard]] friend constexpr bool operator==(
+        const inline_vector& lhs,
+        const inline_vector& rhs
+    ) noexcept {
+        if (lhs.size_ != rhs.size_) return false;
+        for (size_type i = 0; i < lhs.size_; ++i) {
+            if (!(lhs[i] == rhs[i])) return false;
+        }
+        return true;
+    }
+};
+
+} // namespace zuu
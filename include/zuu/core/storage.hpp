@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file zuu/core/storage.hpp
+ * @brief Buffer layout policy for basic_fstring (alignment and tail padding)
+ * @version 3.0.0
+ *
+ * The character buffer is aligned to `alignment` bytes and padded to a
+ * whole number of `alignment`-byte blocks, so every block up to
+ * round_up(size(), alignment) lies inside the object and is safe to load.
+ * Vector kernels therefore load full blocks without a scalar tail. Bytes
+ * past the terminator are readable but not meaningful: pop_back(),
+ * resize() and the like leave old characters there. Kernels mask off the
+ * lanes at or past size() rather than relying on their contents.
+ *
+ * Configure globally with ZUU_FSTRING_STORAGE_ALIGNMENT (bytes, power of
+ * two; 0 keeps natural alignment and disables padding), or specialize
+ * storage_policy for individual string types.
+ *
+ * sizeof(fstring<N>) on 64-bit targets:
+ *
+ *   N       natural (0)   16 (default)   32      64
+ *   8       24            32             64      128
+ *   16      32            48             64      128
+ *   32      48            64             96      128
+ *   64      80            96             128     192
+ *   256     272           288            320     384
+ *   1024    1040          1056           1088    1152
+ */
+
+#include "../meta/concepts.hpp"
+#include <cstddef>
+
+#ifndef ZUU_FSTRING_STORAGE_ALIGNMENT
+#define ZUU_FSTRING_STORAGE_ALIGNMENT 16
+#endif
+
+namespace zuu {
+
+template <meta::character CharT, std::size_t Cap>
+struct storage_policy {
+    static_assert((ZUU_FSTRING_STORAGE_ALIGNMENT & (ZUU_FSTRING_STORAGE_ALIGNMENT - 1)) == 0,
+                  "ZUU_FSTRING_STORAGE_ALIGNMENT must be 0 or a power of two");
+
+    // Alignment of the buffer in bytes
+    static constexpr std::size_t alignment =
+        ZUU_FSTRING_STORAGE_ALIGNMENT > alignof(CharT) ? ZUU_FSTRING_STORAGE_ALIGNMENT : alignof(CharT);
+
+    // Buffer length in characters: Cap + terminator, rounded up to whole blocks
+    static constexpr std::size_t length =
+        ((Cap + 1) * sizeof(CharT) + alignment - 1) / alignment * alignment / sizeof(CharT);
+
+    // True when kernels may read whole `alignment`-byte blocks past size()
+    static constexpr bool padded = alignment > alignof(CharT);
+};
+
+} // namespace zuu
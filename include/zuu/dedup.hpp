@@ -0,0 +1,33 @@
+#pragma once
+
+/**
+ * @file zuu/dedup.hpp
+ * @brief Near-duplicate detection over fstring documents
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: rolling-hash shingles, MinHash
+ * signatures and SimHash fingerprints, and LSH banding indexes that find
+ * the earlier documents a new one nearly duplicates. Hashing is
+ * allocation-free; the indexes allocate as they grow.
+ *
+ * @code
+ * #include <zuu/dedup.hpp>
+ * using namespace zuu;
+ *
+ * dedup::minhasher<128> minhash;
+ * dedup::minhash_lsh<128> seen(16);
+ * for (const msg_str& msg : stream) {
+ *     const auto sig = minhash(msg);
+ *     if (seen.query(sig, 0.8).empty()) forward(msg);
+ *     seen.insert(sig);
+ * }
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "rolling/hash.hpp"
+#include "dedup/shingle.hpp"
+#include "dedup/minhash.hpp"
+#include "dedup/simhash.hpp"
+#include "dedup/lsh.hpp"
@@ -0,0 +1,244 @@
+#pragma once
+
+/**
+ * @file zuu/dedup/lsh.hpp
+ * @brief LSH banding indexes for near-duplicate candidate lookup
+ * @version 3.0.0
+ *
+ * A signature is cut into bands and each band is hashed to a bucket key;
+ * documents sharing any bucket are candidates. Inserts are incremental, so
+ * a stream can be checked against everything seen so far, document by
+ * document.
+ *
+ *   minhash_lsh    b bands of r = N / b rows. A pair with Jaccard s shares
+ *                  a band with probability 1 - (1 - s^r)^b, an S-curve
+ *                  that rises around threshold() = (1 / b)^(1 / r).
+ *   simhash_index  k + 1 bands of the 64-bit fingerprint. Fingerprints at
+ *                  most k bits apart agree on at least one band
+ *                  (pigeonhole), so the lookup finds all of them, exactly.
+ *
+ * Buckets are one open-addressing table of distinct keys, each heading a
+ * chain of ids in one shared array, rather than a container per bucket:
+ * an insert is a few stores, not an allocation, and does not slow down as
+ * a bucket fills with exact duplicates.
+ *
+ * Usage:
+ *   dedup::minhasher<128> minhash;
+ *   dedup::minhash_lsh<128> index(16);              // 16 bands of 8 rows
+ *   auto sig = minhash(msg);
+ *   auto similar = index.query(sig, 0.8);           // ids, estimated J >= 0.8
+ *   index.insert(sig);
+ *
+ *   dedup::simhash_index fingerprints(3);           // Hamming distance <= 3
+ */
+
+#include "minhash.hpp"
+#include "simhash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace zuu::dedup {
+
+namespace detail {
+
+/**
+ * @brief Multimap from 64-bit keys to 32-bit ids: linear probing over the
+ *        distinct keys (kept at most half full), ids chained per key
+ */
+class bucket_table {
+public:
+    void insert(std::uint64_t key, std::uint32_t id) {
+        if (2 * (keys_ + 1) > slots_.size()) grow();
+        slot& s = slots_[find(key)];
+        if (s.head == empty) {
+            s.key = key;
+            ++keys_;
+        }
+        entries_.push_back({id, s.head});
+        s.head = static_cast<std::uint32_t>(entries_.size() - 1);
+    }
+
+    // Call fn(id) for every id filed under `key`, most recent first
+    template <typename Fn>
+    void for_each(std::uint64_t key, Fn&& fn) const {
+        if (slots_.empty()) return;
+        for (std::uint32_t e = slots_[find(key)].head; e != empty; e = entries_[e].next) fn(entries_[e].id);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+
+    void clear() noexcept {
+        slots_.clear();
+        entries_.clear();
+        keys_ = 0;
+    }
+
+private:
+    static constexpr std::uint32_t empty = ~std::uint32_t{0};
+
+    struct slot {
+        std::uint64_t key = 0;
+        std::uint32_t head = empty;  // newest entry filed under key
+    };
+
+    struct entry {
+        std::uint32_t id;
+        std::uint32_t next;  // older entry under the same key, or empty
+    };
+
+    // Slot holding `key`, or the empty slot where it would go
+    [[nodiscard]] std::size_t find(std::uint64_t key) const noexcept {
+        std::size_t i = static_cast<std::size_t>(rolling::detail::mix64(key)) & (slots_.size() - 1);
+        while (slots_[i].head != empty && slots_[i].key != key) i = (i + 1) & (slots_.size() - 1);
+        return i;
+    }
+
+    void grow() {
+        std::vector<slot> old(std::max<std::size_t>(slots_.size() * 2, 64));
+        old.swap(slots_);
+        for (const slot& s : old) {
+            if (s.head != empty) slots_[find(s.key)] = s;
+        }
+    }
+
+    std::vector<slot> slots_;
+    std::vector<entry> entries_;
+    std::size_t keys_ = 0;
+};
+
+// Key of band `band` whose content hashes to `h`; equal content in
+// different bands gets different keys
+constexpr std::uint64_t band_key(std::size_t band, std::uint64_t h) noexcept {
+    return rolling::detail::mix64(h ^ (static_cast<std::uint64_t>(band) * 0x9E3779B97F4A7C15ull));
+}
+
+inline void sort_unique(std::vector<std::uint32_t>& ids) {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+} // namespace detail
+
+// ==================== MinHash LSH ====================
+
+template <std::size_t N = 128>
+class minhash_lsh {
+public:
+    using signature_type = minhash_signature<N>;
+
+    /**
+     * @brief Index with `bands` bands (rounded down to a divisor of N) of
+     *        N / bands rows
+     */
+    explicit minhash_lsh(std::size_t bands = 16) noexcept
+        : bands_{std::clamp<std::size_t>(bands, 1, N)} {
+        while (N % bands_ != 0) --bands_;
+    }
+
+    // Add a signature; ids are assigned in insertion order from 0
+    std::uint32_t insert(const signature_type& signature) {
+        const auto id = static_cast<std::uint32_t>(signatures_.size());
+        signatures_.push_back(signature);
+        for (std::size_t band = 0; band < bands_; ++band) buckets_.insert(key_of(signature, band), id);
+        return id;
+    }
+
+    // Ids sharing at least one band with `signature`, ascending (out is cleared first)
+    void candidates(const signature_type& signature, std::vector<std::uint32_t>& out) const {
+        out.clear();
+        for (std::size_t band = 0; band < bands_; ++band) {
+            buckets_.for_each(key_of(signature, band), [&out](std::uint32_t id) { out.push_back(id); });
+        }
+        detail::sort_unique(out);
+    }
+
+    // Candidates whose estimated Jaccard similarity is at least `threshold`
+    void query(const signature_type& signature, double threshold, std::vector<std::uint32_t>& out) const {
+        candidates(signature, out);
+        std::erase_if(out, [&](std::uint32_t id) { return estimate_jaccard(signature, signatures_[id]) < threshold; });
+    }
+
+    [[nodiscard]] std::vector<std::uint32_t> query(const signature_type& signature, double threshold) const {
+        std::vector<std::uint32_t> out;
+        query(signature, threshold, out);
+        return out;
+    }
+
+    [[nodiscard]] const signature_type& signature(std::uint32_t id) const noexcept { return signatures_[id]; }
+    [[nodiscard]] std::size_t size() const noexcept { return signatures_.size(); }
+    [[nodiscard]] std::size_t bands() const noexcept { return bands_; }
+    [[nodiscard]] std::size_t rows() const noexcept { return N / bands_; }
+
+    // Similarity at which a pair becomes more likely than not to be a candidate (approximately)
+    [[nodiscard]] double threshold() const noexcept {
+        return std::pow(1.0 / static_cast<double>(bands_), 1.0 / static_cast<double>(rows()));
+    }
+
+private:
+    [[nodiscard]] std::uint64_t key_of(const signature_type& signature, std::size_t band) const noexcept {
+        std::uint64_t h = 0;
+        const std::size_t r = rows();
+        for (std::size_t i = band * r; i < (band + 1) * r; ++i) h = rolling::detail::mix64(h ^ signature[i]);
+        return detail::band_key(band, h);
+    }
+
+    std::size_t bands_;
+    std::vector<signature_type> signatures_;
+    detail::bucket_table buckets_;
+};
+
+// ==================== SimHash Index ====================
+
+class simhash_index {
+public:
+    // Index answering "all fingerprints within `max_distance` bits" (at most 63)
+    explicit simhash_index(std::size_t max_distance = 3) noexcept
+        : max_distance_{std::min<std::size_t>(max_distance, 63)} {}
+
+    std::uint32_t insert(std::uint64_t fingerprint) {
+        const auto id = static_cast<std::uint32_t>(fingerprints_.size());
+        fingerprints_.push_back(fingerprint);
+        for (std::size_t band = 0; band <= max_distance_; ++band) buckets_.insert(key_of(fingerprint, band), id);
+        return id;
+    }
+
+    // Every id within max_distance() of `fingerprint`, ascending (out is cleared first)
+    void query(std::uint64_t fingerprint, std::vector<std::uint32_t>& out) const {
+        out.clear();
+        for (std::size_t band = 0; band <= max_distance_; ++band) {
+            buckets_.for_each(key_of(fingerprint, band), [&](std::uint32_t id) {
+                if (hamming_distance(fingerprint, fingerprints_[id]) <= max_distance_) out.push_back(id);
+            });
+        }
+        detail::sort_unique(out);
+    }
+
+    [[nodiscard]] std::vector<std::uint32_t> query(std::uint64_t fingerprint) const {
+        std::vector<std::uint32_t> out;
+        query(fingerprint, out);
+        return out;
+    }
+
+    [[nodiscard]] std::uint64_t fingerprint(std::uint32_t id) const noexcept { return fingerprints_[id]; }
+    [[nodiscard]] std::size_t size() const noexcept { return fingerprints_.size(); }
+    [[nodiscard]] std::size_t max_distance() const noexcept { return max_distance_; }
+
+private:
+    // Band i covers bits [64 i / b, 64 (i + 1) / b) of b = max_distance + 1
+    [[nodiscard]] std::uint64_t key_of(std::uint64_t fingerprint, std::size_t band) const noexcept {
+        const std::size_t count = max_distance_ + 1;
+        const std::size_t lo = 64 * band / count;
+        const std::size_t width = 64 * (band + 1) / count - lo;
+        const std::uint64_t mask = width == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+        return detail::band_key(band, (fingerprint >> lo) & mask);
+    }
+
+    std::size_t max_distance_;
+    std::vector<std::uint64_t> fingerprints_;
+    detail::bucket_table buckets_;
+};
+
+} // namespace zuu::dedup
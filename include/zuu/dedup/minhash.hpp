@@ -0,0 +1,199 @@
+#pragma once
+
+/**
+ * @file zuu/dedup/minhash.hpp
+ * @brief MinHash signatures, with the hash functions evaluated in vector lanes
+ * @version 3.0.0
+ *
+ * Signature row i is the minimum of h_i over the document's shingles, and
+ * two signatures agree in a row with probability equal to the Jaccard
+ * similarity of the shingle sets, so the fraction of equal rows estimates
+ * it (standard error about 1 / sqrt(N)).
+ *
+ * h_i(x) = xorshift(a_i * x + b_i) over 32 bits, with a_i odd: a
+ * permutation of the 32-bit shingle hash per row. All N functions of one
+ * shingle are computed side by side, 8 rows per AVX2 register or 4 per
+ * SSE2 register (32-bit multiply and unsigned minimum are emulated there),
+ * with the running minima kept in registers across a batch of shingles.
+ *
+ * Usage:
+ *   dedup::minhasher<128> minhash;               // 5-unit shingles
+ *   auto a = minhash(doc_a), b = minhash(doc_b); // std::array<uint32_t, 128>
+ *   double j = dedup::estimate_jaccard(a, b);
+ */
+
+#include "../simd/config.hpp"
+#include "shingle.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace zuu::dedup {
+
+template <std::size_t N>
+using minhash_signature = std::array<std::uint32_t, N>;
+
+namespace detail {
+
+inline constexpr std::size_t minhash_batch = 256;  // shingles per pass over the rows
+
+constexpr std::uint32_t fold32(std::uint64_t h) noexcept {
+    return static_cast<std::uint32_t>(h ^ (h >> 32));
+}
+
+constexpr std::uint32_t permute32(std::uint32_t mul, std::uint32_t add, std::uint32_t x) noexcept {
+    const std::uint32_t h = mul * x + add;
+    return h ^ (h >> 15);
+}
+
+inline void minhash_rows_scalar(std::uint32_t* mins, const std::uint32_t* mul, const std::uint32_t* add,
+                                std::size_t rows, const std::uint32_t* xs, std::size_t count) noexcept {
+    for (std::size_t s = 0; s < count; ++s) {
+        for (std::size_t i = 0; i < rows; ++i) {
+            const std::uint32_t h = permute32(mul[i], add[i], xs[s]);
+            mins[i] = h < mins[i] ? h : mins[i];
+        }
+    }
+}
+
+#if defined(ZUU_SIMD_AVX2)
+
+// 16 rows (two registers) per pass over the batch
+inline void minhash_rows(std::uint32_t* mins, const std::uint32_t* mul, const std::uint32_t* add,
+                         std::size_t rows, const std::uint32_t* xs, std::size_t count) noexcept {
+    auto load = [](const std::uint32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); };
+    auto permute = [](__m256i m, __m256i a, __m256i x) {
+        const __m256i h = _mm256_add_epi32(_mm256_mullo_epi32(m, x), a);
+        return _mm256_xor_si256(h, _mm256_srli_epi32(h, 15));
+    };
+
+    std::size_t i = 0;
+    for (; i + 16 <= rows; i += 16) {
+        const __m256i m0 = load(mul + i), m1 = load(mul + i + 8);
+        const __m256i a0 = load(add + i), a1 = load(add + i + 8);
+        __m256i lo = load(mins + i), hi = load(mins + i + 8);
+        for (std::size_t s = 0; s < count; ++s) {
+            const __m256i x = _mm256_set1_epi32(static_cast<int>(xs[s]));
+            lo = _mm256_min_epu32(lo, permute(m0, a0, x));
+            hi = _mm256_min_epu32(hi, permute(m1, a1, x));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mins + i), lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mins + i + 8), hi);
+    }
+    minhash_rows_scalar(mins + i, mul + i, add + i, rows - i, xs, count);
+}
+
+#elif defined(ZUU_SIMD_SSE2)
+
+// Low 32 bits of each 32x32-bit lane product (SSE4.1 has _mm_mullo_epi32)
+inline __m128i mullo32(__m128i a, __m128i b) noexcept {
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// 8 rows (two registers) per pass. Minima are kept with the sign bit
+// flipped so the signed compare orders them as unsigned values.
+inline void minhash_rows(std::uint32_t* mins, const std::uint32_t* mul, const std::uint32_t* add,
+                         std::size_t rows, const std::uint32_t* xs, std::size_t count) noexcept {
+    auto load = [](const std::uint32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); };
+    const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    auto step = [sign](__m128i biased_min, __m128i m, __m128i a, __m128i x) {
+        __m128i h = _mm_add_epi32(mullo32(m, x), a);
+        h = _mm_xor_si128(_mm_xor_si128(h, _mm_srli_epi32(h, 15)), sign);
+        const __m128i greater = _mm_cmpgt_epi32(biased_min, h);
+        return _mm_or_si128(_mm_and_si128(greater, h), _mm_andnot_si128(greater, biased_min));
+    };
+
+    std::size_t i = 0;
+    for (; i + 8 <= rows; i += 8) {
+        const __m128i m0 = load(mul + i), m1 = load(mul + i + 4);
+        const __m128i a0 = load(add + i), a1 = load(add + i + 4);
+        __m128i lo = _mm_xor_si128(load(mins + i), sign);
+        __m128i hi = _mm_xor_si128(load(mins + i + 4), sign);
+        for (std::size_t s = 0; s < count; ++s) {
+            const __m128i x = _mm_set1_epi32(static_cast<int>(xs[s]));
+            lo = step(lo, m0, a0, x);
+            hi = step(hi, m1, a1, x);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mins + i), _mm_xor_si128(lo, sign));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mins + i + 4), _mm_xor_si128(hi, sign));
+    }
+    minhash_rows_scalar(mins + i, mul + i, add + i, rows - i, xs, count);
+}
+
+#else
+
+inline void minhash_rows(std::uint32_t* mins, const std::uint32_t* mul, const std::uint32_t* add,
+                         std::size_t rows, const std::uint32_t* xs, std::size_t count) noexcept {
+    minhash_rows_scalar(mins, mul, add, rows, xs, count);
+}
+
+#endif
+
+} // namespace detail
+
+/**
+ * @brief N-row MinHash over k-unit shingles
+ *
+ * The row functions come from `seed`; only signatures made with the same
+ * seed and shingle size are comparable.
+ */
+template <std::size_t N = 128>
+class minhasher {
+    static_assert(N > 0, "a signature needs at least one row");
+
+public:
+    using signature_type = minhash_signature<N>;
+
+    static constexpr std::size_t rows = N;
+    static constexpr std::uint64_t default_seed = 0x6D696E68617368ull;
+
+    explicit minhasher(std::size_t shingle = default_shingle, std::uint64_t seed = default_seed) noexcept
+        : shingles_{shingle} {
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::uint64_t r = rolling::detail::mix64(seed + (i + 1) * 0x9E3779B97F4A7C15ull);
+            mul_[i] = static_cast<std::uint32_t>(r) | 1;
+            add_[i] = static_cast<std::uint32_t>(r >> 32);
+        }
+    }
+
+    [[nodiscard]] std::size_t shingle_size() const noexcept { return shingles_.size(); }
+
+    // Signature of `text` (every row 0xFFFFFFFF for an empty text)
+    template <meta::string_like Str>
+    [[nodiscard]] signature_type operator()(const Str& text) const noexcept {
+        signature_type mins;
+        mins.fill(~std::uint32_t{0});
+
+        std::uint32_t batch[detail::minhash_batch];
+        std::size_t count = 0;
+        shingles_(text, [&](std::uint64_t h) {
+            batch[count++] = detail::fold32(h);
+            if (count == detail::minhash_batch) {
+                detail::minhash_rows(mins.data(), mul_.data(), add_.data(), N, batch, count);
+                count = 0;
+            }
+        });
+        if (count != 0) detail::minhash_rows(mins.data(), mul_.data(), add_.data(), N, batch, count);
+        return mins;
+    }
+
+private:
+    shingler shingles_;
+    std::array<std::uint32_t, N> mul_;
+    std::array<std::uint32_t, N> add_;
+};
+
+/**
+ * @brief Fraction of equal rows: the estimated Jaccard similarity
+ */
+template <std::size_t N>
+[[nodiscard]] constexpr double estimate_jaccard(const minhash_signature<N>& a, const minhash_signature<N>& b) noexcept {
+    std::size_t equal = 0;
+    for (std::size_t i = 0; i < N; ++i) equal += a[i] == b[i];
+    return static_cast<double>(equal) / static_cast<double>(N);
+}
+
+} // namespace zuu::dedup
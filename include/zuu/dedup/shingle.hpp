@@ -0,0 +1,54 @@
+#pragma once
+
+/**
+ * @file zuu/dedup/shingle.hpp
+ * @brief Character shingles of a document, hashed with a rolling hash
+ * @version 3.0.0
+ *
+ * A document is modelled as the set of its k-unit substrings (shingles);
+ * two documents with similar shingle sets are near-duplicates. Shingles
+ * are never materialized: the Rabin-Karp window of rolling/hash.hpp slides
+ * over the text and each window hash is avalanched to 64 well-mixed bits
+ * for MinHash and SimHash. A text shorter than k is one shingle; an empty
+ * text has none.
+ *
+ * Usage:
+ *   dedup::shingler shingles(5);
+ *   shingles(doc, [&](std::uint64_t h) { ... });
+ */
+
+#include "../meta/concepts.hpp"
+#include "../rolling/hash.hpp"
+#include "../str/policy.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace zuu::dedup {
+
+inline constexpr std::size_t default_shingle = 5;  // code units per shingle
+
+class shingler {
+public:
+    constexpr explicit shingler(std::size_t k = default_shingle) noexcept
+        : roller_{k} {}
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return roller_.window(); }
+
+    // Call fn(hash) for every shingle of `text`, left to right
+    template <meta::string_like Str, typename Fn>
+    constexpr void operator()(const Str& text, Fn&& fn) const {
+        const auto view = str::as_view(text);
+        if (view.empty()) return;
+        if (view.size() < roller_.window()) {
+            fn(rolling::detail::mix64(roller_.hash(view.data(), view.size())));
+            return;
+        }
+        roller_.for_each(view.data(), view.size(),
+                         [&fn](std::size_t, std::uint64_t h) { fn(rolling::detail::mix64(h)); });
+    }
+
+private:
+    rolling::rabin_karp roller_;
+};
+
+} // namespace zuu::dedup
@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file zuu/dedup/simhash.hpp
+ * @brief 64-bit SimHash fingerprints
+ * @version 3.0.0
+ *
+ * Every shingle votes on each of the 64 bits (+1 where its hash has the
+ * bit set, -1 where not) and the fingerprint keeps the bits with a
+ * positive total. Similar documents get fingerprints a small Hamming
+ * distance apart; unlike a MinHash signature the fingerprint is one word,
+ * which makes it the cheaper choice to store for large streams.
+ *
+ * Votes are counted eight bits per word: each hash byte is spread to one
+ * 0/1 byte per bit through a 256-entry table and added to byte counters,
+ * which are flushed to full-width totals every 255 shingles.
+ *
+ * Usage:
+ *   dedup::simhasher simhash;
+ *   if (dedup::hamming_distance(simhash(a), simhash(b)) <= 3) { ... }
+ */
+
+#include "shingle.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace zuu::dedup {
+
+namespace detail {
+
+// Byte i of spread_bits[b] is bit i of b
+inline constexpr auto spread_bits = [] {
+    std::array<std::uint64_t, 256> table{};
+    for (std::size_t b = 0; b < 256; ++b) {
+        for (std::size_t i = 0; i < 8; ++i) table[b] |= static_cast<std::uint64_t>((b >> i) & 1) << (8 * i);
+    }
+    return table;
+}();
+
+} // namespace detail
+
+class simhasher {
+public:
+    constexpr explicit simhasher(std::size_t shingle = default_shingle) noexcept
+        : shingles_{shingle} {}
+
+    [[nodiscard]] constexpr std::size_t shingle_size() const noexcept { return shingles_.size(); }
+
+    // Fingerprint of `text` (0 for an empty text)
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr std::uint64_t operator()(const Str& text) const noexcept {
+        std::uint64_t packed[8] = {};  // set-bit counts, bit 8k + i in byte i of packed[k]
+        std::uint32_t ones[64] = {};
+        std::uint32_t total = 0;
+        std::uint32_t pending = 0;
+
+        auto flush = [&] {
+            for (std::size_t k = 0; k < 8; ++k) {
+                for (std::size_t i = 0; i < 8; ++i) ones[8 * k + i] += (packed[k] >> (8 * i)) & 0xFF;
+                packed[k] = 0;
+            }
+            pending = 0;
+        };
+
+        shingles_(text, [&](std::uint64_t h) {
+            for (std::size_t k = 0; k < 8; ++k) packed[k] += detail::spread_bits[(h >> (8 * k)) & 0xFF];
+            ++total;
+            if (++pending == 255) flush();
+        });
+        flush();
+
+        std::uint64_t fingerprint = 0;
+        for (std::size_t bit = 0; bit < 64; ++bit) {
+            fingerprint |= static_cast<std::uint64_t>(2 * ones[bit] > total) << bit;
+        }
+        return fingerprint;
+    }
+
+private:
+    shingler shingles_;
+};
+
+[[nodiscard]] constexpr std::size_t hamming_distance(std::uint64_t a, std::uint64_t b) noexcept {
+    return static_cast<std::size_t>(std::popcount(a ^ b));
+}
+
+} // namespace zuu::dedup
@@ -65,14 +65,22 @@ namespace zuu {
 
 // Core storage
 #include "core/core.hpp"
+#include "core/inline_vector.hpp"
+#include "core/storage.hpp"
 #include "core/literals.hpp"
 
 // String algorithms (pipeable)
 #include "str/pipe.hpp"
+#include "str/policy.hpp"
 #include "str/trim.hpp"
 #include "str/case.hpp"
 #include "str/split.hpp"
 #include "str/find.hpp"
+#include "str/glob.hpp"
+#include "str/natural.hpp"
+#include "str/profile.hpp"
+#include "str/reverse.hpp"
+#include "str/stats.hpp"
 
 // Formatting system
 #include "fmt/core.hpp"
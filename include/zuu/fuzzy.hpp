@@ -0,0 +1,34 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy.hpp
+ * @brief Approximate string matching over fstring vocabularies
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: bit-parallel edit distance and fuzzy
+ * dictionary indexes (SymSpell and BK-tree) for autocorrect-style lookups.
+ * Unlike the core library these allocate: dictionaries are built once and
+ * then queried.
+ *
+ * @code
+ * #include <zuu/fuzzy.hpp>
+ * using namespace zuu;
+ *
+ * fuzzy::symspell_index index({.max_distance = 2});
+ * for (const name_str& name : names) index.add(name);
+ * index.build();
+ *
+ * for (const auto& m : index.lookup("jonh", 2, 5)) {
+ *     std::printf("%.*s (distance %zu)\n", int(m.term.size()), m.term.data(), m.distance);
+ * }
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "fuzzy/distance.hpp"
+#include "fuzzy/arena.hpp"
+#include "fuzzy/match.hpp"
+#include "fuzzy/symspell.hpp"
+#include "fuzzy/bk_tree.hpp"
+#include "fuzzy/similarity.hpp"
@@ -0,0 +1,111 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/arena.hpp
+ * @brief Append-only storage for dictionary keys
+ * @version 3.0.0
+ *
+ * A dictionary of a million name_str entries would spend 64 MB on fixed
+ * capacity alone; the arena packs the characters back to back in large
+ * chunks instead, so memory follows the text actually stored. Chunks are
+ * never moved or freed before the arena itself, so every view it hands out
+ * stays valid for the arena's lifetime (including across moves).
+ *
+ * Usage:
+ *   fuzzy::string_arena arena;
+ *   std::string_view key = arena.store(name);   // copied once, stable view
+ */
+
+#include "../meta/concepts.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+template <meta::character CharT>
+class basic_string_arena {
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    static constexpr std::size_t default_chunk = 64 * 1024;  // code units
+
+    explicit basic_string_arena(std::size_t chunk_units = default_chunk) noexcept
+        : chunk_units_{std::max<std::size_t>(chunk_units, 1)} {}
+
+    basic_string_arena(basic_string_arena&& other) noexcept
+        : chunks_{std::move(other.chunks_)},
+          current_{std::exchange(other.current_, nullptr)},
+          chunk_units_{other.chunk_units_},
+          used_{std::exchange(other.used_, 0)},
+          stored_{std::exchange(other.stored_, 0)} {}
+
+    basic_string_arena& operator=(basic_string_arena&& other) noexcept {
+        if (this != &other) {
+            chunks_ = std::move(other.chunks_);
+            current_ = std::exchange(other.current_, nullptr);
+            chunk_units_ = other.chunk_units_;
+            used_ = std::exchange(other.used_, 0);
+            stored_ = std::exchange(other.stored_, 0);
+        }
+        return *this;
+    }
+
+    basic_string_arena(const basic_string_arena&) = delete;
+    basic_string_arena& operator=(const basic_string_arena&) = delete;
+
+    /**
+     * @brief Copy `text` into the arena and return a view of the copy
+     *
+     * Text longer than a chunk gets a chunk of its own.
+     */
+    view_type store(view_type text) {
+        if (text.empty()) return {};
+        stored_ += text.size();
+
+        if (text.size() > chunk_units_) {
+            // A chunk of its own; the current chunk keeps filling
+            chunks_.push_back(std::make_unique_for_overwrite<CharT[]>(text.size()));
+            std::copy_n(text.data(), text.size(), chunks_.back().get());
+            return {chunks_.back().get(), text.size()};
+        }
+
+        if (current_ == nullptr || text.size() > chunk_units_ - used_) {
+            chunks_.push_back(std::make_unique_for_overwrite<CharT[]>(chunk_units_));
+            current_ = chunks_.back().get();
+            used_ = 0;
+        }
+        CharT* dest = current_ + used_;
+        std::copy_n(text.data(), text.size(), dest);
+        used_ += text.size();
+        return {dest, text.size()};
+    }
+
+    // Code units stored, and chunks allocated for them
+    [[nodiscard]] std::size_t size() const noexcept { return stored_; }
+    [[nodiscard]] std::size_t chunk_count() const noexcept { return chunks_.size(); }
+
+    void clear() noexcept {
+        chunks_.clear();
+        current_ = nullptr;
+        used_ = 0;
+        stored_ = 0;
+    }
+
+private:
+    std::vector<std::unique_ptr<CharT[]>> chunks_;
+    CharT* current_ = nullptr;  // chunk being filled
+    std::size_t chunk_units_;
+    std::size_t used_ = 0;
+    std::size_t stored_ = 0;
+};
+
+using string_arena = basic_string_arena<char>;
+using wstring_arena = basic_string_arena<wchar_t>;
+using u16string_arena = basic_string_arena<char16_t>;
+using u32string_arena = basic_string_arena<char32_t>;
+
+} // namespace zuu::fuzzy
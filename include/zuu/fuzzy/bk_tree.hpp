@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/bk_tree.hpp
+ * @brief BK-tree over edit distance for fuzzy dictionary lookup
+ * @version 3.0.0
+ *
+ * Each child hangs off its parent by its distance to the parent; by the
+ * triangle inequality, a query at distance d from a node can only match
+ * in children whose edge lies in [d - limit, d + limit]. Compared to
+ * symspell.hpp it needs far less memory (one node per term, no deletion
+ * postings) and supports any distance, at the price of more distance
+ * computations per lookup, each done bit-parallel.
+ *
+ * Nodes live in one vector (children as sibling lists of indices) and
+ * terms in an arena.
+ *
+ * Usage:
+ *   fuzzy::bk_tree tree;
+ *   for (const auto& word : words) tree.add(word);
+ *   auto best = tree.lookup("recieve", 2, 3);   // up to 3 matches, d <= 2
+ */
+
+#include "arena.hpp"
+#include "distance.hpp"
+#include "match.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+template <meta::character CharT>
+class basic_bk_tree {
+public:
+    using view_type = std::basic_string_view<CharT>;
+    using match_type = basic_fuzzy_match<CharT>;
+
+    // Add a term; adding it again adds to its frequency
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    void add(const Str& term, std::uint64_t frequency = 1) {
+        const view_type t = detail::text_view(term);
+        if (nodes_.empty()) {
+            nodes_.push_back({arena_.store(t), frequency});
+            return;
+        }
+
+        const basic_levenshtein_pattern<CharT> pattern(t);
+        std::uint32_t at = 0;
+        for (;;) {
+            const auto d = static_cast<std::uint32_t>(pattern.distance(nodes_[at].term));
+            if (d == 0) {
+                nodes_[at].frequency += frequency;
+                return;
+            }
+            std::uint32_t child = nodes_[at].first_child;
+            while (child != none && nodes_[child].edge != d) child = nodes_[child].next_sibling;
+            if (child == none) {
+                const auto added = static_cast<std::uint32_t>(nodes_.size());
+                nodes_.push_back({arena_.store(t), frequency, none, nodes_[at].first_child, d});
+                nodes_[at].first_child = added;
+                return;
+            }
+            at = child;
+        }
+    }
+
+    // Up to k terms within `max_distance` of `query`, best first
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] std::vector<match_type> lookup(const Str& query, std::size_t max_distance, std::size_t k = 1) const {
+        std::vector<match_type> out;
+        std::vector<std::uint32_t> stack;
+        lookup(query, max_distance, k, out, stack);
+        return out;
+    }
+
+    // As above, reusing the caller's buffers (out is cleared first)
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    void lookup(const Str& query, std::size_t max_distance, std::size_t k, std::vector<match_type>& out,
+                std::vector<std::uint32_t>& stack) const {
+        detail::top_k<CharT> best(out, k, max_distance);
+        stack.clear();
+        if (nodes_.empty() || k == 0) return;
+
+        const basic_levenshtein_pattern<CharT> pattern(detail::text_view(query));
+        stack.push_back(0);
+        while (!stack.empty()) {
+            const node& n = nodes_[stack.back()];
+            stack.pop_back();
+
+            // The exact distance is needed to pick children, not just a bound
+            const std::size_t d = pattern.distance(n.term);
+            const std::size_t limit = best.limit();
+            if (d <= limit) best.offer({n.term, d, n.frequency});
+
+            const std::size_t low = d > limit ? d - limit : 0;
+            const std::size_t high = d + limit;
+            for (std::uint32_t child = n.first_child; child != none; child = nodes_[child].next_sibling) {
+                if (nodes_[child].edge >= low && nodes_[child].edge <= high) stack.push_back(child);
+            }
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return nodes_.size(); }
+
+private:
+    static constexpr std::uint32_t none = static_cast<std::uint32_t>(-1);
+
+    struct node {
+        view_type term;
+        std::uint64_t frequency = 0;
+        std::uint32_t first_child = none;
+        std::uint32_t next_sibling = none;
+        std::uint32_t edge = 0;  // distance to the parent
+    };
+
+    basic_string_arena<CharT> arena_;
+    std::vector<node> nodes_;
+};
+
+using bk_tree = basic_bk_tree<char>;
+using wbk_tree = basic_bk_tree<wchar_t>;
+using u16bk_tree = basic_bk_tree<char16_t>;
+using u32bk_tree = basic_bk_tree<char32_t>;
+
+} // namespace zuu::fuzzy
@@ -0,0 +1,241 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/distance.hpp
+ * @brief Bit-parallel Levenshtein distance (Myers / Hyyrö)
+ * @version 3.0.0
+ *
+ * One 64-bit word holds a whole column of the DP matrix for patterns up to
+ * 64 code units, so a comparison costs O(text length) word operations
+ * instead of O(m * n) cells. The pattern's match masks are built once and
+ * reused across candidates, which is what dictionary lookups need.
+ *
+ * A distance limit stops the scan as soon as the result cannot come back
+ * under it; results over the limit are reported as `max + 1`.
+ *
+ * Usage:
+ *   std::size_t d = fuzzy::levenshtein("kitten", "sitting");          // 3
+ *   fuzzy::levenshtein_pattern query("receive");
+ *   if (query.distance(candidate, 2) <= 2) { ... }
+ */
+
+#include "../meta/concepts.hpp"
+#include "../str/policy.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+inline constexpr std::size_t no_limit = static_cast<std::size_t>(-1);
+
+namespace detail {
+
+// Inputs: any string-like value, or a C-string / literal
+template <meta::character CharT>
+constexpr std::basic_string_view<CharT> text_view(const CharT* text) noexcept {
+    return str::detail::needle_view(text);
+}
+
+template <meta::string_like Str>
+constexpr auto text_view(const Str& text) noexcept {
+    return str::as_view(text);
+}
+
+template <typename T>
+concept text = requires(const T& t) { detail::text_view(t); };
+
+template <typename T>
+using text_char_t = typename decltype(detail::text_view(std::declval<const T&>()))::value_type;
+
+/**
+ * @brief Per-unit bit masks of one pattern word (bit i set where the
+ *        pattern has that unit at position i)
+ *
+ * Code units below 256 use a direct table; wider units (at most 64
+ * distinct ones per word) are found in a short list.
+ */
+template <meta::character CharT>
+class match_masks {
+public:
+    void add(CharT ch, std::uint64_t bit) noexcept {
+        if (is_narrow(ch)) {
+            narrow_[unit_of(ch)] |= bit;
+            return;
+        }
+        std::size_t k = 0;
+        while (k < wide_count_ && wide_units_[k] != ch) ++k;
+        if (k == wide_count_) {
+            wide_units_[k] = ch;
+            ++wide_count_;
+        }
+        wide_masks_[k] |= bit;
+    }
+
+    [[nodiscard]] std::uint64_t operator[](CharT ch) const noexcept {
+        if (is_narrow(ch)) return narrow_[unit_of(ch)];
+        for (std::size_t k = 0; k < wide_count_; ++k) {
+            if (wide_units_[k] == ch) return wide_masks_[k];
+        }
+        return 0;
+    }
+
+private:
+    static constexpr auto unit_of(CharT ch) noexcept { return static_cast<std::make_unsigned_t<CharT>>(ch); }
+
+    static constexpr bool is_narrow(CharT ch) noexcept {
+        if constexpr (sizeof(CharT) == 1) {
+            return true;
+        } else {
+            return unit_of(ch) < 256;
+        }
+    }
+
+    std::array<std::uint64_t, 256> narrow_{};
+    std::array<CharT, 64> wide_units_{};
+    std::array<std::uint64_t, 64> wide_masks_{};
+    std::size_t wide_count_ = 0;
+};
+
+// Row-by-row DP for when both strings are longer than one word
+template <meta::character CharT>
+std::size_t levenshtein_rows(std::basic_string_view<CharT> a, std::basic_string_view<CharT> b, std::size_t max) {
+    std::vector<std::size_t> row(b.size() + 1);
+    for (std::size_t j = 0; j <= b.size(); ++j) row[j] = j;
+
+    for (std::size_t i = 1; i <= a.size(); ++i) {
+        std::size_t diagonal = row[0];
+        row[0] = i;
+        std::size_t best = row[0];
+        for (std::size_t j = 1; j <= b.size(); ++j) {
+            const std::size_t up = row[j];
+            row[j] = std::min({up + 1, row[j - 1] + 1, diagonal + (a[i - 1] == b[j - 1] ? 0 : 1)});
+            diagonal = up;
+            best = std::min(best, row[j]);
+        }
+        if (best > max) return max + 1;  // every later row is at least this
+    }
+    return row[b.size()] > max ? max + 1 : row[b.size()];
+}
+
+} // namespace detail
+
+// ==================== Pattern ====================
+
+/**
+ * @brief Precomputed match masks for one pattern, compared against many texts
+ *
+ * The pattern is viewed, not copied: keep the string alive while the
+ * pattern is in use.
+ */
+template <meta::character CharT>
+class basic_levenshtein_pattern {
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    static constexpr std::size_t word_bits = 64;
+
+    basic_levenshtein_pattern() noexcept = default;
+
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    explicit basic_levenshtein_pattern(const Str& pattern) noexcept
+        : pattern_{detail::text_view(pattern)} {
+        if (pattern_.size() > word_bits) return;  // distance() falls back to rows
+        for (std::size_t i = 0; i < pattern_.size(); ++i) masks_.add(pattern_[i], std::uint64_t{1} << i);
+    }
+
+    [[nodiscard]] view_type pattern() const noexcept { return pattern_; }
+
+    /**
+     * @brief Edit distance to `text`, or `max + 1` once it must exceed `max`
+     *
+     * Allocates only when the pattern and the text are both longer than 64
+     * code units.
+     */
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] std::size_t distance(const Str& text, std::size_t max = no_limit) const {
+        const view_type t = detail::text_view(text);
+        const std::size_t m = pattern_.size();
+        const std::size_t n = t.size();
+        const std::size_t gap = m > n ? m - n : n - m;
+        if (gap > max) return max + 1;
+        if (m == 0) return n;
+        if (n == 0) return m;
+        if (m > word_bits) {
+            // Symmetric: a short text can take the pattern's place
+            if (n <= word_bits) return basic_levenshtein_pattern(t).distance(pattern_, max);
+            return detail::levenshtein_rows(pattern_, t, max);
+        }
+
+        const std::uint64_t last = std::uint64_t{1} << (m - 1);
+        std::uint64_t pv = ~std::uint64_t{0};
+        std::uint64_t mv = 0;
+        std::size_t score = m;
+
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::uint64_t eq = masks_[t[j]];
+            const std::uint64_t xv = eq | mv;
+            const std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            std::uint64_t ph = mv | ~(xh | pv);
+            std::uint64_t mh = pv & xh;
+
+            if (ph & last) {
+                ++score;
+            } else if (mh & last) {
+                --score;
+            }
+
+            // The score drops by at most one per remaining text unit
+            if (score > max && score - max > n - j - 1) return max + 1;
+
+            ph = (ph << 1) | 1;  // row 0 of the matrix grows by one per column
+            mh <<= 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+        }
+        return score > max ? max + 1 : score;
+    }
+
+private:
+    view_type pattern_{};
+    detail::match_masks<CharT> masks_;
+};
+
+using levenshtein_pattern = basic_levenshtein_pattern<char>;
+using wlevenshtein_pattern = basic_levenshtein_pattern<wchar_t>;
+using u16levenshtein_pattern = basic_levenshtein_pattern<char16_t>;
+using u32levenshtein_pattern = basic_levenshtein_pattern<char32_t>;
+
+// ==================== Levenshtein ====================
+
+namespace detail {
+
+struct levenshtein_fn {
+    /**
+     * @brief Edit distance between two strings, or `max + 1` once it must
+     *        exceed `max`
+     */
+    template <text A, text B>
+        requires std::same_as<text_char_t<A>, text_char_t<B>>
+    [[nodiscard]] std::size_t operator()(const A& a, const B& b, std::size_t max = no_limit) const {
+        const auto x = text_view(a);
+        const auto y = text_view(b);
+        // The shorter string is the pattern: one word covers more pairs
+        using pattern = basic_levenshtein_pattern<text_char_t<A>>;
+        return x.size() <= y.size() ? pattern(x).distance(y, max) : pattern(y).distance(x, max);
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::levenshtein_fn levenshtein{};
+
+} // namespace zuu::fuzzy
@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/match.hpp
+ * @brief Lookup results and top-k selection shared by the fuzzy indexes
+ * @version 3.0.0
+ *
+ * Matches rank by distance, then by frequency (more frequent first), then
+ * by term, so equal inputs give the same order on every run and platform.
+ */
+
+#include "../meta/concepts.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+template <meta::character CharT>
+struct basic_fuzzy_match {
+    std::basic_string_view<CharT> term;  // points into the index
+    std::size_t distance = 0;
+    std::uint64_t frequency = 0;
+
+    friend bool operator==(const basic_fuzzy_match&, const basic_fuzzy_match&) = default;
+};
+
+using fuzzy_match = basic_fuzzy_match<char>;
+using wfuzzy_match = basic_fuzzy_match<wchar_t>;
+using u16fuzzy_match = basic_fuzzy_match<char16_t>;
+using u32fuzzy_match = basic_fuzzy_match<char32_t>;
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr bool ranks_before(const basic_fuzzy_match<CharT>& a, const basic_fuzzy_match<CharT>& b) noexcept {
+    if (a.distance != b.distance) return a.distance < b.distance;
+    if (a.frequency != b.frequency) return a.frequency > b.frequency;
+    return a.term < b.term;
+}
+
+/**
+ * @brief Keeps the best k matches in `out`, sorted
+ *
+ * limit() is the largest distance still worth verifying: the caller's
+ * maximum until k matches are held, then the worst distance held (a tie
+ * can still win on frequency).
+ */
+template <meta::character CharT>
+class top_k {
+public:
+    top_k(std::vector<basic_fuzzy_match<CharT>>& out, std::size_t k, std::size_t max) noexcept
+        : out_{out}, k_{k}, max_{max} {
+        out_.clear();
+    }
+
+    [[nodiscard]] std::size_t limit() const noexcept {
+        return out_.size() == k_ && k_ != 0 ? out_.back().distance : max_;
+    }
+
+    void offer(const basic_fuzzy_match<CharT>& match) {
+        if (k_ == 0 || match.distance > limit()) return;
+        if (out_.size() == k_ && !ranks_before(match, out_.back())) return;
+        if (out_.size() == k_) out_.pop_back();
+        out_.insert(std::upper_bound(out_.begin(), out_.end(), match, ranks_before<CharT>), match);
+    }
+
+private:
+    std::vector<basic_fuzzy_match<CharT>>& out_;
+    std::size_t k_;
+    std::size_t max_;
+};
+
+} // namespace detail
+
+} // namespace zuu::fuzzy
@@ -0,0 +1,457 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/similarity.hpp
+ * @brief Jaro-Winkler and token similarity for record linkage, with batch scoring
+ * @version 3.0.0
+ *
+ * Scores are in [0, 1], 1 meaning equal. Every scorer takes a cutoff: a
+ * candidate that cannot reach it (judged from lengths first, then from
+ * the match count before transpositions) scores 0 without finishing the
+ * work, so most pairs in a blocking group are rejected cheaply.
+ *
+ *   jaro_winkler      character matches within a sliding window, bit-parallel
+ *                     when both strings fit one 64-bit word
+ *   ratio             2 * LCS / (|a| + |b|) (insertions and deletions only),
+ *                     bit-parallel LCS
+ *   token_sort_ratio  ratio of the whitespace tokens sorted and rejoined, so
+ *                     word order does not matter
+ *   token_set_ratio   best ratio among the shared tokens alone and the shared
+ *                     tokens plus each side's rest, so extra words do not
+ *                     count against a match
+ *
+ * Comparison is by code unit; normalize case beforehand (str::to_lower).
+ * Tokens come from str::split_whitespace (the first 32 per string) and are
+ * never copied: joined token text is read in place.
+ *
+ * Usage:
+ *   double s = fuzzy::jaro_winkler("martha", "marhta");        // 0.961
+ *   fuzzy::token_set_scorer query(name);
+ *   std::size_t hits = fuzzy::score_batch(query, group, scores, 0.9);
+ *   auto [index, score] = fuzzy::best_match(query, group, 0.8);
+ */
+
+#include "../core/inline_vector.hpp"
+#include "../str/policy.hpp"
+#include "../str/split.hpp"
+#include "distance.hpp"
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+struct jaro_winkler_options {
+    double prefix_scale = 0.1;     // boost per shared prefix unit
+    std::size_t max_prefix = 4;    // shared prefix units that count
+    double boost_threshold = 0.7;  // Jaro score below which no boost applies
+};
+
+namespace detail {
+
+// ==================== Jaro ====================
+
+inline double jaro_score(std::size_t la, std::size_t lb, std::size_t matches, std::size_t transpositions) noexcept {
+    if (matches == 0) return 0.0;
+    const double m = static_cast<double>(matches);
+    return (m / static_cast<double>(la) + m / static_cast<double>(lb) +
+            (m - static_cast<double>(transpositions)) / m) / 3.0;
+}
+
+inline double winkler_boost(double jaro, std::size_t prefix, const jaro_winkler_options& options) noexcept {
+    if (jaro < options.boost_threshold) return jaro;
+    return jaro + static_cast<double>(prefix) * options.prefix_scale * (1.0 - jaro);
+}
+
+// Positions [lo, hi] of one word
+constexpr std::uint64_t bit_range(std::size_t lo, std::size_t hi) noexcept {
+    const std::uint64_t upto = hi >= 63 ? ~std::uint64_t{0} : (std::uint64_t{1} << (hi + 1)) - 1;
+    return upto & ~((std::uint64_t{1} << lo) - 1);
+}
+
+// Matches within the Jaro window and transpositions (half the matched
+// units that are out of order), for strings longer than one word
+template <meta::character CharT>
+std::pair<std::size_t, std::size_t> jaro_counts_scalar(std::basic_string_view<CharT> a, std::basic_string_view<CharT> b,
+                                                       std::size_t window) {
+    std::vector<unsigned char> a_flag(a.size()), b_flag(b.size());
+    std::size_t matches = 0;
+    for (std::size_t j = 0; j < b.size(); ++j) {
+        const std::size_t lo = j > window ? j - window : 0;
+        const std::size_t hi = std::min(j + window + 1, a.size());
+        for (std::size_t i = lo; i < hi; ++i) {
+            if (!a_flag[i] && a[i] == b[j]) {
+                a_flag[i] = b_flag[j] = 1;
+                ++matches;
+                break;
+            }
+        }
+    }
+
+    std::size_t out_of_order = 0;
+    for (std::size_t i = 0, j = 0; i < a.size(); ++i) {
+        if (!a_flag[i]) continue;
+        while (!b_flag[j]) ++j;
+        out_of_order += a[i] != b[j++];
+    }
+    return {matches, out_of_order / 2};
+}
+
+// ==================== LCS ====================
+
+/**
+ * @brief Tokens read as one string joined by single spaces, without
+ *        building it
+ */
+template <meta::character CharT>
+class token_text {
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    static constexpr std::size_t max_tokens = 64;
+
+    token_text() noexcept = default;
+
+    explicit token_text(view_type whole) noexcept { append(whole); }
+
+    void append(view_type token) noexcept {
+        if (tokens_.full()) return;
+        size_ += token.size() + (tokens_.empty() ? 0 : 1);
+        tokens_.push_back(token);
+    }
+
+    template <typename Range>
+    void append_all(const Range& tokens) noexcept {
+        for (const auto& token : tokens) append(token);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        bool first = true;
+        for (const auto& token : tokens_) {
+            if (!first) fn(CharT(' '));
+            first = false;
+            for (const CharT ch : token) fn(ch);
+        }
+    }
+
+    [[nodiscard]] std::basic_string<CharT> str() const {
+        std::basic_string<CharT> out;
+        out.reserve(size_);
+        for_each([&out](CharT ch) { out.push_back(ch); });
+        return out;
+    }
+
+private:
+    inline_vector<view_type, max_tokens> tokens_;
+    std::size_t size_ = 0;
+};
+
+// Bit-parallel LCS (Allison-Dix / Hyyrö) when the shorter side fits a word
+template <meta::character CharT>
+std::size_t lcs_length(const token_text<CharT>& a, const token_text<CharT>& b) {
+    const token_text<CharT>& pattern = a.size() <= b.size() ? a : b;
+    const token_text<CharT>& text = a.size() <= b.size() ? b : a;
+    if (pattern.empty()) return 0;
+
+    if (pattern.size() <= 64) {
+        match_masks<CharT> masks;
+        std::size_t i = 0;
+        pattern.for_each([&](CharT ch) { masks.add(ch, std::uint64_t{1} << i++); });
+
+        std::uint64_t s = ~std::uint64_t{0};
+        text.for_each([&](CharT ch) {
+            const std::uint64_t u = s & masks[ch];
+            s = (s + u) | (s - u);
+        });
+        return static_cast<std::size_t>(std::popcount(~s & bit_range(0, pattern.size() - 1)));
+    }
+
+    const auto x = pattern.str();
+    const auto y = text.str();
+    std::vector<std::size_t> row(y.size() + 1, 0);
+    for (std::size_t r = 1; r <= x.size(); ++r) {
+        std::size_t diagonal = 0;
+        for (std::size_t c = 1; c <= y.size(); ++c) {
+            const std::size_t up = row[c];
+            row[c] = x[r - 1] == y[c - 1] ? diagonal + 1 : std::max(up, row[c - 1]);
+            diagonal = up;
+        }
+    }
+    return row[y.size()];
+}
+
+template <meta::character CharT>
+double indel_ratio(const token_text<CharT>& a, const token_text<CharT>& b, double cutoff) {
+    const std::size_t total = a.size() + b.size();
+    if (total == 0) return cutoff <= 1.0 ? 1.0 : 0.0;
+    // At best the shorter side is a subsequence of the longer
+    if (2.0 * static_cast<double>(std::min(a.size(), b.size())) < cutoff * static_cast<double>(total)) return 0.0;
+    const double score = 2.0 * static_cast<double>(lcs_length(a, b)) / static_cast<double>(total);
+    return score >= cutoff ? score : 0.0;
+}
+
+// ==================== Tokens ====================
+
+template <meta::character CharT>
+using token_list = inline_vector<std::basic_string_view<CharT>, 32>;
+
+template <meta::character CharT>
+token_list<CharT> sorted_tokens(std::basic_string_view<CharT> text, bool unique) {
+    auto tokens = str::split_whitespace.apply<std::basic_string_view<CharT>, 32>(text);
+    std::sort(tokens.begin(), tokens.end());
+    if (unique) {
+        const auto last = std::unique(tokens.begin(), tokens.end());
+        while (tokens.end() != last) tokens.pop_back();
+    }
+    return tokens;
+}
+
+template <meta::character CharT>
+double token_set_score(const token_list<CharT>& a, const token_list<CharT>& b, double cutoff) {
+    token_list<CharT> shared, only_a, only_b;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(shared));
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(only_a));
+    std::set_difference(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(only_b));
+
+    // One side's tokens all appear in the other
+    if (!shared.empty() && (only_a.empty() || only_b.empty())) return cutoff <= 1.0 ? 1.0 : 0.0;
+
+    token_text<CharT> t0, t1, t2;
+    t0.append_all(shared);
+    t1.append_all(shared);
+    t1.append_all(only_a);
+    t2.append_all(shared);
+    t2.append_all(only_b);
+
+    double best = 0.0;
+    for (const auto& [x, y] : {std::pair{&t0, &t1}, std::pair{&t0, &t2}, std::pair{&t1, &t2}}) {
+        best = std::max(best, indel_ratio(*x, *y, std::max(cutoff, best)));
+    }
+    return best >= cutoff ? best : 0.0;
+}
+
+} // namespace detail
+
+// ==================== Jaro-Winkler ====================
+
+/**
+ * @brief Jaro-Winkler against one query, for scoring many candidates
+ *
+ * Views the query: keep it alive while the scorer is in use.
+ */
+template <meta::character CharT>
+class basic_jaro_winkler_scorer {
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    explicit basic_jaro_winkler_scorer(const Str& query, jaro_winkler_options options = {}) noexcept
+        : query_{detail::text_view(query)}, options_{options} {
+        if (query_.size() > 64) return;
+        for (std::size_t i = 0; i < query_.size(); ++i) masks_.add(query_[i], std::uint64_t{1} << i);
+    }
+
+    // Score in [0, 1], or 0 if it would be below `cutoff`
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] double operator()(const Str& candidate, double cutoff = 0.0) const {
+        const view_type a = query_;
+        const view_type b = detail::text_view(candidate);
+        if (a.empty() || b.empty()) return a.empty() && b.empty() && cutoff <= 1.0 ? 1.0 : 0.0;
+
+        std::size_t prefix = 0;
+        const std::size_t prefix_limit = std::min({options_.max_prefix, a.size(), b.size()});
+        while (prefix < prefix_limit && a[prefix] == b[prefix]) ++prefix;
+
+        // Best case from the lengths: every unit of the shorter one matches
+        const std::size_t shortest = std::min(a.size(), b.size());
+        if (winkler(detail::jaro_score(a.size(), b.size(), shortest, 0), prefix) < cutoff) return 0.0;
+
+        const std::size_t window = std::max(a.size(), b.size()) / 2 > 0 ? std::max(a.size(), b.size()) / 2 - 1 : 0;
+        std::size_t matches = 0;
+        std::size_t transpositions = 0;
+
+        if (a.size() <= 64 && b.size() <= 64) {
+            std::uint64_t a_flag = 0;
+            std::uint64_t b_flag = 0;
+            for (std::size_t j = 0; j < b.size(); ++j) {
+                const std::size_t lo = j > window ? j - window : 0;
+                if (lo >= a.size()) break;
+                const std::size_t hi = std::min(j + window, a.size() - 1);
+                const std::uint64_t open = masks_[b[j]] & detail::bit_range(lo, hi) & ~a_flag;
+                if (open != 0) {
+                    a_flag |= open & (~open + 1);  // lowest unmatched position
+                    b_flag |= std::uint64_t{1} << j;
+                }
+            }
+            matches = static_cast<std::size_t>(std::popcount(a_flag));
+            if (winkler(detail::jaro_score(a.size(), b.size(), matches, 0), prefix) < cutoff) return 0.0;
+
+            std::size_t out_of_order = 0;
+            while (b_flag != 0) {
+                out_of_order += a[std::countr_zero(a_flag)] != b[std::countr_zero(b_flag)];
+                a_flag &= a_flag - 1;
+                b_flag &= b_flag - 1;
+            }
+            transpositions = out_of_order / 2;
+        } else {
+            std::tie(matches, transpositions) = detail::jaro_counts_scalar(a, b, window);
+        }
+
+        const double score = winkler(detail::jaro_score(a.size(), b.size(), matches, transpositions), prefix);
+        return score >= cutoff ? score : 0.0;
+    }
+
+private:
+    [[nodiscard]] double winkler(double jaro, std::size_t prefix) const noexcept {
+        return detail::winkler_boost(jaro, prefix, options_);
+    }
+
+    view_type query_;
+    jaro_winkler_options options_;
+    detail::match_masks<CharT> masks_;
+};
+
+// ==================== Token Similarity ====================
+
+/**
+ * @brief token_sort_ratio against one query (tokens split and sorted once)
+ */
+template <meta::character CharT>
+class basic_token_sort_scorer {
+public:
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    explicit basic_token_sort_scorer(const Str& query) noexcept {
+        query_.append_all(detail::sorted_tokens(detail::text_view(query), false));
+    }
+
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] double operator()(const Str& candidate, double cutoff = 0.0) const {
+        detail::token_text<CharT> other;
+        other.append_all(detail::sorted_tokens(detail::text_view(candidate), false));
+        return detail::indel_ratio(query_, other, cutoff);
+    }
+
+private:
+    detail::token_text<CharT> query_;
+};
+
+/**
+ * @brief token_set_ratio against one query (tokens split, sorted and
+ *        deduplicated once)
+ */
+template <meta::character CharT>
+class basic_token_set_scorer {
+public:
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    explicit basic_token_set_scorer(const Str& query) noexcept
+        : query_{detail::sorted_tokens(detail::text_view(query), true)} {}
+
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] double operator()(const Str& candidate, double cutoff = 0.0) const {
+        return detail::token_set_score(query_, detail::sorted_tokens(detail::text_view(candidate), true), cutoff);
+    }
+
+private:
+    detail::token_list<CharT> query_;
+};
+
+using jaro_winkler_scorer = basic_jaro_winkler_scorer<char>;
+using wjaro_winkler_scorer = basic_jaro_winkler_scorer<wchar_t>;
+using u16jaro_winkler_scorer = basic_jaro_winkler_scorer<char16_t>;
+using u32jaro_winkler_scorer = basic_jaro_winkler_scorer<char32_t>;
+
+using token_sort_scorer = basic_token_sort_scorer<char>;
+using wtoken_sort_scorer = basic_token_sort_scorer<wchar_t>;
+using token_set_scorer = basic_token_set_scorer<char>;
+using wtoken_set_scorer = basic_token_set_scorer<wchar_t>;
+
+namespace detail {
+
+// One-shot form of a scorer: f(a, b, cutoff = 0)
+template <template <typename> class Scorer>
+struct pair_score_fn {
+    template <text A, text B>
+        requires std::same_as<text_char_t<A>, text_char_t<B>>
+    [[nodiscard]] double operator()(const A& a, const B& b, double cutoff = 0.0) const {
+        return Scorer<text_char_t<A>>(a)(b, cutoff);
+    }
+};
+
+struct ratio_fn {
+    template <text A, text B>
+        requires std::same_as<text_char_t<A>, text_char_t<B>>
+    [[nodiscard]] double operator()(const A& a, const B& b, double cutoff = 0.0) const {
+        return indel_ratio(token_text(text_view(a)), token_text(text_view(b)), cutoff);
+    }
+};
+
+} // namespace detail
+
+inline constexpr detail::pair_score_fn<basic_jaro_winkler_scorer> jaro_winkler{};
+inline constexpr detail::pair_score_fn<basic_token_sort_scorer> token_sort_ratio{};
+inline constexpr detail::pair_score_fn<basic_token_set_scorer> token_set_ratio{};
+inline constexpr detail::ratio_fn ratio{};
+
+// ==================== Batch Scoring ====================
+
+/**
+ * @brief Score every candidate against the scorer's query
+ *
+ * scores[i] gets the score of candidates[i], or 0 if it is below
+ * `cutoff`; `scores` must be at least as long as `candidates`. Returns the
+ * number of candidates that reached the cutoff.
+ */
+template <typename Scorer, std::ranges::forward_range Candidates>
+std::size_t score_batch(const Scorer& scorer, const Candidates& candidates, std::span<double> scores,
+                        double cutoff = 0.0) {
+    std::size_t hits = 0;
+    std::size_t i = 0;
+    for (const auto& candidate : candidates) {
+        if (i == scores.size()) break;
+        const double s = scorer(candidate, cutoff);
+        scores[i++] = s;
+        hits += s > 0.0 && s >= cutoff;
+    }
+    return hits;
+}
+
+/**
+ * @brief Index and score of the best candidate at or above `cutoff`
+ *        (the first one on ties), or {npos, 0} if none
+ *
+ * The cutoff rises to the best score so far, so later candidates are
+ * rejected as early as possible.
+ */
+template <typename Scorer, std::ranges::forward_range Candidates>
+std::pair<std::size_t, double> best_match(const Scorer& scorer, const Candidates& candidates, double cutoff = 0.0) {
+    std::pair<std::size_t, double> best{str::npos, 0.0};
+    std::size_t i = 0;
+    for (const auto& candidate : candidates) {
+        const double s = scorer(candidate, std::max(cutoff, best.second));
+        if (s > best.second && s >= cutoff) best = {i, s};
+        ++i;
+    }
+    return best;
+}
+
+} // namespace zuu::fuzzy
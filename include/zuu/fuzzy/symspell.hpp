@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+ * @file zuu/fuzzy/symspell.hpp
+ * @brief Symmetric-delete (SymSpell) index for fuzzy dictionary lookup
+ * @version 3.0.0
+ *
+ * Two strings within edit distance d share a string reachable from each by
+ * at most d deletions. The index stores, for every term, the hashes of all
+ * its d-deletion variants; a lookup generates the query's variants and
+ * only verifies the terms filed under them, with the bit-parallel distance
+ * from distance.hpp. Against a million-entry dictionary that is a few
+ * hundred candidates instead of a million comparisons.
+ *
+ * Only the first `prefix_length` code units are expanded (as in SymSpell),
+ * which bounds the variants per term without losing matches; verification
+ * always uses the whole term.
+ *
+ * Storage is flat: terms live in an arena, and (hash, term id) postings
+ * are sorted into one array with a 64K-entry directory on the top hash
+ * bits. Hash collisions only cost an extra verification.
+ *
+ * Usage:
+ *   fuzzy::symspell_index index({.max_distance = 2});
+ *   for (const auto& [word, count] : counts) index.add(word, count);
+ *   index.build();
+ *   auto best = index.lookup("recieve", 2, 3);   // up to 3 matches, d <= 2
+ */
+
+#include "../simd/hash.hpp"
+#include "arena.hpp"
+#include "distance.hpp"
+#include "match.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace zuu::fuzzy {
+
+struct symspell_options {
+    std::size_t max_distance = 2;   // largest distance lookups may ask for
+    std::size_t prefix_length = 7;  // code units expanded per term (at most 16)
+};
+
+template <meta::character CharT>
+class basic_symspell_index {
+public:
+    using view_type = std::basic_string_view<CharT>;
+    using match_type = basic_fuzzy_match<CharT>;
+
+    static constexpr std::size_t max_prefix = 16;
+
+    explicit basic_symspell_index(symspell_options options = {}) noexcept
+        : options_{options} {
+        options_.prefix_length = std::clamp<std::size_t>(options_.prefix_length, 1, max_prefix);
+        options_.max_distance = std::min(options_.max_distance, options_.prefix_length);
+    }
+
+    /**
+     * @brief Add a term (its frequency ranks equal-distance matches)
+     *
+     * Terms added after build() are found only after the next build().
+     */
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    void add(const Str& term, std::uint64_t frequency = 1) {
+        terms_.push_back({arena_.store(detail::text_view(term)), frequency});
+        built_ = false;
+    }
+
+    // Merge duplicate terms (summing frequencies) and index the deletions
+    void build() {
+        std::sort(terms_.begin(), terms_.end(), [](const entry& a, const entry& b) { return a.term < b.term; });
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < terms_.size(); ++i) {
+            if (kept != 0 && terms_[kept - 1].term == terms_[i].term) {
+                terms_[kept - 1].frequency += terms_[i].frequency;
+            } else {
+                terms_[kept++] = terms_[i];
+            }
+        }
+        terms_.resize(kept);
+
+        // (hash << 32 | id), deduplicated per term
+        std::vector<std::uint64_t> postings;
+        std::vector<std::uint32_t> hashes;
+        for (std::size_t id = 0; id < terms_.size(); ++id) {
+            hashes.clear();
+            for_each_delete(terms_[id].term, options_.max_distance, [&](std::uint32_t h) { hashes.push_back(h); });
+            std::sort(hashes.begin(), hashes.end());
+            hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+            for (const auto h : hashes) postings.push_back(std::uint64_t{h} << 32 | id);
+        }
+        std::sort(postings.begin(), postings.end());
+
+        keys_.clear();
+        starts_.clear();
+        ids_.resize(postings.size());
+        for (std::size_t i = 0; i < postings.size(); ++i) {
+            const auto key = static_cast<std::uint32_t>(postings[i] >> 32);
+            if (keys_.empty() || keys_.back() != key) {
+                keys_.push_back(key);
+                starts_.push_back(static_cast<std::uint32_t>(i));
+            }
+            ids_[i] = static_cast<std::uint32_t>(postings[i]);
+        }
+        starts_.push_back(static_cast<std::uint32_t>(ids_.size()));
+
+        directory_.assign(directory_size + 1, 0);
+        for (const auto key : keys_) ++directory_[(key >> 16) + 1];
+        for (std::size_t i = 1; i <= directory_size; ++i) directory_[i] += directory_[i - 1];
+        built_ = true;
+    }
+
+    /**
+     * @brief Up to k terms within `max_distance` of `query`, best first
+     *
+     * `max_distance` is capped at the index's max_distance. Returns
+     * nothing before build().
+     */
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    [[nodiscard]] std::vector<match_type> lookup(const Str& query, std::size_t max_distance, std::size_t k = 1) const {
+        std::vector<match_type> out;
+        std::vector<std::uint32_t> candidates;
+        lookup(query, max_distance, k, out, candidates);
+        return out;
+    }
+
+    // As above, reusing the caller's buffers (out is cleared first)
+    template <detail::text Str>
+        requires std::same_as<detail::text_char_t<Str>, CharT>
+    void lookup(const Str& query, std::size_t max_distance, std::size_t k, std::vector<match_type>& out,
+                std::vector<std::uint32_t>& candidates) const {
+        const view_type q = detail::text_view(query);
+        max_distance = std::min(max_distance, options_.max_distance);
+        detail::top_k<CharT> best(out, k, max_distance);
+        candidates.clear();
+        if (!built_ || k == 0) return;
+
+        for_each_delete(q, max_distance, [&](std::uint32_t h) {
+            const auto [first, last] = postings_of(h);
+            candidates.insert(candidates.end(), ids_.begin() + first, ids_.begin() + last);
+        });
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        const basic_levenshtein_pattern<CharT> pattern(q);
+        for (const auto id : candidates) {
+            const entry& e = terms_[id];
+            const std::size_t limit = best.limit();
+            const std::size_t d = pattern.distance(e.term, limit);
+            if (d <= limit) best.offer({e.term, d, e.frequency});
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return terms_.size(); }
+    [[nodiscard]] std::size_t postings() const noexcept { return ids_.size(); }
+    [[nodiscard]] const symspell_options& options() const noexcept { return options_; }
+
+private:
+    struct entry {
+        view_type term;
+        std::uint64_t frequency;
+    };
+
+    static constexpr std::size_t directory_size = std::size_t{1} << 16;
+
+    static std::uint32_t hash_of(const CharT* text, std::size_t n) noexcept {
+        const std::uint64_t h = simd::hash(text, n);
+        return static_cast<std::uint32_t>(h ^ (h >> 32));
+    }
+
+    // Hash of every string reachable from the prefix by up to `depth`
+    // deletions; each deletion set is visited once (positions increase)
+    template <typename Fn>
+    void for_each_delete(view_type text, std::size_t depth, Fn&& fn) const {
+        CharT buffer[max_prefix];
+        const std::size_t n = std::min(text.size(), options_.prefix_length);
+        std::copy_n(text.data(), n, buffer);
+        expand(buffer, n, 0, depth, fn);
+    }
+
+    template <typename Fn>
+    static void expand(const CharT* text, std::size_t n, std::size_t from, std::size_t depth, Fn& fn) {
+        fn(hash_of(text, n));
+        if (depth == 0) return;
+        CharT shorter[max_prefix];
+        for (std::size_t i = from; i < n; ++i) {
+            std::copy_n(text, i, shorter);
+            std::copy(text + i + 1, text + n, shorter + i);
+            expand(shorter, n - 1, i, depth - 1, fn);
+        }
+    }
+
+    [[nodiscard]] std::pair<std::uint32_t, std::uint32_t> postings_of(std::uint32_t key) const noexcept {
+        const auto first = keys_.begin() + directory_[key >> 16];
+        const auto last = keys_.begin() + directory_[(key >> 16) + 1];
+        const auto it = std::lower_bound(first, last, key);
+        if (it == last || *it != key) return {0, 0};
+        const auto slot = static_cast<std::size_t>(it - keys_.begin());
+        return {starts_[slot], starts_[slot + 1]};
+    }
+
+    symspell_options options_;
+    basic_string_arena<CharT> arena_;
+    std::vector<entry> terms_;
+
+    std::vector<std::uint32_t> keys_;       // distinct deletion hashes, sorted
+    std::vector<std::uint32_t> starts_;     // postings of keys_[i]: ids_[starts_[i], starts_[i + 1])
+    std::vector<std::uint32_t> ids_;
+    std::vector<std::uint32_t> directory_;  // keys_ slots by the top 16 hash bits
+    bool built_ = false;
+};
+
+using symspell_index = basic_symspell_index<char>;
+using wsymspell_index = basic_symspell_index<wchar_t>;
+using u16symspell_index = basic_symspell_index<char16_t>;
+using u32symspell_index = basic_symspell_index<char32_t>;
+
+} // namespace zuu::fuzzy
@@ -39,11 +39,14 @@ concept convertible_to_string_view = requires(T t) {
     { std::basic_string_view{t} } -> std::same_as<std::basic_string_view<typename T::value_type>>;
 };
 
-// Main StringLike concept
+// Main StringLike concept (cv/ref-qualified types are accepted as-is,
+// so forwarding references to lvalues satisfy it too)
 template <typename T>
 concept string_like = 
-    has_data_and_size<T> || 
-    convertible_to_string_view<T>;
+    requires { typename std::remove_cvref_t<T>::value_type; } &&
+    character<typename std::remove_cvref_t<T>::value_type> &&
+    (has_data_and_size<std::remove_cvref_t<T>> || 
+     convertible_to_string_view<std::remove_cvref_t<T>>);
 
 // ==================== Fixed-Capacity String Detection ====================
 
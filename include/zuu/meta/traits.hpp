@@ -7,6 +7,8 @@
  */
 
 #include "concepts.hpp"
+#include <algorithm>
+#include <bit>
 #include <span>
 
 namespace zuu::meta {
@@ -69,6 +71,46 @@ struct is_compatible_string<T1, T2> : std::true_type {};
 template <typename T1, typename T2>
 inline constexpr bool is_compatible_string_v = is_compatible_string<T1, T2>::value;
 
+// ==================== Result Capacity Policy ====================
+
+/**
+ * Results whose capacity is computed from their inputs (operator+, join)
+ * are rounded up to a size class and capped at a ceiling, so chained
+ * expressions do not grow ever larger types. Override the global default
+ * by defining ZUU_FSTRING_MAX_RESULT_CAPACITY, or per call by passing a
+ * capacity_ceiling<N> tag (e.g. a.concat(b, meta::capacity_ceiling<64>{})).
+ */
+#ifndef ZUU_FSTRING_MAX_RESULT_CAPACITY
+#define ZUU_FSTRING_MAX_RESULT_CAPACITY 4096
+#endif
+
+template <std::size_t Ceiling>
+struct capacity_ceiling {
+    static constexpr std::size_t value = Ceiling;
+};
+
+using default_capacity_ceiling = capacity_ceiling<ZUU_FSTRING_MAX_RESULT_CAPACITY>;
+
+// Size classes: 16, 24, 32, 48, 64, 96, 128, ... (powers of two and midpoints)
+constexpr std::size_t round_to_size_class(std::size_t n) noexcept {
+    if (n <= 16) return 16;
+
+    const std::size_t upper = std::bit_ceil(n);
+    const std::size_t middle = upper / 2 + upper / 4;
+    return n <= middle ? middle : upper;
+}
+
+/**
+ * @brief Capacity for a computed result
+ * 
+ * Required: characters needed for a lossless result
+ * Floor:    never go below this (largest operand, so no operand is cut)
+ * Ceiling:  never exceed this unless Floor does
+ */
+template <std::size_t Required, std::size_t Floor = 0, std::size_t Ceiling = default_capacity_ceiling::value>
+inline constexpr std::size_t result_capacity_v = 
+    std::max(Floor, std::min(Ceiling, round_to_size_class(Required)));
+
 // ==================== Result Type Calculation ====================
 
 // Calculate appropriate capacity for concatenation result
@@ -81,7 +123,7 @@ struct concat_capacity {
         if constexpr (c1 == std::dynamic_extent || c2 == std::dynamic_extent) {
             return std::dynamic_extent;
         } else {
-            return c1 + c2;
+            return result_capacity_v<c1 + c2, std::max(c1, c2)>;
         }
     }();
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file zuu/rolling.hpp
+ * @brief Rolling-hash search and content-defined chunking
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: Rabin-Karp and Gear rolling hashes, a
+ * multi-needle matcher for many needles of one length, and a FastCDC
+ * chunker that cuts buffers at content-defined boundaries for dedup
+ * storage. Inputs are any string-like view, including a
+ * stream::mapped_file's view().
+ *
+ * @code
+ * #include <zuu/rolling.hpp>
+ * #include <zuu/stream.hpp>
+ * using namespace zuu;
+ *
+ * stream::mapped_file file("backup.tar");
+ * rolling::fastcdc chunker({.avg_size = 16 * 1024});
+ * chunker.for_each_chunk(file.view(), [&](std::size_t offset, std::size_t size) {
+ *     store.put(file.view().substr(offset, size));
+ * });
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "rolling/hash.hpp"
+#include "rolling/multi_search.hpp"
+#include "rolling/cdc.hpp"
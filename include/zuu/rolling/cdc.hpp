@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file zuu/rolling/cdc.hpp
+ * @brief FastCDC content-defined chunking over byte buffers
+ * @version 3.0.0
+ *
+ * A cut is placed where the Gear hash of the preceding bytes has all bits of
+ * a mask clear, so boundaries follow the content: inserting or deleting
+ * bytes moves the chunks around the edit and leaves the rest identical,
+ * which is what lets a dedup store share them.
+ *
+ * FastCDC refinements (Xia et al.): the first min_size bytes of a chunk are
+ * skipped without hashing, and cut-point selection is normalized, with a
+ * mask of two extra bits before avg_size and two fewer after it, so chunk
+ * sizes cluster around the average. Every chunk is at most max_size (the
+ * last one may be shorter than min_size).
+ *
+ * Works on single-byte strings: fstrings, std::string_view or a
+ * stream::mapped_file's view(). For a stream, keep unchunked bytes in a
+ * buffer and call next_cut() on it as it fills.
+ *
+ * Usage:
+ *   rolling::fastcdc chunker({.avg_size = 8192});
+ *   chunker.for_each_chunk(file.view(), [](std::size_t offset, std::size_t size) { ... });
+ *   std::vector<std::size_t> cuts = chunker.boundaries(file.view());   // chunk end offsets
+ */
+
+#include "../meta/concepts.hpp"
+#include "../meta/traits.hpp"
+#include "../str/policy.hpp"
+#include "hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace zuu::rolling {
+
+struct cdc_options {
+    std::size_t min_size = 2 * 1024;
+    std::size_t avg_size = 8 * 1024;  // rounded to a power of two
+    std::size_t max_size = 64 * 1024;
+};
+
+class fastcdc {
+public:
+    explicit fastcdc(cdc_options options = {}) noexcept
+        : options_{options} {
+        options_.avg_size = std::bit_floor(std::max<std::size_t>(options_.avg_size, 64));
+        options_.min_size = std::min(options_.min_size, options_.avg_size);
+        options_.max_size = std::max(options_.max_size, options_.avg_size);
+
+        // The top bits of the Gear hash see the most bytes, so masks take those
+        const auto bits = static_cast<unsigned>(std::countr_zero(options_.avg_size));
+        mask_small_ = top_bits(bits + 2);
+        mask_large_ = top_bits(bits > 2 ? bits - 2 : 1);
+    }
+
+    [[nodiscard]] const cdc_options& options() const noexcept { return options_; }
+
+    /**
+     * @brief Length of the first chunk of the n bytes at data (n if no cut
+     *        is found before n; min(n, max_size) at most)
+     */
+    [[nodiscard]] std::size_t next_cut(const unsigned char* data, std::size_t n) const noexcept {
+        if (n <= options_.min_size) return n;
+        const std::size_t limit = std::min(n, options_.max_size);
+        const std::size_t normal = std::min(limit, options_.avg_size);
+
+        std::uint64_t h = 0;
+        std::size_t i = options_.min_size;
+        for (; i < normal; ++i) {
+            h = gear_roll(h, data[i]);
+            if ((h & mask_small_) == 0) return i + 1;
+        }
+        for (; i < limit; ++i) {
+            h = gear_roll(h, data[i]);
+            if ((h & mask_large_) == 0) return i + 1;
+        }
+        return limit;
+    }
+
+    // Call fn(offset, size) for each chunk of `text`, in order
+    template <meta::string_like Str, typename Fn>
+        requires(sizeof(meta::char_type_of_t<Str>) == 1)
+    void for_each_chunk(const Str& text, Fn&& fn) const {
+        const auto view = str::as_view(text);
+        const auto* data = reinterpret_cast<const unsigned char*>(view.data());
+        for (std::size_t offset = 0; offset < view.size();) {
+            const std::size_t size = next_cut(data + offset, view.size() - offset);
+            fn(offset, size);
+            offset += size;
+        }
+    }
+
+    // End offset of every chunk of `text` (the last is text.size())
+    template <meta::string_like Str>
+        requires(sizeof(meta::char_type_of_t<Str>) == 1)
+    [[nodiscard]] std::vector<std::size_t> boundaries(const Str& text) const {
+        std::vector<std::size_t> cuts;
+        for_each_chunk(text, [&cuts](std::size_t offset, std::size_t size) { cuts.push_back(offset + size); });
+        return cuts;
+    }
+
+private:
+    static constexpr std::uint64_t top_bits(unsigned count) noexcept {
+        return count >= 64 ? ~std::uint64_t{0} : ~(~std::uint64_t{0} >> count);
+    }
+
+    cdc_options options_;
+    std::uint64_t mask_small_;
+    std::uint64_t mask_large_;
+};
+
+} // namespace zuu::rolling
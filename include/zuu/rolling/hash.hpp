@@ -0,0 +1,182 @@
+#pragma once
+
+/**
+ * @file zuu/rolling/hash.hpp
+ * @brief Rolling hashes: Rabin-Karp over code units, Gear over bytes
+ * @version 3.0.0
+ *
+ * Rabin-Karp: the hash of a window is sum(unit[i] * base^(w-1-i)) modulo
+ * the Mersenne prime 2^61 - 1 (rabin_karp) or 2^64 (rabin_karp64), so
+ * sliding the window one unit costs two multiplications instead of
+ * rehashing w units. Units are counted from 1 (a zero unit still changes
+ * the hash), and equal code-unit sequences hash equally whatever container
+ * they live in. The result is the same in constant evaluation and at run
+ * time.
+ *
+ * Gear: h = (h << 1) + table[byte]. There is no explicit window; a byte's
+ * contribution is shifted out after 64 steps, so the top bits depend on the
+ * last few dozen bytes. One shift, one add and one load per byte make it
+ * the hash of choice for content-defined chunking (cdc.hpp).
+ *
+ * Usage:
+ *   rolling::rabin_karp rk(5);                       // 5-unit windows
+ *   rk.for_each(text.data(), text.size(), [](std::size_t pos, std::uint64_t h) { ... });
+ *   std::uint64_t h = rk.hash(needle.data(), needle.size());
+ *   for (unsigned char b : bytes) g = rolling::gear_roll(g, b);
+ */
+
+#include "../meta/concepts.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu::rolling {
+
+namespace detail {
+
+inline constexpr std::uint64_t mersenne61 = (std::uint64_t{1} << 61) - 1;
+
+constexpr std::uint64_t mod61(std::uint64_t x) noexcept {
+    x = (x & mersenne61) + (x >> 61);
+    return x >= mersenne61 ? x - mersenne61 : x;
+}
+
+// a * b mod 2^61 - 1 for a, b < 2^61 (2^61 = 1 and 2^64 = 2^3 modulo the prime)
+constexpr std::uint64_t mul_mod61(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using u128 = unsigned __int128;
+    const u128 product = static_cast<u128>(a) * b;
+    return mod61((static_cast<std::uint64_t>(product) & mersenne61) + static_cast<std::uint64_t>(product >> 61));
+#else
+    const std::uint64_t a_hi = a >> 32, a_lo = a & 0xFFFFFFFFu;
+    const std::uint64_t b_hi = b >> 32, b_lo = b & 0xFFFFFFFFu;
+    const std::uint64_t lo = a_lo * b_lo;
+    const std::uint64_t mid = a_lo * b_hi + a_hi * b_lo;  // < 2^62
+    const std::uint64_t hi = a_hi * b_hi;                  // < 2^58
+    return mod61((lo & mersenne61) + (lo >> 61) + (hi << 3) + (mid >> 29) + ((mid << 35) >> 3));
+#endif
+}
+
+template <meta::character CharT>
+constexpr std::uint64_t unit_value(CharT ch) noexcept {
+    return static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<CharT>>(ch)) + 1;
+}
+
+// Final avalanche (murmur3 fmix64), for callers that need every bit mixed
+constexpr std::uint64_t mix64(std::uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+} // namespace detail
+
+// ==================== Rabin-Karp ====================
+
+// Arithmetic modulo the Mersenne prime 2^61 - 1: well-spread hashes, for
+// shingling and anything that uses the hash without checking the text
+struct mod_mersenne61 {
+    static constexpr std::uint64_t base(std::uint64_t b) noexcept { return detail::mod61(b); }
+    static constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) noexcept { return detail::mul_mod61(a, b); }
+    static constexpr std::uint64_t add(std::uint64_t a, std::uint64_t b) noexcept { return detail::mod61(a + b); }
+    static constexpr std::uint64_t sub(std::uint64_t a, std::uint64_t b) noexcept {
+        return a >= b ? a - b : a + detail::mersenne61 - b;
+    }
+};
+
+// Arithmetic modulo 2^64 (plain wrap-around): a third of the latency per
+// unit, but low bits mix poorly; for matchers that verify every hit
+struct mod_wrap64 {
+    static constexpr std::uint64_t base(std::uint64_t b) noexcept { return b | 1; }
+    static constexpr std::uint64_t mul(std::uint64_t a, std::uint64_t b) noexcept { return a * b; }
+    static constexpr std::uint64_t add(std::uint64_t a, std::uint64_t b) noexcept { return a + b; }
+    static constexpr std::uint64_t sub(std::uint64_t a, std::uint64_t b) noexcept { return a - b; }
+};
+
+template <typename Modulus>
+class basic_rabin_karp {
+public:
+    static constexpr std::uint64_t default_base = 0x1C9D3A0F6B5E4D27ull;
+
+    /**
+     * @brief Roller for windows of `window` code units (at least 1)
+     */
+    constexpr explicit basic_rabin_karp(std::size_t window, std::uint64_t base = default_base) noexcept
+        : window_{std::max<std::size_t>(window, 1)}, base_{Modulus::base(base)} {
+        for (std::size_t i = 1; i < window_; ++i) drop_ = Modulus::mul(drop_, base_);
+    }
+
+    [[nodiscard]] constexpr std::size_t window() const noexcept { return window_; }
+
+    // Hash of n units (any n; equals the window hash when n == window())
+    template <meta::character CharT>
+    [[nodiscard]] constexpr std::uint64_t hash(const CharT* data, std::size_t n) const noexcept {
+        std::uint64_t h = 0;
+        for (std::size_t i = 0; i < n; ++i) h = push(h, data[i]);
+        return h;
+    }
+
+    // Slide the window one unit: drop `out` (its first unit), append `in`
+    template <meta::character CharT>
+    [[nodiscard]] constexpr std::uint64_t roll(std::uint64_t h, CharT out, CharT in) const noexcept {
+        return push(Modulus::sub(h, Modulus::mul(detail::unit_value(out), drop_)), in);
+    }
+
+    /**
+     * @brief Call fn(position, hash) for every full window of the n units
+     *        at data, left to right (nothing if n < window())
+     */
+    template <meta::character CharT, typename Fn>
+    constexpr void for_each(const CharT* data, std::size_t n, Fn&& fn) const {
+        if (n < window_) return;
+        std::uint64_t h = hash(data, window_);
+        fn(std::size_t{0}, h);
+        for (std::size_t i = window_; i < n; ++i) {
+            h = roll(h, data[i - window_], data[i]);
+            fn(i - window_ + 1, h);
+        }
+    }
+
+private:
+    template <meta::character CharT>
+    constexpr std::uint64_t push(std::uint64_t h, CharT in) const noexcept {
+        return Modulus::add(Modulus::mul(h, base_), detail::unit_value(in));
+    }
+
+    std::size_t window_;
+    std::uint64_t base_;
+    std::uint64_t drop_ = 1;  // base^(window - 1)
+};
+
+using rabin_karp = basic_rabin_karp<mod_mersenne61>;
+using rabin_karp64 = basic_rabin_karp<mod_wrap64>;
+
+// ==================== Gear ====================
+
+namespace detail {
+
+// 256 random words (splitmix64), fixed so chunk boundaries are stable
+inline constexpr auto gear_table = [] {
+    std::array<std::uint64_t, 256> table{};
+    std::uint64_t state = 0x4745415248415348ull;
+    for (auto& entry : table) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        entry = z ^ (z >> 31);
+    }
+    return table;
+}();
+
+} // namespace detail
+
+[[nodiscard]] constexpr std::uint64_t gear_roll(std::uint64_t h, unsigned char byte) noexcept {
+    return (h << 1) + detail::gear_table[byte];
+}
+
+} // namespace zuu::rolling
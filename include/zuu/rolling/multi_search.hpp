@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file zuu/rolling/multi_search.hpp
+ * @brief Rabin-Karp search for many needles of one length at once
+ * @version 3.0.0
+ *
+ * The needles' window hashes go into an open-addressing set; the text is
+ * scanned once with the rolling hash (modulo 2^64, the cheaper roll, since
+ * every hit is verified anyway) and each window is looked up. A 64K-bit
+ * filter on the low hash bits (8 KB, stays in L1) turns away almost every
+ * window before the set is probed, and a hit is confirmed by comparing the
+ * code units, so the cost per text unit hardly grows with the number of
+ * needles until the matches themselves dominate. For one or a few needles, str::find / simd::search are faster.
+ *
+ * Works over anything string-like: fstrings, std::string_view, or a
+ * stream::mapped_file's view().
+ *
+ * Usage:
+ *   rolling::multi_search set(16);                  // needles of 16 units
+ *   for (const auto& id : session_ids) set.add(id);
+ *   set.for_each_match(file.view(), [](std::size_t pos, std::size_t needle) { ... });
+ *   auto [pos, needle] = set.find(line);            // first match, or {npos, npos}
+ */
+
+#include "../meta/concepts.hpp"
+#include "../meta/traits.hpp"
+#include "../str/policy.hpp"
+#include "hash.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zuu::rolling {
+
+template <meta::character CharT>
+class basic_multi_search {
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    /**
+     * @brief Empty set for needles of `length` code units (at least 1)
+     */
+    explicit basic_multi_search(std::size_t length)
+        : roller_{length}, filter_(filter_bits / 64, 0) {}
+
+    /**
+     * @brief Add a needle; returns its id (ids count from 0, an equal
+     *        needle keeps its first id), or npos if its length is wrong
+     */
+    template <meta::string_like Str>
+        requires std::same_as<meta::char_type_of_t<Str>, CharT>
+    std::size_t add(const Str& needle) {
+        const view_type n = str::as_view(needle);
+        if (n.size() != length()) return str::npos;
+
+        const std::uint64_t h = roller_.hash(n.data(), n.size());
+        const std::size_t existing = lookup(h, n.data());
+        if (existing != str::npos) return existing;
+
+        const std::size_t id = size();
+        needles_.append(n);
+        if (2 * (id + 1) > slots_.size()) rehash(std::max<std::size_t>(slots_.size() * 2, 16));
+        place(h, static_cast<std::uint32_t>(id));
+        filter_[filter_slot(h) / 64] |= std::uint64_t{1} << (filter_slot(h) % 64);
+        return id;
+    }
+
+    [[nodiscard]] std::size_t length() const noexcept { return roller_.window(); }
+    [[nodiscard]] std::size_t size() const noexcept { return needles_.size() / length(); }
+    [[nodiscard]] bool empty() const noexcept { return needles_.empty(); }
+
+    [[nodiscard]] view_type needle(std::size_t id) const noexcept {
+        return view_type(needles_).substr(id * length(), length());
+    }
+
+    /**
+     * @brief Call fn(position, needle id) for every occurrence of every
+     *        needle, by position (occurrences may overlap); stops early if
+     *        fn returns false
+     */
+    template <meta::string_like Str, typename Fn>
+        requires std::same_as<meta::char_type_of_t<Str>, CharT>
+    void for_each_match(const Str& text, Fn&& fn) const {
+        if (empty()) return;
+        const view_type t = str::as_view(text);
+        const std::size_t w = length();
+        if (t.size() < w) return;
+
+        const CharT* data = t.data();
+        std::uint64_t h = roller_.hash(data, w);
+        for (std::size_t pos = 0;; ++pos) {
+            if (filter_[filter_slot(h) / 64] >> (filter_slot(h) % 64) & 1) {
+                const std::size_t id = lookup(h, data + pos);
+                if (id != str::npos) {
+                    if constexpr (std::is_same_v<decltype(fn(pos, id)), bool>) {
+                        if (!fn(pos, id)) return;
+                    } else {
+                        fn(pos, id);
+                    }
+                }
+            }
+            if (pos + w == t.size()) break;
+            h = roller_.roll(h, data[pos], data[pos + w]);
+        }
+    }
+
+    // First occurrence of any needle at or after `from`: {position, needle id} or {npos, npos}
+    template <meta::string_like Str>
+        requires std::same_as<meta::char_type_of_t<Str>, CharT>
+    [[nodiscard]] std::pair<std::size_t, std::size_t> find(const Str& text, std::size_t from = 0) const {
+        const view_type t = str::as_view(text);
+        std::pair<std::size_t, std::size_t> found{str::npos, str::npos};
+        if (from > t.size()) return found;
+        for_each_match(t.substr(from), [&](std::size_t pos, std::size_t id) {
+            found = {from + pos, id};
+            return false;
+        });
+        return found;
+    }
+
+    // Number of occurrences of all needles
+    template <meta::string_like Str>
+        requires std::same_as<meta::char_type_of_t<Str>, CharT>
+    [[nodiscard]] std::size_t count(const Str& text) const {
+        std::size_t n = 0;
+        for_each_match(text, [&n](std::size_t, std::size_t) { ++n; });
+        return n;
+    }
+
+private:
+    static constexpr std::size_t filter_bits = std::size_t{1} << 16;
+    static constexpr std::uint64_t filter_mask = filter_bits - 1;
+    static constexpr std::uint32_t empty_slot = ~std::uint32_t{0};
+
+    struct slot {
+        std::uint64_t hash = 0;
+        std::uint32_t id = empty_slot;
+    };
+
+    // Middle bits: the low bits of a wrap-around hash mix poorly
+    static constexpr std::size_t filter_slot(std::uint64_t h) noexcept {
+        return static_cast<std::size_t>((h >> 32) & filter_mask);
+    }
+
+    [[nodiscard]] std::size_t home(std::uint64_t h) const noexcept {
+        return static_cast<std::size_t>(detail::mix64(h)) & (slots_.size() - 1);
+    }
+
+    // Id of the needle equal to the length() units at `units` (hash h), or npos
+    [[nodiscard]] std::size_t lookup(std::uint64_t h, const CharT* units) const noexcept {
+        if (slots_.empty()) return str::npos;
+        for (std::size_t i = home(h); slots_[i].id != empty_slot; i = (i + 1) & (slots_.size() - 1)) {
+            if (slots_[i].hash == h && std::equal(units, units + length(), needles_.data() + slots_[i].id * length())) {
+                return slots_[i].id;
+            }
+        }
+        return str::npos;
+    }
+
+    void place(std::uint64_t h, std::uint32_t id) noexcept {
+        std::size_t i = home(h);
+        while (slots_[i].id != empty_slot) i = (i + 1) & (slots_.size() - 1);
+        slots_[i] = {h, id};
+    }
+
+    void rehash(std::size_t capacity) {
+        std::vector<slot> old(capacity);
+        old.swap(slots_);
+        for (const slot& s : old) {
+            if (s.id != empty_slot) place(s.hash, s.id);
+        }
+    }
+
+    rabin_karp64 roller_;
+    std::basic_string<CharT> needles_;  // needle i at [i * length(), (i + 1) * length())
+    std::vector<slot> slots_;
+    std::vector<std::uint64_t> filter_;
+};
+
+using multi_search = basic_multi_search<char>;
+using wmulti_search = basic_multi_search<wchar_t>;
+using u8multi_search = basic_multi_search<char8_t>;
+using u16multi_search = basic_multi_search<char16_t>;
+using u32multi_search = basic_multi_search<char32_t>;
+
+} // namespace zuu::rolling
@@ -0,0 +1,115 @@
+#pragma once
+
+/**
+ * @file zuu/simd/case.hpp
+ * @brief ASCII case mapping kernels
+ * @version 3.0.0
+ *
+ * Only 'A'-'Z' / 'a'-'z' are mapped; every other code unit (including
+ * non-ASCII UTF-8 bytes and UTF-16/32 code units) is copied unchanged,
+ * matching str::char_to_lower / str::char_to_upper.
+ *
+ * Usage:
+ *   simd::to_lower(out.data(), in.data(), in.size());
+ *   std::size_t at = simd::mismatch_ignore_case(a.data(), b.data(), n);
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+namespace zuu::simd {
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr void map_range_scalar(CharT* dest, const CharT* src, std::size_t n, CharT lo, CharT hi) noexcept {
+    constexpr auto flip = static_cast<CharT>('a' - 'A');
+    for (std::size_t i = 0; i < n; ++i) {
+        const CharT ch = src[i];
+        dest[i] = (ch >= lo && ch <= hi) ? static_cast<CharT>(ch ^ flip) : ch;
+    }
+}
+
+// Flip the case bit (0x20) of every code unit in [lo, hi]
+template <meta::character CharT>
+constexpr void map_range(CharT* dest, const CharT* src, std::size_t n, CharT lo, CharT hi) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<CharT>;
+        const auto below = L::splat(static_cast<CharT>(lo - 1));
+        const auto above = L::splat(static_cast<CharT>(hi + 1));
+        const auto flip = L::splat(static_cast<CharT>('a' - 'A'));
+
+        // Signed compares: code units with the top bit set never fall in range
+        for (; i + L::per_block <= n; i += L::per_block) {
+            const auto block = L::load(src + i);
+            const auto in_range = _mm_and_si128(L::cmpgt(block, below), L::cmpgt(above, block));
+            L::store(dest + i, _mm_xor_si128(block, _mm_and_si128(in_range, flip)));
+        }
+    }
+#endif
+
+    map_range_scalar(dest + i, src + i, n - i, lo, hi);
+}
+
+} // namespace detail
+
+/**
+ * @brief Copy n code units from src to dest, mapping 'A'-'Z' to lower case
+ *
+ * dest may equal src (in-place).
+ */
+template <meta::character CharT>
+constexpr void to_lower(CharT* dest, const CharT* src, std::size_t n) noexcept {
+    detail::map_range(dest, src, n, CharT('A'), CharT('Z'));
+}
+
+/**
+ * @brief Copy n code units from src to dest, mapping 'a'-'z' to upper case
+ */
+template <meta::character CharT>
+constexpr void to_upper(CharT* dest, const CharT* src, std::size_t n) noexcept {
+    detail::map_range(dest, src, n, CharT('a'), CharT('z'));
+}
+
+// ==================== Case-Insensitive Comparison ====================
+
+/**
+ * @brief Index of the first position where lhs and rhs differ after
+ *        mapping 'A'-'Z' to lower case, or n
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::size_t mismatch_ignore_case(const CharT* lhs, const CharT* rhs, std::size_t n) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<CharT>;
+        const auto below = L::splat(CharT('A' - 1));
+        const auto above = L::splat(CharT('Z' + 1));
+        const auto flip = L::splat(CharT('a' - 'A'));
+        auto fold = [&](typename L::block block) {
+            const auto upper = _mm_and_si128(L::cmpgt(block, below), L::cmpgt(above, block));
+            return _mm_or_si128(block, _mm_and_si128(upper, flip));
+        };
+        for (; i + L::per_block <= n; i += L::per_block) {
+            const auto diff = ~L::eq(fold(L::load(lhs + i)), fold(L::load(rhs + i))) & 0xFFFFu;
+            if (diff != 0) return i + static_cast<std::size_t>(std::countr_zero(diff)) / L::width;
+        }
+    }
+#endif
+
+    auto fold = [](CharT ch) { return (ch >= CharT('A') && ch <= CharT('Z')) ? static_cast<CharT>(ch | CharT(0x20)) : ch; };
+    for (; i < n; ++i) {
+        if (fold(lhs[i]) != fold(rhs[i])) return i;
+    }
+    return n;
+}
+
+} // namespace zuu::simd
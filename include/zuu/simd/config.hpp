@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file zuu/simd/config.hpp
+ * @brief Instruction set detection for vectorized kernels
+ * @version 3.0.0
+ * 
+ * Kernels select an implementation from these macros at compile time.
+ * Define ZUU_NO_SIMD before including to force the scalar paths.
+ */
+
+#include <cstddef>
+
+#if !defined(ZUU_NO_SIMD)
+
+#if defined(__AVX2__)
+    #define ZUU_SIMD_AVX2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+    #define ZUU_SIMD_SSSE3 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZUU_SIMD_SSE2 1
+#endif
+
+#endif // ZUU_NO_SIMD
+
+#if defined(ZUU_SIMD_SSE2) || defined(ZUU_SIMD_AVX2)
+    #include <immintrin.h>
+#endif
+
+namespace zuu::simd {
+
+// Widest vector register used by the kernels, in bytes
+#if defined(ZUU_SIMD_AVX2)
+inline constexpr std::size_t vector_width = 32;
+#elif defined(ZUU_SIMD_SSE2)
+inline constexpr std::size_t vector_width = 16;
+#else
+inline constexpr std::size_t vector_width = sizeof(void*);
+#endif
+
+} // namespace zuu::simd
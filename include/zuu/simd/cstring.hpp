@@ -0,0 +1,114 @@
+#pragma once
+
+/**
+ * @file zuu/simd/cstring.hpp
+ * @brief Bounded length and copy kernels for null-terminated input
+ * @version 3.0.0
+ *
+ * Every C-string entry point (constructors, needles, delimiters) measures
+ * its input here. The vector path reads whole aligned 16-byte blocks, which
+ * never straddle a page boundary, so it may look past the terminator (and
+ * before the start) of the input without faulting. 8, 16 and 32-bit code
+ * units share the kernel. Constant evaluation always takes the scalar path.
+ *
+ * Usage:
+ *   std::size_t n = simd::strnlen(argv[1], 64);
+ *   std::size_t n = simd::copy_cstring(buffer, getenv("HOME"), capacity);
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#if defined(__clang__) || defined(__GNUC__)
+    #define ZUU_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+    #define ZUU_NO_SANITIZE_ADDRESS
+#endif
+
+namespace zuu::simd {
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr std::size_t strnlen_scalar(const CharT* str, std::size_t max) noexcept {
+    std::size_t len = 0;
+    while (len < max && str[len] != CharT{}) ++len;
+    return len;
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+// Aligned loads only: code units outside [str, terminator] are read but ignored
+template <meta::character CharT>
+ZUU_NO_SANITIZE_ADDRESS
+inline std::size_t strnlen_vector(const CharT* str, std::size_t max) noexcept {
+    using L = lanes<CharT>;
+    const auto zero = L::splat(CharT{});
+
+    // CharT pointers are CharT-aligned, so the offset is a whole number of lanes
+    const auto offset = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(str) & 15u);
+    const CharT* block = str - offset / L::width;
+
+    // First block: drop the lanes before `str`
+    auto mask = L::eq(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero) >> offset;
+    if (mask != 0) return std::min<std::size_t>(std::countr_zero(mask) / L::width, max);
+
+    std::size_t len = L::per_block - offset / L::width;
+    while (len < max) {
+        block += L::per_block;
+        mask = L::eq(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), zero);
+        if (mask != 0) return std::min<std::size_t>(len + std::countr_zero(mask) / L::width, max);
+        len += L::per_block;
+    }
+    return max;
+}
+
+#endif // ZUU_SIMD_SSE2
+
+} // namespace detail
+
+// ==================== Bounded Length ====================
+
+/**
+ * @brief Length of a null-terminated string, reading at most `max` characters
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::size_t strnlen(
+    const CharT* str,
+    std::size_t max = static_cast<std::size_t>(-1)
+) noexcept {
+    if (!str || max == 0) return 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        return detail::strnlen_vector(str, max);
+    }
+#endif
+    return detail::strnlen_scalar(str, max);
+}
+
+// ==================== Bounded Copy ====================
+
+/**
+ * @brief Copy at most `max` characters of a null-terminated string
+ *
+ * Does not write a terminator.
+ * @return Characters copied
+ */
+template <meta::character CharT>
+constexpr std::size_t copy_cstring(CharT* dest, const CharT* src, std::size_t max) noexcept {
+    if (!src) return 0;
+
+    const std::size_t len = simd::strnlen(src, max);
+    if (len != 0) std::char_traits<CharT>::copy(dest, src, len);
+    return len;
+}
+
+} // namespace zuu::simd
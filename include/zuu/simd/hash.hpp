@@ -0,0 +1,83 @@
+#pragma once
+
+/**
+ * @file zuu/simd/hash.hpp
+ * @brief Word-at-a-time string hash for every character width
+ * @version 3.0.0
+ *
+ * Input is consumed as 64-bit little-endian words, i.e. 8 char, 4 char16_t
+ * or 2 char32_t code units per step, so wide strings do not fall back to a
+ * per-character loop. The result is the same in constant evaluation and at
+ * run time, and equal code-unit sequences hash equally regardless of the
+ * container they live in.
+ *
+ * Usage:
+ *   std::size_t h = simd::hash(str.data(), str.size());
+ */
+
+#include "../meta/concepts.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace zuu::simd {
+
+namespace detail {
+
+inline constexpr std::uint64_t hash_k0 = 0x9E3779B97F4A7C15ull;
+inline constexpr std::uint64_t hash_k1 = 0xC2B2AE3D27D4EB4Full;
+
+constexpr std::uint64_t hash_mix(std::uint64_t h, std::uint64_t word) noexcept {
+    h ^= word * hash_k1;
+    h = std::rotl(h, 31);
+    return h * hash_k0;
+}
+
+// Pack `units` code units (at most one word) little-endian
+template <meta::character CharT>
+constexpr std::uint64_t load_word(const CharT* p, std::size_t units) noexcept {
+    std::uint64_t word = 0;
+
+    if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+        std::memcpy(&word, p, units * sizeof(CharT));
+        return word;
+    }
+
+    using unit = std::make_unsigned_t<CharT>;
+    for (std::size_t i = 0; i < units; ++i) {
+        word |= static_cast<std::uint64_t>(static_cast<unit>(p[i])) << (8 * sizeof(CharT) * i);
+    }
+    return word;
+}
+
+} // namespace detail
+
+/**
+ * @brief Hash n code units starting at data
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::size_t hash(const CharT* data, std::size_t n) noexcept {
+    constexpr std::size_t per_word = sizeof(std::uint64_t) / sizeof(CharT);
+
+    std::uint64_t h = detail::hash_k0 ^ (n * sizeof(CharT));
+    std::size_t i = 0;
+
+    for (; i + per_word <= n; i += per_word) {
+        h = detail::hash_mix(h, detail::load_word(data + i, per_word));
+    }
+    if (i < n) {
+        h = detail::hash_mix(h, detail::load_word(data + i, n - i));
+    }
+
+    // Final avalanche (murmur3 fmix64)
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+}
+
+} // namespace zuu::simd
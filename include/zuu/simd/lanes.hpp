@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * @file zuu/simd/lanes.hpp
+ * @brief Lane-width dispatch for 8, 16 and 32-bit character kernels
+ * @version 3.0.0
+ *
+ * Kernels are written once against lanes<CharT> and work for char,
+ * char8_t, char16_t, char32_t and wchar_t alike. Masks returned by
+ * `eq` and friends are byte masks (one bit per byte, as produced by
+ * movemask_epi8), so a matching lane sets `width` consecutive bits:
+ * the lane index is countr_zero(mask) / width.
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace zuu::simd {
+
+#if defined(ZUU_SIMD_SSE2)
+
+template <meta::character CharT>
+struct lanes {
+    static constexpr std::size_t width = sizeof(CharT);
+    static constexpr std::size_t per_block = 16 / width;  // lanes per 16-byte block
+
+    using block = __m128i;
+
+    static block load(const CharT* p) noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static void store(CharT* p, block v) noexcept {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+
+    static block splat(CharT ch) noexcept {
+        if constexpr (width == 1) return _mm_set1_epi8(static_cast<char>(ch));
+        else if constexpr (width == 2) return _mm_set1_epi16(static_cast<short>(ch));
+        else return _mm_set1_epi32(static_cast<int>(ch));
+    }
+
+    static block cmpeq(block a, block b) noexcept {
+        if constexpr (width == 1) return _mm_cmpeq_epi8(a, b);
+        else if constexpr (width == 2) return _mm_cmpeq_epi16(a, b);
+        else return _mm_cmpeq_epi32(a, b);
+    }
+
+    // Signed lane compare; code units with the top bit set compare below 0
+    static block cmpgt(block a, block b) noexcept {
+        if constexpr (width == 1) return _mm_cmpgt_epi8(a, b);
+        else if constexpr (width == 2) return _mm_cmpgt_epi16(a, b);
+        else return _mm_cmpgt_epi32(a, b);
+    }
+
+    static std::uint32_t mask(block v) noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(v));
+    }
+
+    static std::uint32_t eq(block a, block b) noexcept { return mask(cmpeq(a, b)); }
+
+    // Four blocks (64 bytes) at once: byte mask of lanes equal to `needle`.
+    // The blocks are told apart only after the combined test hits.
+    static std::uint64_t eq4(const CharT* p, block needle) noexcept {
+        const block a = cmpeq(load(p), needle);
+        const block b = cmpeq(load(p + per_block), needle);
+        const block c = cmpeq(load(p + 2 * per_block), needle);
+        const block d = cmpeq(load(p + 3 * per_block), needle);
+        if (mask(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) == 0) return 0;
+        return combine(mask(a), mask(b), mask(c), mask(d));
+    }
+
+    // Four blocks at once: byte mask of lanes where lhs and rhs differ
+    static std::uint64_t neq4(const CharT* lhs, const CharT* rhs) noexcept {
+        const block a = cmpeq(load(lhs), load(rhs));
+        const block b = cmpeq(load(lhs + per_block), load(rhs + per_block));
+        const block c = cmpeq(load(lhs + 2 * per_block), load(rhs + 2 * per_block));
+        const block d = cmpeq(load(lhs + 3 * per_block), load(rhs + 3 * per_block));
+        if (mask(_mm_and_si128(_mm_and_si128(a, b), _mm_and_si128(c, d))) == 0xFFFFu) return 0;
+        return ~combine(mask(a), mask(b), mask(c), mask(d));
+    }
+
+    static std::uint64_t combine(std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d) noexcept {
+        return std::uint64_t{a} | (std::uint64_t{b} << 16) | (std::uint64_t{c} << 32) | (std::uint64_t{d} << 48);
+    }
+
+    // Byte mask covering lanes [0, count) of a block
+    static constexpr std::uint32_t first_lanes(std::size_t count) noexcept {
+        return count >= per_block ? 0xFFFFu : ((1u << (count * width)) - 1u);
+    }
+};
+
+#if defined(ZUU_SIMD_AVX2)
+
+template <meta::character CharT>
+struct wide_lanes {
+    static constexpr std::size_t width = sizeof(CharT);
+    static constexpr std::size_t per_block = 32 / width;
+
+    using block = __m256i;
+
+    static block load(const CharT* p) noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static block splat(CharT ch) noexcept {
+        if constexpr (width == 1) return _mm256_set1_epi8(static_cast<char>(ch));
+        else if constexpr (width == 2) return _mm256_set1_epi16(static_cast<short>(ch));
+        else return _mm256_set1_epi32(static_cast<int>(ch));
+    }
+
+    static block cmpeq(block a, block b) noexcept {
+        if constexpr (width == 1) return _mm256_cmpeq_epi8(a, b);
+        else if constexpr (width == 2) return _mm256_cmpeq_epi16(a, b);
+        else return _mm256_cmpeq_epi32(a, b);
+    }
+
+    static std::uint32_t mask(block v) noexcept {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(v));
+    }
+
+    static std::uint32_t eq(block a, block b) noexcept { return mask(cmpeq(a, b)); }
+};
+
+#endif // ZUU_SIMD_AVX2
+
+#endif // ZUU_SIMD_SSE2
+
+} // namespace zuu::simd
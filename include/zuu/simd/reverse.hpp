@@ -0,0 +1,169 @@
+#pragma once
+
+/**
+ * @file zuu/simd/reverse.hpp
+ * @brief Reverse and rotate kernels
+ * @version 3.0.0
+ *
+ * Blocks are reversed lane-wise in registers: PSHUFB (SSSE3) or
+ * VPSHUFB + VPERMQ (AVX2) for bytes, and plain SSE2 shuffles otherwise.
+ * Multi-byte code units keep their byte order, so UTF-16/32 code units
+ * stay intact (surrogate pairs and combining sequences are not kept
+ * together; this is a code-unit reverse like std::reverse).
+ *
+ * Usage:
+ *   simd::reverse(s.data(), s.size());
+ *   simd::rotate(s.data(), s.size(), 3);
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace zuu::simd {
+
+namespace detail {
+
+#if defined(ZUU_SIMD_SSE2)
+
+// Reverse the lanes of one 16-byte block
+template <meta::character CharT>
+inline __m128i reverse_block(__m128i v) noexcept {
+    if constexpr (sizeof(CharT) == 4) {
+        return _mm_shuffle_epi32(v, 0x1B);
+    } else if constexpr (sizeof(CharT) == 2) {
+        v = _mm_shufflelo_epi16(v, 0x1B);
+        v = _mm_shufflehi_epi16(v, 0x1B);
+        return _mm_shuffle_epi32(v, 0x4E);
+    } else {
+#if defined(ZUU_SIMD_SSSE3)
+        return _mm_shuffle_epi8(v, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+        // Reverse 16-bit lanes, then swap the bytes inside each
+        v = reverse_block<char16_t>(v);
+        return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+#endif
+    }
+}
+
+#if defined(ZUU_SIMD_AVX2)
+
+// Reverse the lanes of one 32-byte block
+template <meta::character CharT>
+inline __m256i reverse_block(__m256i v) noexcept {
+    // Byte shuffle inside each 128-bit half, then swap the halves
+    constexpr std::size_t w = sizeof(CharT);
+    alignas(32) static constexpr auto mask = [] {
+        struct { char bytes[32]; } m{};
+        for (std::size_t j = 0; j < 32; ++j) {
+            const std::size_t in_half = j % 16;
+            m.bytes[j] = static_cast<char>((16 / w - 1 - in_half / w) * w + in_half % w);
+        }
+        return m;
+    }();
+    v = _mm256_shuffle_epi8(v, _mm256_load_si256(reinterpret_cast<const __m256i*>(mask.bytes)));
+    return _mm256_permute4x64_epi64(v, 0x4E);
+}
+
+#endif // ZUU_SIMD_AVX2
+
+#endif // ZUU_SIMD_SSE2
+
+} // namespace detail
+
+// ==================== Reverse ====================
+
+/**
+ * @brief Reverse data[0, n) in place
+ */
+template <meta::character CharT>
+constexpr void reverse(CharT* data, std::size_t n) noexcept {
+    std::size_t lo = 0;
+    std::size_t hi = n;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        // Swap a block from each end until they would overlap
+#if defined(ZUU_SIMD_AVX2)
+        using W = wide_lanes<CharT>;
+        for (; hi - lo >= 2 * W::per_block; lo += W::per_block, hi -= W::per_block) {
+            const auto head = W::load(data + lo);
+            const auto tail = W::load(data + hi - W::per_block);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + lo), detail::reverse_block<CharT>(tail));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + hi - W::per_block), detail::reverse_block<CharT>(head));
+        }
+#endif
+        using L = lanes<CharT>;
+        for (; hi - lo >= 2 * L::per_block; lo += L::per_block, hi -= L::per_block) {
+            const auto head = L::load(data + lo);
+            const auto tail = L::load(data + hi - L::per_block);
+            L::store(data + lo, detail::reverse_block<CharT>(tail));
+            L::store(data + hi - L::per_block, detail::reverse_block<CharT>(head));
+        }
+    }
+#endif
+
+    std::reverse(data + lo, data + hi);
+}
+
+/**
+ * @brief Write src[0, n) reversed to dest (the ranges must not overlap)
+ */
+template <meta::character CharT>
+constexpr void reverse_copy(CharT* dest, const CharT* src, std::size_t n) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+#if defined(ZUU_SIMD_AVX2)
+        using W = wide_lanes<CharT>;
+        for (; i + W::per_block <= n; i += W::per_block) {
+            const auto block = W::load(src + n - i - W::per_block);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), detail::reverse_block<CharT>(block));
+        }
+#endif
+        using L = lanes<CharT>;
+        for (; i + L::per_block <= n; i += L::per_block) {
+            L::store(dest + i, detail::reverse_block<CharT>(L::load(src + n - i - L::per_block)));
+        }
+    }
+#endif
+
+    for (; i < n; ++i) dest[i] = src[n - 1 - i];
+}
+
+// ==================== Rotate ====================
+
+/**
+ * @brief Rotate data[0, n) left by k (data[k] becomes the first element)
+ *
+ * Three reversals: no scratch buffer, every pass vectorized.
+ */
+template <meta::character CharT>
+constexpr void rotate(CharT* data, std::size_t n, std::size_t k) noexcept {
+    if (n == 0) return;
+    k %= n;
+    if (k == 0) return;
+
+    simd::reverse(data, k);
+    simd::reverse(data + k, n - k);
+    simd::reverse(data, n);
+}
+
+/**
+ * @brief Write src[0, n) rotated left by k to dest (the ranges must not overlap)
+ */
+template <meta::character CharT>
+constexpr void rotate_copy(CharT* dest, const CharT* src, std::size_t n, std::size_t k) noexcept {
+    if (n == 0) return;
+    k %= n;
+
+    std::char_traits<CharT>::copy(dest, src + k, n - k);
+    std::char_traits<CharT>::copy(dest + n - k, src, k);
+}
+
+} // namespace zuu::simd
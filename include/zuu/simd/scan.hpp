@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file zuu/simd/scan.hpp
+ * @brief Bitmap scan for every delimiter of a buffer, optionally quote-aware
+ * @version 3.0.0
+ *
+ * Instead of one search per record, 64 bytes at a time are turned into a
+ * bitmap of delimiter positions which is then walked bit by bit, so short
+ * records cost a few instructions each. In quote-aware mode the bitmap of
+ * quote characters is prefix-XORed to mark the bytes inside quotes, with
+ * the state carried from one 64-byte block to the next.
+ *
+ * Usage:
+ *   std::size_t quotes = simd::count_char(first, last, '"');
+ *   simd::for_each_delimiter(first, last, '\n', [&](const char* eol) { ... });
+ *   simd::for_each_delimiter(first, last, '\n', '"', [&](const char* eol) { ... });
+ */
+
+#include "config.hpp"
+#include "lanes.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu::simd {
+
+/**
+ * @brief Bit i of the result is the XOR of bits [0, i] of x
+ */
+[[nodiscard]] constexpr std::uint64_t prefix_xor(std::uint64_t x) noexcept {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+namespace detail {
+
+template <bool QuoteAware, typename Fn>
+constexpr void for_each_delimiter_scalar(const char* first, const char* last, char delim, char quote,
+                                         bool& in_quotes, Fn& fn) {
+    for (; first != last; ++first) {
+        if constexpr (QuoteAware) {
+            if (*first == quote) {
+                in_quotes = !in_quotes;
+                continue;
+            }
+            if (in_quotes) continue;
+        }
+        if (*first == delim) fn(first);
+    }
+}
+
+template <bool QuoteAware, typename Fn>
+constexpr void for_each_delimiter(const char* first, const char* last, char delim, char quote, Fn& fn) {
+    bool in_quotes = false;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<char>;
+        const auto delims = L::splat(delim);
+        const auto quotes = L::splat(quote);
+        std::uint64_t inside_carry = 0;  // all ones while inside quotes
+
+        auto bitmap = [](const char* p, typename L::block needle) {
+            return L::combine(L::eq(L::load(p), needle), L::eq(L::load(p + 16), needle),
+                              L::eq(L::load(p + 32), needle), L::eq(L::load(p + 48), needle));
+        };
+
+        for (; last - first >= 64; first += 64) {
+            std::uint64_t hits = bitmap(first, delims);
+
+            if constexpr (QuoteAware) {
+                const std::uint64_t inside = prefix_xor(bitmap(first, quotes)) ^ inside_carry;
+                inside_carry = static_cast<std::uint64_t>(static_cast<std::int64_t>(inside) >> 63);
+                hits &= ~inside;
+            }
+
+            for (; hits != 0; hits &= hits - 1) fn(first + std::countr_zero(hits));
+        }
+
+        in_quotes = inside_carry != 0;
+    }
+#endif
+
+    for_each_delimiter_scalar<QuoteAware>(first, last, delim, quote, in_quotes, fn);
+}
+
+} // namespace detail
+
+/**
+ * @brief Number of occurrences of ch in [first, last)
+ */
+[[nodiscard]] constexpr std::size_t count_char(const char* first, const char* last, char ch) noexcept {
+    std::size_t n = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<char>;
+        const auto needle = L::splat(ch);
+        for (; last - first >= 64; first += 64) {
+            n += static_cast<std::size_t>(std::popcount(L::eq4(first, needle)));
+        }
+    }
+#endif
+
+    for (; first != last; ++first) n += *first == ch;
+    return n;
+}
+
+/**
+ * @brief Call fn(p) for every p in [first, last) with *p == delim, in order
+ */
+template <typename Fn>
+constexpr void for_each_delimiter(const char* first, const char* last, char delim, Fn&& fn) {
+    detail::for_each_delimiter<false>(first, last, delim, delim, fn);
+}
+
+/**
+ * @brief Call fn(p) for every delimiter outside `quote` pairs, in order
+ *
+ * [first, last) must start outside quotes. A doubled quote ("") toggles
+ * twice and so stays inside the quoted field.
+ */
+template <typename Fn>
+constexpr void for_each_delimiter(const char* first, const char* last, char delim, char quote, Fn&& fn) {
+    detail::for_each_delimiter<true>(first, last, delim, quote, fn);
+}
+
+} // namespace zuu::simd
@@ -0,0 +1,367 @@
+#pragma once
+
+/**
+ * @file zuu/simd/search.hpp
+ * @brief Vectorized character search kernels (memchr / memrchr style)
+ * @version 3.0.0
+ *
+ * All kernels take a half-open range [first, last) and return `last`
+ * when nothing is found. Constant evaluation always takes the scalar path.
+ *
+ * Every kernel handles 8, 16 and 32-bit code units (see lanes.hpp).
+ *
+ * Usage:
+ *   auto it = simd::find_char(s.begin(), s.end(), ',');
+ *   auto it = simd::rfind_char(s.begin(), s.end(), '/');
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace zuu::simd {
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr const CharT* find_char_scalar(const CharT* first, const CharT* last, CharT ch) noexcept {
+    for (; first != last; ++first) {
+        if (*first == ch) return first;
+    }
+    return last;
+}
+
+template <meta::character CharT>
+constexpr const CharT* rfind_char_scalar(const CharT* first, const CharT* last, CharT ch) noexcept {
+    for (const CharT* it = last; it != first; --it) {
+        if (it[-1] == ch) return it - 1;
+    }
+    return last;
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+template <meta::character CharT>
+inline const CharT* find_char_vector(const CharT* first, const CharT* last, CharT ch) noexcept {
+    using L = lanes<CharT>;
+    const auto needle = L::splat(ch);
+
+#if defined(ZUU_SIMD_AVX2)
+    using W = wide_lanes<CharT>;
+    const auto needle32 = W::splat(ch);
+    while (static_cast<std::size_t>(last - first) >= 2 * W::per_block) {
+        const auto a = W::cmpeq(W::load(first), needle32);
+        const auto b = W::cmpeq(W::load(first + W::per_block), needle32);
+        if (W::mask(_mm256_or_si256(a, b)) != 0) {
+            const auto mask = std::uint64_t{W::mask(a)} | (std::uint64_t{W::mask(b)} << 32);
+            return first + std::countr_zero(mask) / W::width;
+        }
+        first += 2 * W::per_block;
+    }
+#else
+    while (static_cast<std::size_t>(last - first) >= 4 * L::per_block) {
+        if (const auto mask = L::eq4(first, needle); mask != 0) {
+            return first + std::countr_zero(mask) / L::width;
+        }
+        first += 4 * L::per_block;
+    }
+#endif
+
+    while (static_cast<std::size_t>(last - first) >= L::per_block) {
+        const auto mask = L::eq(L::load(first), needle);
+        if (mask != 0) return first + std::countr_zero(mask) / L::width;
+        first += L::per_block;
+    }
+
+    return find_char_scalar(first, last, ch);
+}
+
+template <meta::character CharT>
+inline const CharT* rfind_char_vector(const CharT* first, const CharT* last, CharT ch) noexcept {
+    using L = lanes<CharT>;
+    const auto needle = L::splat(ch);
+    const CharT* end = last;
+
+#if defined(ZUU_SIMD_AVX2)
+    using W = wide_lanes<CharT>;
+    const auto needle32 = W::splat(ch);
+    while (static_cast<std::size_t>(end - first) >= W::per_block) {
+        const auto mask = W::eq(W::load(end - W::per_block), needle32);
+        if (mask != 0) return end - W::per_block + (std::bit_width(mask) - 1) / W::width;
+        end -= W::per_block;
+    }
+#endif
+
+    while (static_cast<std::size_t>(end - first) >= L::per_block) {
+        const auto mask = L::eq(L::load(end - L::per_block), needle);
+        if (mask != 0) return end - L::per_block + (std::bit_width(mask) - 1) / L::width;
+        end -= L::per_block;
+    }
+
+    const CharT* found = rfind_char_scalar(first, end, ch);
+    return found == end ? last : found;
+}
+
+#endif // ZUU_SIMD_SSE2
+
+} // namespace detail
+
+// ==================== Forward Search ====================
+
+/**
+ * @brief First occurrence of `ch` in [first, last), or `last`
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* find_char(
+    const CharT* first,
+    const CharT* last,
+    CharT ch
+) noexcept {
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        return detail::find_char_vector(first, last, ch);
+    }
+#endif
+    return detail::find_char_scalar(first, last, ch);
+}
+
+// ==================== Reverse Search ====================
+
+/**
+ * @brief Last occurrence of `ch` in [first, last), or `last`
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* rfind_char(
+    const CharT* first,
+    const CharT* last,
+    CharT ch
+) noexcept {
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        return detail::rfind_char_vector(first, last, ch);
+    }
+#endif
+    return detail::rfind_char_scalar(first, last, ch);
+}
+
+// ==================== Padded-Buffer Kernels ====================
+
+/**
+ * These kernels load whole 16-byte blocks up to round_up(n, 16 bytes) and
+ * mask off lanes past `n`, so there is no scalar tail. The caller must
+ * guarantee those bytes are readable (see storage_policy::padded).
+ */
+
+/**
+ * @brief Index of the first `ch` in data[from, n), or n
+ *
+ * Blocks are taken relative to `data`, so a non-zero `from` never reads
+ * past round_up(n, 16 bytes).
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::size_t find_char_padded(
+    const CharT* data,
+    std::size_t n,
+    CharT ch,
+    std::size_t from = 0
+) noexcept {
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<CharT>;
+        const auto needle = L::splat(ch);
+
+        // First block may start before `from`
+        std::size_t i = from / L::per_block * L::per_block;
+        const auto head = L::eq(L::load(data + i), needle) & L::first_lanes(n - i) & ~L::first_lanes(from - i);
+        if (head != 0) return i + std::countr_zero(head) / L::width;
+        i += L::per_block;
+
+        for (; i + 4 * L::per_block <= n; i += 4 * L::per_block) {
+            if (const auto mask = L::eq4(data + i, needle); mask != 0) {
+                return i + std::countr_zero(mask) / L::width;
+            }
+        }
+
+        // Tail: whole blocks, lanes past n masked off
+        for (; i < n; i += L::per_block) {
+            const auto mask = L::eq(L::load(data + i), needle) & L::first_lanes(n - i);
+            if (mask != 0) return i + std::countr_zero(mask) / L::width;
+        }
+        return n;
+    }
+#endif
+    return static_cast<std::size_t>(detail::find_char_scalar(data + from, data + n, ch) - data);
+}
+
+/**
+ * @brief Whether lhs[0, n) and rhs[0, n) are equal
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr bool equal_padded(
+    const CharT* lhs,
+    const CharT* rhs,
+    std::size_t n
+) noexcept {
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        using L = lanes<CharT>;
+        std::size_t i = 0;
+
+        for (; i + 4 * L::per_block <= n; i += 4 * L::per_block) {
+            if (L::neq4(lhs + i, rhs + i) != 0) return false;
+        }
+        for (; i < n; i += L::per_block) {
+            const auto diff = ~L::eq(L::load(lhs + i), L::load(rhs + i)) & L::first_lanes(n - i);
+            if (diff != 0) return false;
+        }
+        return true;
+    }
+#endif
+    for (std::size_t i = 0; i < n; ++i) {
+        if (lhs[i] != rhs[i]) return false;
+    }
+    return true;
+}
+
+// ==================== Comparison ====================
+
+/**
+ * @brief Index of the first position where lhs and rhs differ, or n
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::size_t mismatch(
+    const CharT* lhs,
+    const CharT* rhs,
+    std::size_t n
+) noexcept {
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    // Short inputs skip the block loads outright; for a literal needle (n a
+    // constant) they are then provably dead and -Warray-bounds stays quiet
+    if (!std::is_constant_evaluated() && n >= lanes<CharT>::per_block) {
+        using L = lanes<CharT>;
+        for (; i + 4 * L::per_block <= n; i += 4 * L::per_block) {
+            if (const auto diff = L::neq4(lhs + i, rhs + i); diff != 0) {
+                return i + std::countr_zero(diff) / L::width;
+            }
+        }
+        for (; i + L::per_block <= n; i += L::per_block) {
+            const auto diff = ~L::eq(L::load(lhs + i), L::load(rhs + i)) & 0xFFFFu;
+            if (diff != 0) return i + std::countr_zero(diff) / L::width;
+        }
+    }
+#endif
+
+    for (; i < n; ++i) {
+        if (lhs[i] != rhs[i]) return i;
+    }
+    return n;
+}
+
+/**
+ * @brief Three-way lexicographic comparison of [lhs, lhs + n) and [rhs, rhs + n)
+ *
+ * Code units compare as unsigned, like std::char_traits.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr int compare(const CharT* lhs, const CharT* rhs, std::size_t n) noexcept {
+    const std::size_t at = simd::mismatch(lhs, rhs, n);
+    if (at == n) return 0;
+    return std::char_traits<CharT>::lt(lhs[at], rhs[at]) ? -1 : 1;
+}
+
+// ==================== Character Sets ====================
+
+namespace detail {
+
+// Sets up to this size are matched with one broadcast compare per member
+inline constexpr std::size_t max_vector_charset = 16;
+
+#if defined(ZUU_SIMD_SSE2)
+
+template <meta::character CharT, bool Member>
+inline const CharT* find_in_set_vector(
+    const CharT* first,
+    const CharT* last,
+    const CharT* set,
+    std::size_t set_size
+) noexcept {
+    using L = lanes<CharT>;
+    typename L::block members[max_vector_charset];
+    for (std::size_t k = 0; k < set_size; ++k) members[k] = L::splat(set[k]);
+
+    for (; static_cast<std::size_t>(last - first) >= L::per_block; first += L::per_block) {
+        const auto block = L::load(first);
+        auto hits = _mm_setzero_si128();
+        for (std::size_t k = 0; k < set_size; ++k) {
+            hits = _mm_or_si128(hits, L::cmpeq(block, members[k]));
+        }
+
+        auto mask = L::mask(hits);
+        if constexpr (!Member) mask = ~mask & 0xFFFFu;
+        if (mask != 0) return first + std::countr_zero(mask) / L::width;
+    }
+
+    for (; first != last; ++first) {
+        if ((find_char_scalar(set, set + set_size, *first) != set + set_size) == Member) return first;
+    }
+    return last;
+}
+
+#endif // ZUU_SIMD_SSE2
+
+template <bool Member, meta::character CharT>
+constexpr const CharT* find_in_set(
+    const CharT* first,
+    const CharT* last,
+    const CharT* set,
+    std::size_t set_size
+) noexcept {
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated() && set_size <= max_vector_charset) {
+        return find_in_set_vector<CharT, Member>(first, last, set, set_size);
+    }
+#endif
+    for (; first != last; ++first) {
+        if ((find_char_scalar(set, set + set_size, *first) != set + set_size) == Member) return first;
+    }
+    return last;
+}
+
+} // namespace detail
+
+/**
+ * @brief First character of [first, last) that is in [set, set + set_size), or `last`
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* find_first_of(
+    const CharT* first,
+    const CharT* last,
+    const CharT* set,
+    std::size_t set_size
+) noexcept {
+    if (set_size == 0) return last;
+    return detail::find_in_set<true>(first, last, set, set_size);
+}
+
+/**
+ * @brief First character of [first, last) that is not in the set, or `last`
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* find_first_not_of(
+    const CharT* first,
+    const CharT* last,
+    const CharT* set,
+    std::size_t set_size
+) noexcept {
+    if (set_size == 0) return first;
+    return detail::find_in_set<false>(first, last, set, set_size);
+}
+
+} // namespace zuu::simd
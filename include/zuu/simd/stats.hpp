@@ -0,0 +1,281 @@
+#pragma once
+
+/**
+ * @file zuu/simd/stats.hpp
+ * @brief Character-class counting and byte histogram kernels
+ * @version 3.0.0
+ *
+ * count_classes() tests every code unit against all classes in one pass
+ * (range compares accumulated in per-lane byte counters; wider code units
+ * are narrowed to bytes first). byte_histogram() spreads its increments
+ * over four sub-histograms so that runs of the same byte do not serialize
+ * on store-to-load forwarding of a single counter.
+ *
+ * Classes are ASCII-based for every character type: code units >= 0x80
+ * count as non_ascii and belong to no other class.
+ *
+ * Usage:
+ *   auto counts = simd::count_classes(s.data(), s.size());
+ *   simd::byte_histogram(s.data(), s.size(), table);
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu::simd {
+
+// ==================== Class Counts ====================
+
+struct class_counts {
+    std::size_t total{};
+    std::size_t ascii{};
+    std::size_t digit{};      // '0'-'9'
+    std::size_t alpha{};      // 'A'-'Z', 'a'-'z'
+    std::size_t space{};      // ' ', '\t', '\n', '\v', '\f', '\r'
+    std::size_t control{};    // 0x00-0x1F, 0x7F (includes \t, \n, ...)
+    std::size_t non_ascii{};  // >= 0x80: UTF-8 bytes, non-ASCII UTF-16/32 units
+
+    constexpr class_counts& operator+=(const class_counts& rhs) noexcept {
+        total += rhs.total;
+        ascii += rhs.ascii;
+        digit += rhs.digit;
+        alpha += rhs.alpha;
+        space += rhs.space;
+        control += rhs.control;
+        non_ascii += rhs.non_ascii;
+        return *this;
+    }
+
+    constexpr bool operator==(const class_counts&) const noexcept = default;
+
+    [[nodiscard]] constexpr bool is_ascii() const noexcept { return non_ascii == 0; }
+    [[nodiscard]] constexpr bool has_control() const noexcept { return control != 0; }
+
+    // Share of all code units, e.g. counts.ratio(counts.digit)
+    [[nodiscard]] constexpr double ratio(std::size_t count) const noexcept {
+        return total == 0 ? 0.0 : static_cast<double>(count) / static_cast<double>(total);
+    }
+};
+
+namespace detail {
+
+// Unsigned code unit value
+template <meta::character CharT>
+constexpr std::uint32_t unit_value(CharT ch) noexcept {
+    return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<CharT>>(ch));
+}
+
+constexpr void count_class_of(class_counts& counts, std::uint32_t u, std::size_t times = 1) noexcept {
+    if (u >= 0x80) {
+        counts.non_ascii += times;
+        return;
+    }
+
+    counts.ascii += times;
+    if (u >= '0' && u <= '9') counts.digit += times;
+    if ((u | 0x20) >= 'a' && (u | 0x20) <= 'z') counts.alpha += times;
+    if (u == ' ' || (u >= '\t' && u <= '\r')) counts.space += times;
+    if (u < 0x20 || u == 0x7F) counts.control += times;
+}
+
+template <meta::character CharT>
+constexpr void count_classes_scalar(class_counts& counts, const CharT* data, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) count_class_of(counts, unit_value(data[i]));
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+// Per-lane byte counters: a matching lane is all ones (-1), so subtracting
+// the compare mask counts it. Folded into size_t before a lane can wrap.
+struct lane_counter {
+    static constexpr std::size_t max_blocks = 255;
+
+    __m128i acc = _mm_setzero_si128();
+
+    void add(__m128i mask) noexcept { acc = _mm_sub_epi8(acc, mask); }
+
+    std::size_t fold() noexcept {
+        const __m128i sums = _mm_sad_epu8(acc, _mm_setzero_si128());  // two 64-bit sums
+        acc = _mm_setzero_si128();
+
+        alignas(16) std::uint64_t parts[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(parts), sums);
+        return static_cast<std::size_t>(parts[0] + parts[1]);
+    }
+};
+
+// 16 code units as bytes; units outside [0, 0x7F] become 0x80 so that the
+// byte classifier sees them as non-ASCII
+template <meta::character CharT>
+inline __m128i load_narrow(const CharT* p) noexcept {
+    using L = lanes<CharT>;
+
+    if constexpr (L::width == 1) {
+        return L::load(p);
+    } else {
+        const __m128i below = L::splat(CharT(-1));
+        const __m128i above = L::splat(CharT(0x80));
+
+        auto clamp = [&](const CharT* q) {
+            const __m128i v = L::load(q);
+            const __m128i ascii = _mm_and_si128(L::cmpgt(v, below), L::cmpgt(above, v));
+            return _mm_or_si128(_mm_and_si128(ascii, v), _mm_andnot_si128(ascii, above));
+        };
+
+        if constexpr (L::width == 2) {
+            return _mm_packus_epi16(clamp(p), clamp(p + 8));
+        } else {
+            return _mm_packus_epi16(_mm_packs_epi32(clamp(p), clamp(p + 4)),
+                                    _mm_packs_epi32(clamp(p + 8), clamp(p + 12)));
+        }
+    }
+}
+
+template <meta::character CharT>
+inline std::size_t count_classes_vector(class_counts& counts, const CharT* data, std::size_t n) noexcept {
+    constexpr std::size_t step = 16;  // code units per narrowed block
+
+    // Range test in two ops: shift [lo, lo + len) to the bottom of the
+    // signed byte range, then one signed compare. Bytes >= 0x80 never match.
+    struct range {
+        __m128i bias, limit;
+
+        range(int lo, int len) noexcept
+            : bias(_mm_set1_epi8(static_cast<char>(0x80 - lo))),
+              limit(_mm_set1_epi8(static_cast<char>(-128 + len))) {}
+
+        __m128i operator()(__m128i v) const noexcept {
+            return _mm_cmpgt_epi8(limit, _mm_add_epi8(v, bias));
+        }
+    };
+
+    const range digits('0', 10), letters('a', 26), spaces('\t', 5), controls(0, 0x20);
+    const __m128i neg = _mm_set1_epi8(-1);
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    const __m128i blank = _mm_set1_epi8(' ');
+    const __m128i del = _mm_set1_epi8(0x7F);
+
+    lane_counter ascii, digit, alpha, space, control;
+    std::size_t ascii_total = 0;
+    std::size_t i = 0;
+
+    while (i + step <= n) {
+        const std::size_t blocks = std::min((n - i) / step, lane_counter::max_blocks);
+
+        for (std::size_t b = 0; b < blocks; ++b, i += step) {
+            const __m128i v = load_narrow(data + i);
+
+            ascii.add(_mm_cmpgt_epi8(v, neg));
+            digit.add(digits(v));
+            alpha.add(letters(_mm_or_si128(v, case_bit)));
+            space.add(_mm_or_si128(_mm_cmpeq_epi8(v, blank), spaces(v)));
+            control.add(_mm_or_si128(controls(v), _mm_cmpeq_epi8(v, del)));
+        }
+
+        ascii_total += ascii.fold();
+        counts.digit += digit.fold();
+        counts.alpha += alpha.fold();
+        counts.space += space.fold();
+        counts.control += control.fold();
+    }
+
+    counts.ascii += ascii_total;
+    counts.non_ascii += i - ascii_total;
+    return i;
+}
+
+#endif // ZUU_SIMD_SSE2
+
+} // namespace detail
+
+/**
+ * @brief Count code units per character class in one pass
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr class_counts count_classes(const CharT* data, std::size_t n) noexcept {
+    class_counts counts;
+    counts.total = n;
+    std::size_t i = 0;
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated()) {
+        i = detail::count_classes_vector(counts, data, n);
+    }
+#endif
+
+    detail::count_classes_scalar(counts, data + i, n - i);
+    return counts;
+}
+
+// ==================== Histogram ====================
+
+/**
+ * @brief Occurrences of each code unit value below 256
+ *
+ * For char16_t/char32_t/wchar_t, units >= 256 are not tabulated.
+ */
+using histogram = std::array<std::size_t, 256>;
+
+/**
+ * @brief Add the code units of data[0, n) to `table`
+ */
+template <meta::character CharT>
+constexpr void byte_histogram(const CharT* data, std::size_t n, histogram& table) noexcept {
+    // Four interleaved sub-histograms; 32-bit counters are flushed before
+    // they could wrap
+    constexpr std::size_t flush_every = std::size_t{1} << 30;
+    std::array<std::array<std::uint32_t, 256>, 4> sub{};
+
+    auto flush = [&] {
+        for (std::size_t v = 0; v < 256; ++v) {
+            table[v] += std::size_t{sub[0][v]} + sub[1][v] + sub[2][v] + sub[3][v];
+        }
+        sub = {};
+    };
+
+    auto add = [&sub](std::size_t lane, CharT ch) {
+        const std::uint32_t u = detail::unit_value(ch);
+        if constexpr (sizeof(CharT) == 1) {
+            ++sub[lane][u];
+        } else if (u < 256) {
+            ++sub[lane][u];
+        }
+    };
+
+    std::size_t i = 0;
+    while (i < n) {
+        const std::size_t chunk_end = i + std::min(n - i, flush_every);
+
+        for (; i + 4 <= chunk_end; i += 4) {
+            add(0, data[i]);
+            add(1, data[i + 1]);
+            add(2, data[i + 2]);
+            add(3, data[i + 3]);
+        }
+        for (; i < chunk_end; ++i) add(0, data[i]);
+
+        flush();
+    }
+}
+
+/**
+ * @brief Class counts of the tabulated values (each value counted `table[v]` times)
+ */
+[[nodiscard]] constexpr class_counts classes_of(const histogram& table) noexcept {
+    class_counts counts;
+    for (std::uint32_t v = 0; v < 256; ++v) {
+        if (table[v] == 0) continue;
+        counts.total += table[v];
+        detail::count_class_of(counts, v, table[v]);
+    }
+    return counts;
+}
+
+} // namespace zuu::simd
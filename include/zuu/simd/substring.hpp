@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+ * @file zuu/simd/substring.hpp
+ * @brief Vectorized substring search, optionally ASCII case-insensitive
+ * @version 3.0.0
+ *
+ * Candidates are positions where both the first and the last code unit of
+ * the needle match, tested a whole block of positions at a time; only
+ * those are compared in full. Case-insensitive search folds 'A'-'Z' onto
+ * 'a'-'z' (other code units compare exactly), for every character type.
+ *
+ * Usage:
+ *   auto it = simd::search(text.data(), text.data() + text.size(), "GET", 3);
+ *
+ *   simd::literal_searcher<char> find_error("error", true);   // -i
+ *   const char* hit = find_error(first, last);
+ */
+
+#include "../meta/concepts.hpp"
+#include "config.hpp"
+#include "lanes.hpp"
+#include "search.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::simd {
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr CharT fold_case(CharT ch) noexcept {
+    return (ch >= CharT('A') && ch <= CharT('Z')) ? static_cast<CharT>(ch | CharT(0x20)) : ch;
+}
+
+template <meta::character CharT>
+constexpr bool is_ascii_alpha(CharT ch) noexcept {
+    const CharT folded = fold_case(ch);
+    return folded >= CharT('a') && folded <= CharT('z');
+}
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr bool equal_at(const CharT* hay, const CharT* needle, std::size_t n) noexcept {
+    if constexpr (IgnoreCase) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (fold_case(hay[i]) != fold_case(needle[i])) return false;
+        }
+        return true;
+    } else {
+        return mismatch(hay, needle, n) == n;
+    }
+}
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr const CharT* search_scalar(const CharT* first, const CharT* last, const CharT* needle, std::size_t n) noexcept {
+    for (; static_cast<std::size_t>(last - first) >= n; ++first) {
+        if (equal_at<IgnoreCase>(first, needle, n)) return first;
+    }
+    return last;
+}
+
+#if defined(ZUU_SIMD_SSE2)
+
+// First/last-unit filter (n >= 2); returns where the vector loop stopped
+// when it did not find a match
+template <bool IgnoreCase, meta::character CharT>
+inline const CharT* search_vector(const CharT* first, const CharT* last, const CharT* needle, std::size_t n,
+                                  bool& found) noexcept {
+    using L = lanes<CharT>;
+    using block = typename L::block;
+
+    // OR-ing 0x20 folds upper onto lower case; only done for letters
+    auto fold_bit = [](CharT ch) {
+        return IgnoreCase && is_ascii_alpha(ch) ? L::splat(CharT(0x20)) : _mm_setzero_si128();
+    };
+
+    const block head = L::splat(IgnoreCase ? fold_case(needle[0]) : needle[0]);
+    const block tail = L::splat(IgnoreCase ? fold_case(needle[n - 1]) : needle[n - 1]);
+    const block head_bit = fold_bit(needle[0]);
+    const block tail_bit = fold_bit(needle[n - 1]);
+    constexpr std::uint32_t lane_bits = (1u << L::width) - 1u;
+
+    found = false;
+    for (; static_cast<std::size_t>(last - first) >= n - 1 + L::per_block; first += L::per_block) {
+        const block a = L::cmpeq(_mm_or_si128(L::load(first), head_bit), head);
+        const block b = L::cmpeq(_mm_or_si128(L::load(first + n - 1), tail_bit), tail);
+        std::uint32_t mask = L::mask(_mm_and_si128(a, b));
+
+        while (mask != 0) {
+            const int bit = std::countr_zero(mask);
+            const CharT* candidate = first + bit / L::width;
+            if (equal_at<IgnoreCase>(candidate + 1, needle + 1, n - 2)) {
+                found = true;
+                return candidate;
+            }
+            mask &= ~(lane_bits << bit);
+        }
+    }
+    return first;
+}
+
+#endif // ZUU_SIMD_SSE2
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr const CharT* search(const CharT* first, const CharT* last, const CharT* needle, std::size_t n) noexcept {
+    if (n == 0) return first;
+    if (static_cast<std::size_t>(last - first) < n) return last;
+
+    if (n == 1) {
+        if (!IgnoreCase || !is_ascii_alpha(needle[0])) return find_char(first, last, needle[0]);
+        const CharT both[] = {fold_case(needle[0]), static_cast<CharT>(fold_case(needle[0]) & ~CharT(0x20))};
+        return find_first_of(first, last, both, 2);
+    }
+
+#if defined(ZUU_SIMD_SSE2)
+    if (!std::is_constant_evaluated() && n >= 2) {
+        bool found;
+        first = search_vector<IgnoreCase>(first, last, needle, n, found);
+        if (found) return first;
+    }
+#endif
+
+    return search_scalar<IgnoreCase>(first, last, needle, n);
+}
+
+} // namespace detail
+
+/**
+ * @brief First occurrence of needle[0, n) in [first, last), or `last`
+ *
+ * An empty needle matches at `first`.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* search(
+    const CharT* first,
+    const CharT* last,
+    const CharT* needle,
+    std::size_t n
+) noexcept {
+    return detail::search<false>(first, last, needle, n);
+}
+
+/**
+ * @brief search() comparing ASCII letters case-insensitively
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr const CharT* search_ignore_case(
+    const CharT* first,
+    const CharT* last,
+    const CharT* needle,
+    std::size_t n
+) noexcept {
+    return detail::search<true>(first, last, needle, n);
+}
+
+/**
+ * @brief A needle bound to a search mode, reusable across haystacks
+ *
+ * The needle is not copied; it must outlive the searcher.
+ */
+template <meta::character CharT>
+class literal_searcher {
+public:
+    constexpr literal_searcher() noexcept = default;
+
+    constexpr explicit literal_searcher(std::basic_string_view<CharT> needle, bool ignore_case = false) noexcept
+        : needle_{needle}, ignore_case_{ignore_case} {}
+
+    [[nodiscard]] constexpr const CharT* operator()(const CharT* first, const CharT* last) const noexcept {
+        return ignore_case_ ? search_ignore_case(first, last, needle_.data(), needle_.size())
+                            : search(first, last, needle_.data(), needle_.size());
+    }
+
+    [[nodiscard]] constexpr std::basic_string_view<CharT> needle() const noexcept { return needle_; }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return needle_.size(); }
+    [[nodiscard]] constexpr bool ignore_case() const noexcept { return ignore_case_; }
+
+private:
+    std::basic_string_view<CharT> needle_{};
+    bool ignore_case_ = false;
+};
+
+} // namespace zuu::simd
@@ -8,10 +8,13 @@
  * Usage:
  *   auto result = to_upper(str);
  *   auto result = str | to_lower | reverse;  // Composable!
+ *   auto small = to_upper.into<fstring<16>>(std::string_view{"abc"});
  */
 
 #include "../core/core.hpp"
+#include "../simd/case.hpp"
 #include "pipe.hpp"
+#include "policy.hpp"
 
 namespace zuu::str {
 
@@ -48,28 +51,18 @@ constexpr bool is_whitespace(CharT ch) noexcept {
 // ==================== To Lower ====================
 
 struct to_lower_fn : pipe_adaptor<to_lower_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            result.push_back(char_to_lower(str[i]));
-        }
-        
-        return result;
+    // Result type follows the input (see policy.hpp)
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
     }
 
-    // Generic string_view version
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
-        
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            result.push_back(char_to_lower(sv[i]));
-        }
-        
-        return result;
+    // Explicit result type: to_lower.into<fstring<64>>(sv)
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
+        return kernel_output<Out>(as_view(str), [](auto* dest, const auto* src, std::size_t n) {
+            simd::to_lower(dest, src, n);
+        });
     }
 };
 
@@ -78,27 +71,16 @@ inline constexpr to_lower_fn to_lower;
 // ==================== To Upper ====================
 
 struct to_upper_fn : pipe_adaptor<to_upper_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            result.push_back(char_to_upper(str[i]));
-        }
-        
-        return result;
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
     }
 
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
-        
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            result.push_back(char_to_upper(sv[i]));
-        }
-        
-        return result;
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
+        return kernel_output<Out>(as_view(str), [](auto* dest, const auto* src, std::size_t n) {
+            simd::to_upper(dest, src, n);
+        });
     }
 };
 
@@ -107,51 +89,30 @@ inline constexpr to_upper_fn to_upper;
 // ==================== To Title Case ====================
 
 struct to_title_fn : pipe_adaptor<to_title_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        bool capitalize_next = true;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            CharT ch = str[i];
-            
-            if (is_whitespace(ch)) {
-                capitalize_next = true;
-                result.push_back(ch);
-            } else if (is_alpha(ch)) {
-                result.push_back(capitalize_next ? char_to_upper(ch) : char_to_lower(ch));
-                capitalize_next = false;
-            } else {
-                result.push_back(ch);
-                capitalize_next = false;
-            }
-        }
-        
-        return result;
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
     }
 
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        constexpr std::size_t default_cap = 256;
-        basic_fstring<CharT, default_cap> result;
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
         bool capitalize_next = true;
         
-        for (std::size_t i = 0; i < sv.size() && !result.full(); ++i) {
-            CharT ch = sv[i];
-            
+        return transform_output<Out>(as_view(str), [&capitalize_next](auto ch) {
             if (is_whitespace(ch)) {
                 capitalize_next = true;
-                result.push_back(ch);
-            } else if (is_alpha(ch)) {
-                result.push_back(capitalize_next ? char_to_upper(ch) : char_to_lower(ch));
-                capitalize_next = false;
-            } else {
-                result.push_back(ch);
+                return ch;
+            }
+            
+            if (is_alpha(ch)) {
+                const auto mapped = capitalize_next ? char_to_upper(ch) : char_to_lower(ch);
                 capitalize_next = false;
+                return mapped;
             }
-        }
-        
-        return result;
+            
+            capitalize_next = false;
+            return ch;
+        });
     }
 };
 
@@ -160,22 +121,19 @@ inline constexpr to_title_fn to_title;
 // ==================== Toggle Case ====================
 
 struct toggle_case_fn : pipe_adaptor<toggle_case_fn> {
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        basic_fstring<CharT, Cap> result;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            CharT ch = str[i];
-            if (ch >= CharT('a') && ch <= CharT('z')) {
-                result.push_back(char_to_upper(ch));
-            } else if (ch >= CharT('A') && ch <= CharT('Z')) {
-                result.push_back(char_to_lower(ch));
-            } else {
-                result.push_back(ch);
-            }
-        }
-        
-        return result;
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
+    }
+
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
+        return transform_output<Out>(as_view(str), [](auto ch) {
+            using char_type = decltype(ch);
+            if (ch >= char_type('a') && ch <= char_type('z')) return char_to_upper(ch);
+            if (ch >= char_type('A') && ch <= char_type('Z')) return char_to_lower(ch);
+            return ch;
+        });
     }
 };
 
@@ -184,20 +142,14 @@ inline constexpr toggle_case_fn toggle_case;
 // ==================== Case-Insensitive Comparison ====================
 
 struct equals_ignore_case_fn {
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
-    constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& lhs,
-        const basic_fstring<CharT, Cap2>& rhs
-    ) const noexcept {
-        if (lhs.size() != rhs.size()) return false;
-        
-        for (std::size_t i = 0; i < lhs.size(); ++i) {
-            if (char_to_lower(lhs[i]) != char_to_lower(rhs[i])) {
-                return false;
-            }
-        }
-        
-        return true;
+    template <meta::string_like Str1, meta::string_like Str2>
+    requires std::same_as<meta::char_type_of_t<Str1>, meta::char_type_of_t<Str2>>
+    constexpr bool operator()(const Str1& lhs, const Str2& rhs) const noexcept {
+        const auto a = as_view(lhs);
+        const auto b = as_view(rhs);
+        
+        if (a.size() != b.size()) return false;
+        return simd::mismatch_ignore_case(a.data(), b.data(), a.size()) == a.size();
     }
 };
 
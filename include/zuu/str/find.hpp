@@ -4,7 +4,12 @@
  * @file zuu/str/find.hpp
  * @brief Search and find operations with pipe support
  * @version 3.0.0
- * 
+ *
+ * Every algorithm accepts any meta::string_like haystack (basic_fstring,
+ * std::string, std::string_view, ...) and works on a view of it, so no
+ * conversion copy is made. Needles may be a character, a C-string or
+ * another string-like value.
+ *
  * Usage:
  *   bool has = contains(str, 'x');
  *   bool has = str | contains('x');
@@ -12,93 +17,53 @@
  */
 
 #include "../core/core.hpp"
+#include "../simd/search.hpp"
+#include "../simd/substring.hpp"
 #include "pipe.hpp"
+#include "policy.hpp"
 
 namespace zuu::str {
 
-// ==================== Contains (Character) ====================
+namespace detail {
 
-struct contains_char_fn {
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str, 
-        CharT ch
-    ) const noexcept {
-        return str.find(ch) != basic_fstring<CharT, Cap>::npos;
-    }
-    
-    // Factory for piping: str | contains('x')
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
-        return [ch, this](const auto& str) {
-            return (*this)(str, ch);
-        };
-    }
-};
+// Substring position in a view (npos when absent), via the vector searcher
+template <meta::character CharT>
+constexpr std::size_t search_view(
+    std::basic_string_view<CharT> hay,
+    std::basic_string_view<CharT> needle,
+    std::size_t pos = 0
+) noexcept {
+    if (pos > hay.size()) return npos;
 
-// ==================== Contains (String) ====================
+    const CharT* last = hay.data() + hay.size();
+    const CharT* found = simd::search(hay.data() + pos, last, needle.data(), needle.size());
+    return found == last && !needle.empty() ? npos : static_cast<std::size_t>(found - hay.data());
+}
 
-struct contains_str_fn {
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* substr
-    ) const noexcept {
-        return str.find(substr) != basic_fstring<CharT, Cap>::npos;
-    }
-    
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& substr
-    ) const noexcept {
-        return str.find(substr.data()) != basic_fstring<CharT, Cap1>::npos;
-    }
-    
-    // Factory for piping
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* substr) const noexcept {
-        return [substr, this](const auto& str) {
-            return (*this)(str, substr);
-        };
-    }
-    
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& substr) const noexcept {
-        return [substr, this](const auto& str) {
-            return (*this)(str, substr);
-        };
-    }
-};
+} // namespace detail
+
+// ==================== Contains ====================
 
-// Combined contains function
 struct contains_fn {
     // Character overload
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch
+        const Str& str,
+        meta::char_type_of_t<Str> ch
     ) const noexcept {
-        return contains_char_fn{}(str, ch);
+        return as_view(str).find(ch) != npos;
     }
-    
-    // String overload
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* substr
-    ) const noexcept {
-        return contains_str_fn{}(str, substr);
-    }
-    
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+
+    // String overload (C-string or string-like)
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& substr
+        const Str& str,
+        const Needle& substr
     ) const noexcept {
-        return contains_str_fn{}(str, substr);
+        if (detail::is_null_needle(substr)) return false;
+        return detail::search_view(as_view(str), detail::needle_view(substr)) != npos;
     }
-    
+
     // Factory for piping (character)
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
@@ -106,10 +71,10 @@ struct contains_fn {
             return (*this)(str, ch);
         };
     }
-    
+
     // Factory for piping (string)
     template <typename T>
-    requires (!std::same_as<T, typename std::decay_t<T>::value_type>)
+    requires (!meta::character<std::remove_cvref_t<T>>)
     [[nodiscard]] constexpr auto operator()(T&& substr) const noexcept {
         return [substr = std::forward<T>(substr), this](const auto& str) {
             return (*this)(str, substr);
@@ -122,51 +87,31 @@ inline constexpr contains_fn contains;
 // ==================== Starts With ====================
 
 struct starts_with_fn {
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* prefix
-    ) const noexcept {
-        return str.starts_with(prefix);
-    }
-    
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& prefix
+        const Str& str,
+        const Needle& prefix
     ) const noexcept {
-        return str.starts_with(prefix.data());
+        if (detail::is_null_needle(prefix)) return false;
+        return as_view(str).starts_with(detail::needle_view(prefix));
     }
-    
-    template <meta::character CharT, std::size_t Cap>
+
+    template <meta::string_like Str>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch
+        const Str& str,
+        meta::char_type_of_t<Str> ch
     ) const noexcept {
-        return str.starts_with(ch);
+        return as_view(str).starts_with(ch);
     }
-    
+
     // Factory for piping
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* prefix) const noexcept {
-        return [prefix, this](const auto& str) {
-            return (*this)(str, prefix);
-        };
-    }
-    
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& prefix) const noexcept {
+    template <typename T>
+    requires (!meta::string_like<T> || meta::fixed_string<std::remove_cvref_t<T>>)
+    [[nodiscard]] constexpr auto operator()(const T& prefix) const noexcept {
         return [prefix, this](const auto& str) {
             return (*this)(str, prefix);
         };
     }
-    
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
-        return [ch, this](const auto& str) {
-            return (*this)(str, ch);
-        };
-    }
 };
 
 inline constexpr starts_with_fn starts_with;
@@ -174,51 +119,31 @@ inline constexpr starts_with_fn starts_with;
 // ==================== Ends With ====================
 
 struct ends_with_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* suffix
+        const Str& str,
+        const Needle& suffix
     ) const noexcept {
-        return str.ends_with(suffix);
+        if (detail::is_null_needle(suffix)) return false;
+        return as_view(str).ends_with(detail::needle_view(suffix));
     }
-    
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& suffix
-    ) const noexcept {
-        return str.ends_with(suffix.data());
-    }
-    
-    template <meta::character CharT, std::size_t Cap>
+
+    template <meta::string_like Str>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch
+        const Str& str,
+        meta::char_type_of_t<Str> ch
     ) const noexcept {
-        return str.ends_with(ch);
+        return as_view(str).ends_with(ch);
     }
-    
+
     // Factory for piping
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* suffix) const noexcept {
-        return [suffix, this](const auto& str) {
-            return (*this)(str, suffix);
-        };
-    }
-    
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& suffix) const noexcept {
+    template <typename T>
+    requires (!meta::string_like<T> || meta::fixed_string<std::remove_cvref_t<T>>)
+    [[nodiscard]] constexpr auto operator()(const T& suffix) const noexcept {
         return [suffix, this](const auto& str) {
             return (*this)(str, suffix);
         };
     }
-    
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
-        return [ch, this](const auto& str) {
-            return (*this)(str, ch);
-        };
-    }
 };
 
 inline constexpr ends_with_fn ends_with;
@@ -226,24 +151,25 @@ inline constexpr ends_with_fn ends_with;
 // ==================== Find (Return Position) ====================
 
 struct find_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch,
+        const Str& str,
+        meta::char_type_of_t<Str> ch,
         std::size_t pos = 0
     ) const noexcept {
-        return str.find(ch, pos);
+        return as_view(str).find(ch, pos);
     }
-    
-    template <meta::character CharT, std::size_t Cap>
+
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* substr,
+        const Str& str,
+        const Needle& substr,
         std::size_t pos = 0
     ) const noexcept {
-        return str.find(substr, pos);
+        if (detail::is_null_needle(substr)) return npos;
+        return detail::search_view(as_view(str), detail::needle_view(substr), pos);
     }
-    
+
     // Factory for piping
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT ch, std::size_t pos = 0) const noexcept {
@@ -251,7 +177,7 @@ struct find_fn {
             return (*this)(str, ch, pos);
         };
     }
-    
+
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(const CharT* substr, std::size_t pos = 0) const noexcept {
         return [substr, pos, this](const auto& str) {
@@ -265,20 +191,30 @@ inline constexpr find_fn find;
 // ==================== Reverse Find ====================
 
 struct rfind_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch,
-        std::size_t pos = basic_fstring<CharT, Cap>::npos
+        const Str& str,
+        meta::char_type_of_t<Str> ch,
+        std::size_t pos = npos
+    ) const noexcept {
+        return as_view(str).rfind(ch, pos);
+    }
+
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
+    [[nodiscard]] constexpr std::size_t operator()(
+        const Str& str,
+        const Needle& substr,
+        std::size_t pos = npos
     ) const noexcept {
-        return str.rfind(ch, pos);
+        if (detail::is_null_needle(substr)) return npos;
+        return as_view(str).rfind(detail::needle_view(substr), pos);
     }
-    
+
     // Factory for piping
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(
-        CharT ch, 
-        std::size_t pos = std::size_t(-1)
+        CharT ch,
+        std::size_t pos = npos
     ) const noexcept {
         return [ch, pos, this](const auto& str) {
             return (*this)(str, ch, pos);
@@ -291,43 +227,43 @@ inline constexpr rfind_fn rfind;
 // ==================== Count Occurrences ====================
 
 struct count_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT ch
+        const Str& str,
+        meta::char_type_of_t<Str> ch
     ) const noexcept {
         std::size_t cnt = 0;
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            if (str[i] == ch) ++cnt;
+        for (const auto c : as_view(str)) {
+            if (c == ch) ++cnt;
         }
         return cnt;
     }
-    
-    template <meta::character CharT, std::size_t Cap>
+
+    // Non-overlapping occurrences
+    template <meta::string_like Str, detail::needle_for<Str> Needle>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* substr
+        const Str& str,
+        const Needle& substr
     ) const noexcept {
-        if (substr == nullptr) return 0;
-        
-        std::size_t substr_len = 0;
-        while (substr[substr_len] != CharT{}) ++substr_len;
-        
-        if (substr_len == 0) return 0;
-        
+        if (detail::is_null_needle(substr)) return 0;
+
+        const auto sv = as_view(str);
+        const auto needle = detail::needle_view(substr);
+        if (needle.empty()) return 0;
+
         std::size_t cnt = 0;
         std::size_t pos = 0;
-        
-        while (pos < str.size()) {
-            std::size_t found = str.find(substr, pos);
-            if (found == basic_fstring<CharT, Cap>::npos) break;
+
+        while (pos < sv.size()) {
+            std::size_t found = sv.find(needle, pos);
+            if (found == npos) break;
             ++cnt;
-            pos = found + substr_len;
+            pos = found + needle.size();
         }
-        
+
         return cnt;
     }
-    
+
     // Factory for piping
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT ch) const noexcept {
@@ -335,7 +271,7 @@ struct count_fn {
             return (*this)(str, ch);
         };
     }
-    
+
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(const CharT* substr) const noexcept {
         return [substr, this](const auto& str) {
@@ -349,48 +285,23 @@ inline constexpr count_fn count;
 // ==================== Find First Of (any character from set) ====================
 
 struct find_first_of_fn {
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    template <meta::string_like Str, detail::needle_for<Str> Charset>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const Str& str,
+        const Charset& charset
     ) const noexcept {
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i] == charset[j]) {
-                    return i;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap1>::npos;
-    }
-    
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* charset
-    ) const noexcept {
-        if (charset == nullptr) return basic_fstring<CharT, Cap>::npos;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            for (std::size_t j = 0; charset[j] != CharT{}; ++j) {
-                if (str[i] == charset[j]) {
-                    return i;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap>::npos;
+        if (detail::is_null_needle(charset)) return npos;
+
+        const auto sv = as_view(str);
+        const auto set = detail::needle_view(charset);
+        const auto* found = simd::find_first_of(sv.data(), sv.data() + sv.size(), set.data(), set.size());
+        return found == sv.data() + sv.size() ? npos : static_cast<std::size_t>(found - sv.data());
     }
-    
+
     // Factory for piping
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& charset) const noexcept {
-        return [charset, this](const auto& str) {
-            return (*this)(str, charset);
-        };
-    }
-    
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* charset) const noexcept {
+    template <typename T>
+    requires (!meta::string_like<T> || meta::fixed_string<std::remove_cvref_t<T>>)
+    [[nodiscard]] constexpr auto operator()(const T& charset) const noexcept {
         return [charset, this](const auto& str) {
             return (*this)(str, charset);
         };
@@ -402,41 +313,19 @@ inline constexpr find_first_of_fn find_first_of;
 // ==================== Find Last Of ====================
 
 struct find_last_of_fn {
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    template <meta::string_like Str, detail::needle_for<Str> Charset>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const Str& str,
+        const Charset& charset
     ) const noexcept {
-        for (std::size_t i = str.size(); i > 0; --i) {
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i - 1] == charset[j]) {
-                    return i - 1;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap1>::npos;
+        if (detail::is_null_needle(charset)) return npos;
+        return as_view(str).find_last_of(detail::needle_view(charset));
     }
-    
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* charset
-    ) const noexcept {
-        if (charset == nullptr) return basic_fstring<CharT, Cap>::npos;
-        
-        for (std::size_t i = str.size(); i > 0; --i) {
-            for (std::size_t j = 0; charset[j] != CharT{}; ++j) {
-                if (str[i - 1] == charset[j]) {
-                    return i - 1;
-                }
-            }
-        }
-        return basic_fstring<CharT, Cap>::npos;
-    }
-    
+
     // Factory for piping
-    template <meta::character CharT, std::size_t Cap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, Cap>& charset) const noexcept {
+    template <typename T>
+    requires (!meta::string_like<T> || meta::fixed_string<std::remove_cvref_t<T>>)
+    [[nodiscard]] constexpr auto operator()(const T& charset) const noexcept {
         return [charset, this](const auto& str) {
             return (*this)(str, charset);
         };
@@ -448,22 +337,17 @@ inline constexpr find_last_of_fn find_last_of;
 // ==================== Find First Not Of ====================
 
 struct find_first_not_of_fn {
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
+    template <meta::string_like Str, detail::needle_for<Str> Charset>
     [[nodiscard]] constexpr std::size_t operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
+        const Str& str,
+        const Charset& charset
     ) const noexcept {
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            bool found = false;
-            for (std::size_t j = 0; j < charset.size(); ++j) {
-                if (str[i] == charset[j]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) return i;
-        }
-        return basic_fstring<CharT, Cap1>::npos;
+        if (detail::is_null_needle(charset)) return npos;
+
+        const auto sv = as_view(str);
+        const auto set = detail::needle_view(charset);
+        const auto* found = simd::find_first_not_of(sv.data(), sv.data() + sv.size(), set.data(), set.size());
+        return found == sv.data() + sv.size() ? npos : static_cast<std::size_t>(found - sv.data());
     }
 };
 
@@ -472,22 +356,14 @@ inline constexpr find_first_not_of_fn find_first_not_of;
 // ==================== Contains Any (Check if any char from set exists) ====================
 
 struct contains_any_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str, detail::needle_for<Str> Charset>
     [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const CharT* charset
+        const Str& str,
+        const Charset& charset
     ) const noexcept {
-        return find_first_of_fn{}(str, charset) != basic_fstring<CharT, Cap>::npos;
+        return find_first_of_fn{}(str, charset) != npos;
     }
-    
-    template <meta::character CharT, std::size_t Cap1, std::size_t Cap2>
-    [[nodiscard]] constexpr bool operator()(
-        const basic_fstring<CharT, Cap1>& str,
-        const basic_fstring<CharT, Cap2>& charset
-    ) const noexcept {
-        return find_first_of_fn{}(str, charset) != basic_fstring<CharT, Cap1>::npos;
-    }
-    
+
     // Factory for piping
     template <typename T>
     [[nodiscard]] constexpr auto operator()(T&& charset) const noexcept {
@@ -499,4 +375,4 @@ struct contains_any_fn {
 
 inline constexpr contains_any_fn contains_any;
 
-} // namespace zuu::str
\ No newline at end of file
+} // namespace zuu::str
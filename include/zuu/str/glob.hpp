@@ -0,0 +1,191 @@
+#pragma once
+
+/**
+ * @file zuu/str/glob.hpp
+ * @brief Shell-style wildcard matching with pipe support
+ * @version 3.0.0
+ *
+ * Syntax: `*` any run of characters, `?` any one character, `[abc]`,
+ * `[a-z]` and `[!a-z]` (or `[^a-z]`) character classes, `\x` a literal x.
+ * A `[` without a closing `]` is literal. The whole string must match;
+ * wrap the pattern in `*...*` to search inside it.
+ *
+ * Matching is linear in practice: on a mismatch only the most recent `*`
+ * is retried, one position further.
+ *
+ * Usage:
+ *   bool ok = matches_glob("report-2025.csv"_fs, "report-*.csv");
+ *   bool ok = "Error: disk full"_fs | matches_glob_icase("*error*");
+ *   auto lit = glob_required_literal("*[0-9] GET *");   // " GET "
+ */
+
+#include "../core/core.hpp"
+#include "pipe.hpp"
+#include "policy.hpp"
+#include <string_view>
+
+namespace zuu::str {
+
+namespace detail {
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr CharT glob_fold(CharT ch) noexcept {
+    if constexpr (IgnoreCase) {
+        return (ch >= CharT('A') && ch <= CharT('Z')) ? static_cast<CharT>(ch | CharT(0x20)) : ch;
+    } else {
+        return ch;
+    }
+}
+
+// Index of the ']' closing the class opened at pattern[p], or npos if it is
+// unterminated; a ']' right after '[' or '[!' / '[^' is a member
+template <meta::character CharT>
+constexpr std::size_t glob_class_end(std::basic_string_view<CharT> pattern, std::size_t p) noexcept {
+    std::size_t i = p + 1;
+    if (i < pattern.size() && (pattern[i] == CharT('!') || pattern[i] == CharT('^'))) ++i;
+    if (i < pattern.size() && pattern[i] == CharT(']')) ++i;
+    while (i < pattern.size() && pattern[i] != CharT(']')) ++i;
+    return i < pattern.size() ? i : npos;
+}
+
+// Match one pattern element at pattern[p] against ch; returns the index
+// past the element, or npos if it does not match
+template <bool IgnoreCase, meta::character CharT>
+constexpr std::size_t glob_match_one(std::basic_string_view<CharT> pattern, std::size_t p, CharT ch) noexcept {
+    const CharT c = glob_fold<IgnoreCase>(ch);
+
+    if (pattern[p] == CharT('?')) return p + 1;
+
+    if (pattern[p] == CharT('\\') && p + 1 < pattern.size()) {
+        return glob_fold<IgnoreCase>(pattern[p + 1]) == c ? p + 2 : npos;
+    }
+
+    if (pattern[p] == CharT('[')) {
+        std::size_t i = p + 1;
+        const bool negate = i < pattern.size() && (pattern[i] == CharT('!') || pattern[i] == CharT('^'));
+        if (negate) ++i;
+
+        if (const std::size_t close = glob_class_end(pattern, p); close != npos) {
+            bool member = false;
+            for (; i < close; ++i) {
+                const CharT lo = glob_fold<IgnoreCase>(pattern[i]);
+                if (i + 2 < close && pattern[i + 1] == CharT('-')) {
+                    const CharT hi = glob_fold<IgnoreCase>(pattern[i + 2]);
+                    member = member || (lo <= c && c <= hi);
+                    i += 2;
+                } else {
+                    member = member || lo == c;
+                }
+            }
+            return member != negate ? close + 1 : npos;
+        }
+        // Unterminated class: literal '['
+    }
+
+    return glob_fold<IgnoreCase>(pattern[p]) == c ? p + 1 : npos;
+}
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr bool glob_match(std::basic_string_view<CharT> text, std::basic_string_view<CharT> pattern) noexcept {
+    std::size_t t = 0;
+    std::size_t p = 0;
+    std::size_t star = npos;  // index of the last '*' seen
+    std::size_t mark = 0;     // text position that '*' currently extends to
+
+    while (t < text.size()) {
+        if (p < pattern.size() && pattern[p] == CharT('*')) {
+            star = p++;
+            mark = t;
+            continue;
+        }
+        if (p < pattern.size()) {
+            if (const std::size_t next = glob_match_one<IgnoreCase>(pattern, p, text[t]); next != npos) {
+                p = next;
+                ++t;
+                continue;
+            }
+        }
+        if (star == npos) return false;
+        p = star + 1;
+        t = ++mark;
+    }
+
+    while (p < pattern.size() && pattern[p] == CharT('*')) ++p;
+    return p == pattern.size();
+}
+
+template <bool IgnoreCase>
+struct matches_glob_fn {
+    template <meta::string_like Str, needle_for<Str> Pattern>
+    [[nodiscard]] constexpr bool operator()(const Str& str, const Pattern& pattern) const noexcept {
+        if (is_null_needle(pattern)) return false;
+        return glob_match<IgnoreCase>(as_view(str), needle_view(pattern));
+    }
+
+    // Factory for piping: str | matches_glob("*.log")
+    template <typename Pattern>
+    requires (!meta::character<std::remove_cvref_t<Pattern>>)
+    [[nodiscard]] constexpr auto operator()(const Pattern& pattern) const noexcept {
+        return [pattern, this](const auto& str) {
+            return (*this)(str, pattern);
+        };
+    }
+};
+
+} // namespace detail
+
+// ==================== Matching ====================
+
+inline constexpr detail::matches_glob_fn<false> matches_glob;
+
+// ASCII letters compare case-insensitively
+inline constexpr detail::matches_glob_fn<true> matches_glob_icase;
+
+// ==================== Prefilter Literal ====================
+
+/**
+ * @brief Longest run of plain characters that every match must contain
+ *
+ * Useful as a substring prefilter before running the matcher. Runs next to
+ * escapes or classes are cut at the special character; empty if the
+ * pattern has no plain characters.
+ */
+template <meta::character CharT>
+[[nodiscard]] constexpr std::basic_string_view<CharT> glob_required_literal(
+    std::basic_string_view<CharT> pattern
+) noexcept {
+    auto is_special = [](CharT ch) {
+        return ch == CharT('*') || ch == CharT('?') || ch == CharT('[') || ch == CharT('\\');
+    };
+
+    std::basic_string_view<CharT> best;
+    std::size_t i = 0;
+    while (i < pattern.size()) {
+        if (is_special(pattern[i])) {
+            // Skip the element: an escape consumes the next character, a
+            // class runs to its ']' (a '[' without one is a plain character
+            // but is still treated as a cut here)
+            if (pattern[i] == CharT('\\')) {
+                i += 2;
+            } else if (pattern[i] == CharT('[')) {
+                const std::size_t close = detail::glob_class_end(pattern, i);
+                i = close == npos ? i + 1 : close + 1;
+            } else {
+                ++i;
+            }
+            continue;
+        }
+
+        const std::size_t start = i;
+        while (i < pattern.size() && !is_special(pattern[i])) ++i;
+        if (i - start > best.size()) best = pattern.substr(start, i - start);
+    }
+    return best;
+}
+
+template <meta::character CharT>
+[[nodiscard]] constexpr std::basic_string_view<CharT> glob_required_literal(const CharT* pattern) noexcept {
+    return glob_required_literal(detail::needle_view(pattern));
+}
+
+} // namespace zuu::str
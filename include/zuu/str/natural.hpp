@@ -0,0 +1,300 @@
+#pragma once
+
+/**
+ * @file zuu/str/natural.hpp
+ * @brief Natural ordering ("file9" < "file10") and memcmp-sortable keys
+ * @version 3.0.0
+ *
+ * Runs of ASCII digits compare by numeric value: leading zeros are
+ * skipped, then the longer run of significant digits is larger, then the
+ * digits decide. Everything else compares code unit by code unit (as
+ * unsigned), so a digit run orders against a non-digit like its first
+ * digit would. Runs of equal value are equal whatever their leading zeros
+ * ("v01" == "v1"). The _icase variants map 'A'-'Z' to lower case first.
+ *
+ * natural_compare() skips the common prefix with a vectorized mismatch and
+ * only steps back to the start of a digit run it stopped in.
+ *
+ * natural_sort_key<N>() encodes a single-byte string as N bytes that sort
+ * the same way under plain memcmp: each non-digit unit as itself, each
+ * digit run as '0', its significant digit count and its significant
+ * digits, zero padding after the end. Keys that did not fit are marked
+ * incomplete, and only equal incomplete keys need natural_compare() to
+ * break the tie; natural_sort() radix-sorts the keys that way. Keys treat
+ * a NUL unit like the end of the string and expect digit runs of at most
+ * 255 significant digits.
+ *
+ * Usage:
+ *   std::sort(names.begin(), names.end(), str::natural_less_icase);
+ *   int c = str::natural_compare("file9"_fs, "file10");   // < 0
+ *   auto key = str::natural_sort_key_icase<32>(name);      // std::memcmp-able
+ *   str::natural_sort_icase(std::span(names));
+ */
+
+#include "../core/core.hpp"
+#include "../simd/case.hpp"
+#include "../simd/search.hpp"
+#include "policy.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zuu::str {
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr bool is_digit_unit(CharT ch) noexcept {
+    return ch >= CharT('0') && ch <= CharT('9');
+}
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr auto natural_unit(CharT ch) noexcept {
+    using U = std::make_unsigned_t<CharT>;
+    if constexpr (IgnoreCase) {
+        if (ch >= CharT('A') && ch <= CharT('Z')) ch = static_cast<CharT>(ch | CharT(0x20));
+    }
+    return static_cast<U>(ch);
+}
+
+template <bool IgnoreCase, meta::character CharT>
+constexpr int natural_compare(std::basic_string_view<CharT> a, std::basic_string_view<CharT> b) noexcept {
+    std::size_t i = 0;
+    std::size_t j = 0;
+    for (;;) {
+        // Equal units are skipped in bulk. If a digit run continues past
+        // the mismatch (or the end) on either side, back up to its start,
+        // since runs compare by value
+        const std::size_t n = std::min(a.size() - i, b.size() - j);
+        std::size_t k = IgnoreCase ? simd::mismatch_ignore_case(a.data() + i, b.data() + j, n)
+                                   : simd::mismatch(a.data() + i, b.data() + j, n);
+        if ((i + k < a.size() && is_digit_unit(a[i + k])) || (j + k < b.size() && is_digit_unit(b[j + k]))) {
+            while (k > 0 && is_digit_unit(a[i + k - 1])) --k;
+        }
+        i += k;
+        j += k;
+
+        if (i == a.size() || j == b.size()) {
+            return i == a.size() ? (j == b.size() ? 0 : -1) : 1;
+        }
+        if (!is_digit_unit(a[i]) || !is_digit_unit(b[j])) {
+            const auto x = natural_unit<IgnoreCase>(a[i]);
+            const auto y = natural_unit<IgnoreCase>(b[j]);
+            if (x != y) return x < y ? -1 : 1;
+            ++i;
+            ++j;
+            continue;
+        }
+
+        // Both at a digit run: significant length, then digits
+        while (i < a.size() && a[i] == CharT('0')) ++i;
+        while (j < b.size() && b[j] == CharT('0')) ++j;
+        std::size_t end_a = i;
+        std::size_t end_b = j;
+        while (end_a < a.size() && is_digit_unit(a[end_a])) ++end_a;
+        while (end_b < b.size() && is_digit_unit(b[end_b])) ++end_b;
+        if (end_a - i != end_b - j) return end_a - i < end_b - j ? -1 : 1;
+        for (; i < end_a; ++i, ++j) {
+            if (a[i] != b[j]) return a[i] < b[j] ? -1 : 1;
+        }
+        j = end_b;
+    }
+}
+
+template <bool IgnoreCase>
+struct natural_compare_fn {
+    template <meta::string_like Str, needle_for<Str> Other>
+    [[nodiscard]] constexpr int operator()(const Str& lhs, const Other& rhs) const noexcept {
+        return natural_compare<IgnoreCase>(as_view(lhs), needle_view(rhs));
+    }
+};
+
+template <bool IgnoreCase>
+struct natural_less_fn {
+    template <meta::string_like Str, needle_for<Str> Other>
+    [[nodiscard]] constexpr bool operator()(const Str& lhs, const Other& rhs) const noexcept {
+        return natural_compare<IgnoreCase>(as_view(lhs), needle_view(rhs)) < 0;
+    }
+};
+
+} // namespace detail
+
+// ==================== Comparison ====================
+
+// Negative, zero or positive as lhs orders before, with or after rhs
+inline constexpr detail::natural_compare_fn<false> natural_compare;
+inline constexpr detail::natural_compare_fn<true> natural_compare_icase;
+
+// Strict weak ordering for std::sort and ordered containers
+inline constexpr detail::natural_less_fn<false> natural_less;
+inline constexpr detail::natural_less_fn<true> natural_less_icase;
+
+// ==================== Sort Keys ====================
+
+/**
+ * @brief N-byte key ordered by memcmp like natural_compare orders its
+ *        string; `complete` is false if the encoding was cut at N bytes
+ */
+template <std::size_t N>
+struct natural_key {
+    std::array<unsigned char, N> bytes{};
+    bool complete = true;
+
+    // Byte order only: equal keys with complete == false may still differ
+    [[nodiscard]] friend bool operator<(const natural_key& a, const natural_key& b) noexcept {
+        return std::memcmp(a.bytes.data(), b.bytes.data(), N) < 0;
+    }
+    [[nodiscard]] friend bool operator==(const natural_key& a, const natural_key& b) noexcept {
+        return std::memcmp(a.bytes.data(), b.bytes.data(), N) == 0;
+    }
+};
+
+namespace detail {
+
+template <std::size_t N, bool IgnoreCase, meta::character CharT>
+constexpr natural_key<N> make_natural_key(std::basic_string_view<CharT> text) noexcept {
+    natural_key<N> key;
+    std::size_t out = 0;
+    auto put = [&](unsigned char byte) {
+        if (out == N) {
+            key.complete = false;
+            return false;
+        }
+        key.bytes[out++] = byte;
+        return true;
+    };
+
+    for (std::size_t i = 0; i < text.size();) {
+        if (!is_digit_unit(text[i])) {
+            if (!put(natural_unit<IgnoreCase>(text[i]))) return key;
+            ++i;
+            continue;
+        }
+        while (i < text.size() && text[i] == CharT('0')) ++i;
+        std::size_t end = i;
+        while (end < text.size() && is_digit_unit(text[end])) ++end;
+        if (!put('0') || !put(static_cast<unsigned char>(std::min<std::size_t>(end - i, 255)))) return key;
+        for (; i < end; ++i) {
+            if (!put(static_cast<unsigned char>(text[i]))) return key;
+        }
+    }
+    return key;
+}
+
+template <std::size_t N>
+struct keyed_index {
+    natural_key<N> key;
+    std::uint32_t index;
+};
+
+/**
+ * @brief MSD radix sort of [first, last) by key bytes from `depth` on,
+ *        through `scratch` (same size); small ranges use insertion sort
+ */
+template <std::size_t N>
+void radix_sort(keyed_index<N>* first, keyed_index<N>* last, keyed_index<N>* scratch, std::size_t depth) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n < 2 || depth == N) return;
+    if (n <= 32) {
+        auto less = [depth](const keyed_index<N>& a, const keyed_index<N>& b) {
+            return std::memcmp(a.key.bytes.data() + depth, b.key.bytes.data() + depth, N - depth) < 0;
+        };
+        for (auto* it = first + 1; it != last; ++it) {
+            const keyed_index<N> item = *it;
+            auto* hole = it;
+            for (; hole != first && less(item, hole[-1]); --hole) *hole = hole[-1];
+            *hole = item;
+        }
+        return;
+    }
+
+    std::array<std::size_t, 257> offset{};
+    for (auto* it = first; it != last; ++it) ++offset[std::size_t{it->key.bytes[depth]} + 1];
+    for (std::size_t b = 1; b <= 256; ++b) offset[b] += offset[b - 1];
+    std::array<std::size_t, 256> fill;
+    std::copy_n(offset.begin(), 256, fill.begin());
+    for (auto* it = first; it != last; ++it) scratch[fill[it->key.bytes[depth]]++] = *it;
+    std::copy(scratch, scratch + n, first);
+
+    for (std::size_t b = 0; b < 256; ++b) {
+        if (offset[b + 1] - offset[b] > 1) radix_sort(first + offset[b], first + offset[b + 1], scratch, depth + 1);
+    }
+}
+
+template <bool IgnoreCase, typename T>
+void natural_sort(std::span<T> items) {
+    constexpr std::size_t key_size = 24;
+    using entry = keyed_index<key_size>;
+
+    std::vector<entry> entries(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        entries[i] = {make_natural_key<key_size, IgnoreCase>(as_view(items[i])), static_cast<std::uint32_t>(i)};
+    }
+    std::vector<entry> scratch(items.size());
+    radix_sort(entries.data(), entries.data() + entries.size(), scratch.data(), 0);
+
+    // Equal keys, one of them incomplete: order by the full strings
+    for (std::size_t i = 0; i < entries.size();) {
+        std::size_t j = i + 1;
+        bool complete = entries[i].key.complete;
+        for (; j < entries.size() && entries[j].key == entries[i].key; ++j) complete &= entries[j].key.complete;
+        if (!complete) {
+            std::stable_sort(entries.begin() + static_cast<std::ptrdiff_t>(i), entries.begin() + static_cast<std::ptrdiff_t>(j),
+                             [items](const entry& a, const entry& b) {
+                                 return natural_compare<IgnoreCase>(as_view(items[a.index]), as_view(items[b.index])) < 0;
+                             });
+        }
+        i = j;
+    }
+
+    std::vector<T> sorted;
+    sorted.reserve(items.size());
+    for (const entry& e : entries) sorted.push_back(std::move(items[e.index]));
+    std::move(sorted.begin(), sorted.end(), items.begin());
+}
+
+} // namespace detail
+
+/**
+ * @brief Natural-order key of a single-byte string: memcmp on keys orders
+ *        like natural_compare, up to keys that are equal and incomplete
+ */
+template <std::size_t N = 32, meta::string_like Str>
+    requires(sizeof(meta::char_type_of_t<Str>) == 1)
+[[nodiscard]] constexpr natural_key<N> natural_sort_key(const Str& str) noexcept {
+    return detail::make_natural_key<N, false>(as_view(str));
+}
+
+template <std::size_t N = 32, meta::string_like Str>
+    requires(sizeof(meta::char_type_of_t<Str>) == 1)
+[[nodiscard]] constexpr natural_key<N> natural_sort_key_icase(const Str& str) noexcept {
+    return detail::make_natural_key<N, true>(as_view(str));
+}
+
+// ==================== Sorting ====================
+
+/**
+ * @brief Sort single-byte strings in natural order: 24-byte keys are
+ *        radix-sorted, and only runs of equal incomplete keys are compared
+ *        in full. Equal strings keep no particular order.
+ */
+template <typename T>
+    requires meta::string_like<T> && (sizeof(meta::char_type_of_t<T>) == 1)
+void natural_sort(std::span<T> items) {
+    detail::natural_sort<false>(items);
+}
+
+template <typename T>
+    requires meta::string_like<T> && (sizeof(meta::char_type_of_t<T>) == 1)
+void natural_sort_icase(std::span<T> items) {
+    detail::natural_sort<true>(items);
+}
+
+} // namespace zuu::str
@@ -145,9 +145,9 @@ struct composed_pipe {
     }
 };
 
-// Composition operator for pipes
+// Composition operator for pipes (strings on the left are applied, not composed)
 template <typename Fn1, typename Fn2>
-requires requires(Fn1 f1, Fn2 f2) {
+requires (!meta::string_like<Fn1>) && requires(Fn1 f1, Fn2 f2) {
     { f1 } -> std::convertible_to<Fn1>;
     { f2 } -> std::convertible_to<Fn2>;
 }
@@ -155,4 +155,17 @@ constexpr auto operator|(Fn1 f1, Fn2 f2) {
     return composed_pipe{std::move(f1), std::move(f2)};
 }
 
+// ==================== Pipe Into Callables ====================
+
+/**
+ * @brief Pipe a string into any callable
+ * 
+ * result = str | [](auto s) { return s + "!"; };
+ */
+template <meta::string_like Str, typename Fn>
+requires std::invocable<const Fn&, Str>
+constexpr auto operator|(Str&& str, const Fn& fn) {
+    return fn(std::forward<Str>(str));
+}
+
 } // namespace zuu::str
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+/**
+ * @file zuu/str/policy.hpp
+ * @brief Input views and output type policies for string algorithms
+ * @version 3.0.0
+ *
+ * Algorithms accept any meta::string_like input, work on a
+ * basic_string_view internally and pick their result type here:
+ *
+ *   Input                  owning_output_t        slice_output_t
+ *   basic_fstring<C, N>    basic_fstring<C, N>    basic_fstring<C, N>
+ *   basic_string<C>        basic_string<C>        basic_string<C>
+ *   basic_string_view<C>   basic_string<C>        basic_string_view<C>
+ *
+ * Slices of a view stay views (zero-copy, caller keeps the source alive);
+ * owning inputs produce owning results so temporaries never dangle.
+ * Algorithms that build new text also offer `into<Out>(str)` to override.
+ */
+
+#include "../core/core.hpp"
+#include "../meta/concepts.hpp"
+#include "../meta/traits.hpp"
+#include "../simd/cstring.hpp"
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu::str {
+
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+// ==================== Input View ====================
+
+/**
+ * @brief View any string-like value without copying
+ */
+template <meta::string_like Str>
+[[nodiscard]] constexpr auto as_view(const Str& str) noexcept {
+    using char_type = meta::char_type_of_t<Str>;
+
+    if constexpr (meta::has_data_and_size<std::remove_cvref_t<Str>>) {
+        return std::basic_string_view<char_type>{str.data(), str.size()};
+    } else {
+        return std::basic_string_view<char_type>{str};
+    }
+}
+
+template <typename Str>
+using view_of_t = decltype(as_view(std::declval<const Str&>()));
+
+// ==================== Needles ====================
+
+namespace detail {
+
+// Needle views: C-strings (nullptr-safe) and string-like values
+template <typename Ptr>
+    requires std::is_pointer_v<Ptr> && meta::character<std::remove_const_t<std::remove_pointer_t<Ptr>>>
+constexpr auto needle_view(Ptr str) noexcept {
+    using char_type = std::remove_const_t<std::remove_pointer_t<Ptr>>;
+    return std::basic_string_view<char_type>{str, simd::strnlen(str)};  // strnlen(nullptr) is 0
+}
+
+// Arrays (literals): the length stays a compile-time constant for literals,
+// so the searchers see how short the needle is
+template <meta::character CharT, std::size_t N>
+constexpr std::basic_string_view<CharT> needle_view(const CharT (&str)[N]) noexcept {
+    const CharT* end = std::char_traits<CharT>::find(str, N, CharT{});
+    return {str, end ? static_cast<std::size_t>(end - str) : N};
+}
+
+template <meta::string_like Str>
+constexpr auto needle_view(const Str& str) noexcept {
+    return as_view(str);
+}
+
+// A needle compatible with haystack Str: C-string (or literal) or string-like
+// of the same character type
+template <typename Needle, typename Str>
+concept needle_for =
+    std::same_as<std::decay_t<Needle>, const meta::char_type_of_t<Str>*> ||
+    std::same_as<std::decay_t<Needle>, meta::char_type_of_t<Str>*> ||
+    (meta::string_like<Needle> &&
+     std::same_as<meta::char_type_of_t<Needle>, meta::char_type_of_t<Str>>);
+
+template <typename Needle>
+constexpr bool is_null_needle(const Needle& needle) noexcept {
+    if constexpr (std::is_pointer_v<Needle>) {
+        return needle == nullptr;
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+// ==================== Owning Output (new text) ====================
+
+template <typename Str>
+struct owning_output {
+    using type = std::basic_string<meta::char_type_of_t<Str>>;
+};
+
+template <meta::character CharT, std::size_t Cap>
+struct owning_output<basic_fstring<CharT, Cap>> {
+    using type = basic_fstring<CharT, Cap>;
+};
+
+template <meta::character CharT, typename Traits, typename Alloc>
+struct owning_output<std::basic_string<CharT, Traits, Alloc>> {
+    using type = std::basic_string<CharT, Traits, Alloc>;
+};
+
+template <typename Str>
+using owning_output_t = typename owning_output<std::remove_cvref_t<Str>>::type;
+
+// ==================== Slice Output (sub-ranges of the input) ====================
+
+template <typename Str>
+struct slice_output : owning_output<Str> {};
+
+template <meta::character CharT, typename Traits>
+struct slice_output<std::basic_string_view<CharT, Traits>> {
+    using type = std::basic_string_view<CharT, Traits>;
+};
+
+template <typename Str>
+using slice_output_t = typename slice_output<std::remove_cvref_t<Str>>::type;
+
+// ==================== Output Construction ====================
+
+/**
+ * @brief Build an output string from a view (truncates to fixed capacity)
+ */
+template <typename Out, meta::character CharT>
+[[nodiscard]] constexpr Out make_output(std::basic_string_view<CharT> sv) {
+    return Out(sv.data(), sv.size());
+}
+
+/**
+ * @brief Build an output string by mapping every character of a view
+ */
+template <typename Out, meta::character CharT, typename Fn>
+[[nodiscard]] constexpr Out transform_output(std::basic_string_view<CharT> sv, Fn&& fn) {
+    Out out;
+    out.resize(sv.size());  // basic_fstring clamps to its capacity
+
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = fn(sv[i]);
+    }
+
+    return out;
+}
+
+/**
+ * @brief Build an output string with a bulk kernel `kernel(dest, src, n)`
+ */
+template <typename Out, meta::character CharT, typename Kernel>
+[[nodiscard]] constexpr Out kernel_output(std::basic_string_view<CharT> sv, Kernel&& kernel) {
+    Out out;
+    out.resize(sv.size());  // basic_fstring clamps to its capacity
+
+    kernel(out.data(), sv.data(), out.size());
+    return out;
+}
+
+} // namespace zuu::str
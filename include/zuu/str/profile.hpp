@@ -0,0 +1,472 @@
+#pragma once
+
+/**
+ * @file zuu/str/profile.hpp
+ * @brief Opt-in per-stage profiling of pipe chains
+ * @version 3.0.0
+ *
+ * Define ZUU_PROFILE before including to enable. profiled() then wraps a
+ * pipe_adaptor, closure or composed_pipe so that every call records, in
+ * thread-local counters: calls, cycles (TSC where available, nanoseconds
+ * otherwise) and bytes in and out. A composed_pipe is wrapped stage by
+ * stage, each stage named "chain/stage". Without ZUU_PROFILE, profiled()
+ * returns its pipe unchanged and the reports are empty.
+ *
+ * Counters are exported as a text table or, with tracing switched on, as
+ * Chrome trace events (chrome://tracing, Perfetto). Exports and reset()
+ * read the counters of every thread; call them while no profiled stage
+ * is running.
+ *
+ * Usage:
+ *   auto clean = str::profiled("clean", trim | to_lower | split(','));
+ *   for (const auto& line : lines) consume(line | clean);
+ *   str::profile::write_report(stderr);
+ *
+ *   str::profile::set_tracing(true);
+ *   ...
+ *   str::profile::write_chrome_trace(file);
+ */
+
+#include "../meta/concepts.hpp"
+#include "pipe.hpp"
+#include "policy.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(ZUU_PROFILE)
+    #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <chrono>
+    #include <deque>
+    #include <memory>
+    #include <mutex>
+    #include <ranges>
+    #include <string>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #elif defined(__x86_64__) || defined(__i386__)
+        #include <x86intrin.h>
+    #endif
+#endif
+
+namespace zuu::str {
+
+namespace profile {
+
+#if defined(ZUU_PROFILE)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+// Counters of one stage, summed over all threads
+struct stage_stats {
+    std::string_view name;
+    std::uint64_t calls = 0;
+    std::uint64_t cycles = 0;
+    std::uint64_t bytes_in = 0;
+    std::uint64_t bytes_out = 0;
+};
+
+} // namespace profile
+
+#if defined(ZUU_PROFILE)
+
+namespace profile {
+
+inline constexpr std::size_t max_stages = 256;               // the last slot collects overflow
+inline constexpr std::size_t max_trace_events = 1 << 16;     // per thread
+
+// Cycle counter: TSC on x86, steady_clock nanoseconds elsewhere
+[[nodiscard]] inline std::uint64_t ticks() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+namespace detail {
+
+// Single writer (the owning thread); relaxed load + store avoids a locked add
+struct counter {
+    std::atomic<std::uint64_t> value{0};
+
+    void add(std::uint64_t n) noexcept { value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t get() const noexcept { return value.load(std::memory_order_relaxed); }
+    void clear() noexcept { value.store(0, std::memory_order_relaxed); }
+};
+
+struct stage_counters {
+    counter calls;
+    counter cycles;
+    counter bytes_in;
+    counter bytes_out;
+};
+
+struct trace_event {
+    std::uint32_t stage;
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint64_t bytes_in;
+    std::uint64_t bytes_out;
+};
+
+struct thread_counters {
+    std::uint32_t tid = 0;
+    std::array<stage_counters, max_stages> stages;
+    std::unique_ptr<trace_event[]> events;
+    std::atomic<std::size_t> event_count{0};
+    counter dropped;
+};
+
+class registry {
+public:
+    static registry& instance() {
+        static registry* global = new registry;  // never destroyed: threads may outlive statics
+        return *global;
+    }
+
+    std::uint32_t intern(std::string_view name) {
+        std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < names_.size(); ++i) {
+            if (names_[i] == name) return static_cast<std::uint32_t>(i);
+        }
+        if (names_.size() == max_stages - 1) names_.emplace_back("(other stages)");
+        if (names_.size() == max_stages) return max_stages - 1;
+        names_.emplace_back(name);
+        return static_cast<std::uint32_t>(names_.size() - 1);
+    }
+
+    thread_counters& local() {
+        thread_local std::shared_ptr<thread_counters> counters = [this] {
+            auto created = std::make_shared<thread_counters>();
+            std::lock_guard lock(mutex_);
+            created->tid = static_cast<std::uint32_t>(threads_.size());
+            threads_.push_back(created);
+            return created;
+        }();
+        return *counters;
+    }
+
+    template <typename Fn>
+    void for_each_thread(Fn&& fn) {
+        std::lock_guard lock(mutex_);
+        for (const auto& counters : threads_) fn(*counters);
+    }
+
+    std::vector<std::string_view> names() {
+        std::lock_guard lock(mutex_);
+        return {names_.begin(), names_.end()};
+    }
+
+    std::atomic<bool> tracing{false};
+
+    // Clock pair taken at start-up, to convert ticks to microseconds
+    const std::uint64_t origin_ticks = ticks();
+    const std::chrono::steady_clock::time_point origin_time = std::chrono::steady_clock::now();
+
+private:
+    std::mutex mutex_;
+    std::deque<std::string> names_;  // stable storage for the views handed out
+    std::vector<std::shared_ptr<thread_counters>> threads_;
+};
+
+inline void record(std::uint32_t stage, std::uint64_t start, std::uint64_t duration, std::uint64_t in,
+                   std::uint64_t out) {
+    auto& global = registry::instance();
+    auto& local = global.local();
+    auto& counters = local.stages[stage];
+    counters.calls.add(1);
+    counters.cycles.add(duration);
+    counters.bytes_in.add(in);
+    counters.bytes_out.add(out);
+
+    if (!global.tracing.load(std::memory_order_relaxed)) return;
+
+    const std::size_t n = local.event_count.load(std::memory_order_relaxed);
+    if (n == max_trace_events) {
+        local.dropped.add(1);
+        return;
+    }
+    if (!local.events) local.events = std::make_unique<trace_event[]>(max_trace_events);
+    local.events[n] = {stage, start, duration, in, out};
+    local.event_count.store(n + 1, std::memory_order_release);
+}
+
+// Bytes of a string, or of every string in a range of strings (split results)
+template <typename T>
+std::uint64_t byte_size(const T& value) noexcept {
+    if constexpr (meta::string_like<T>) {
+        return as_view(value).size() * sizeof(meta::char_type_of_t<T>);
+    } else if constexpr (std::ranges::range<const T&> && meta::string_like<std::ranges::range_value_t<const T&>>) {
+        std::uint64_t total = 0;
+        for (const auto& part : value) total += byte_size(part);
+        return total;
+    } else {
+        return 0;
+    }
+}
+
+// Microseconds between the registry origin and `at`
+inline double to_micros(std::uint64_t at, double micros_per_tick) noexcept {
+    const auto& global = registry::instance();
+    return static_cast<double>(static_cast<std::int64_t>(at - global.origin_ticks)) * micros_per_tick;
+}
+
+inline void write_json_string(std::FILE* out, std::string_view text) {
+    std::fputc('"', out);
+    for (const char ch : text) {
+        if (ch == '"' || ch == '\\') std::fputc('\\', out);
+        if (static_cast<unsigned char>(ch) >= 0x20) std::fputc(ch, out);
+    }
+    std::fputc('"', out);
+}
+
+} // namespace detail
+
+/**
+ * @brief Per-stage totals over all threads, in registration order
+ *
+ * Stages that were never called are left out.
+ */
+[[nodiscard]] inline std::vector<stage_stats> snapshot() {
+    auto& global = detail::registry::instance();
+    const auto names = global.names();
+    std::vector<stage_stats> stats(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) stats[i].name = names[i];
+
+    global.for_each_thread([&](const detail::thread_counters& local) {
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            stats[i].calls += local.stages[i].calls.get();
+            stats[i].cycles += local.stages[i].cycles.get();
+            stats[i].bytes_in += local.stages[i].bytes_in.get();
+            stats[i].bytes_out += local.stages[i].bytes_out.get();
+        }
+    });
+
+    std::erase_if(stats, [](const stage_stats& s) { return s.calls == 0; });
+    return stats;
+}
+
+// Zero every counter and drop recorded trace events (stage names are kept)
+inline void reset() {
+    detail::registry::instance().for_each_thread([](detail::thread_counters& local) {
+        for (auto& stage : local.stages) {
+            stage.calls.clear();
+            stage.cycles.clear();
+            stage.bytes_in.clear();
+            stage.bytes_out.clear();
+        }
+        local.event_count.store(0, std::memory_order_relaxed);
+        local.dropped.clear();
+    });
+}
+
+// Record one trace event per call from now on (off by default)
+inline void set_tracing(bool on) noexcept {
+    detail::registry::instance().tracing.store(on, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Text table: calls, cycles, cycles per call, bytes in/out per stage
+ */
+inline void write_report(std::FILE* out) {
+    std::fprintf(out, "%-40s %12s %14s %10s %14s %14s\n", "stage", "calls", "cycles", "cyc/call", "bytes in",
+                 "bytes out");
+    for (const auto& s : snapshot()) {
+        std::fprintf(out, "%-40.*s %12llu %14llu %10.1f %14llu %14llu\n", static_cast<int>(s.name.size()),
+                     s.name.data(), static_cast<unsigned long long>(s.calls),
+                     static_cast<unsigned long long>(s.cycles), static_cast<double>(s.cycles) / s.calls,
+                     static_cast<unsigned long long>(s.bytes_in), static_cast<unsigned long long>(s.bytes_out));
+    }
+}
+
+/**
+ * @brief Recorded calls as Chrome trace-event JSON ("X" complete events)
+ *
+ * Each thread keeps at most max_trace_events events; later ones are
+ * counted as dropped. Returns the number of events written.
+ */
+inline std::size_t write_chrome_trace(std::FILE* out) {
+    auto& global = detail::registry::instance();
+    const auto names = global.names();
+
+    // Ticks per microsecond, measured over the whole run so far
+    const auto elapsed = std::chrono::steady_clock::now() - global.origin_time;
+    const std::uint64_t tick_span = ticks() - global.origin_ticks;
+    const double micros = std::chrono::duration<double, std::micro>(elapsed).count();
+    const double micros_per_tick = tick_span != 0 ? micros / static_cast<double>(tick_span) : 0.0;
+
+    std::size_t written = 0;
+    std::uint64_t dropped = 0;
+    std::fputs("{\"traceEvents\":[", out);
+
+    global.for_each_thread([&](const detail::thread_counters& local) {
+        const std::size_t count = local.event_count.load(std::memory_order_acquire);
+        dropped += local.dropped.get();
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& e = local.events[i];
+            std::fputs(written++ == 0 ? "\n" : ",\n", out);
+            std::fputs("{\"name\":", out);
+            detail::write_json_string(out, names[e.stage]);
+            std::fprintf(out,
+                         ",\"cat\":\"zuu\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,"
+                         "\"args\":{\"cycles\":%llu,\"bytes_in\":%llu,\"bytes_out\":%llu}}",
+                         local.tid, detail::to_micros(e.start, micros_per_tick),
+                         static_cast<double>(e.duration) * micros_per_tick,
+                         static_cast<unsigned long long>(e.duration), static_cast<unsigned long long>(e.bytes_in),
+                         static_cast<unsigned long long>(e.bytes_out));
+        }
+    });
+
+    std::fprintf(out, "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped_events\":%llu}}\n",
+                 static_cast<unsigned long long>(dropped));
+    return written;
+}
+
+} // namespace profile
+
+// ==================== Profiled Pipe ====================
+
+/**
+ * @brief A pipe that records every call into the profile counters
+ */
+template <typename Pipe>
+class profiled_pipe {
+public:
+    profiled_pipe(std::string_view name, Pipe pipe)
+        : pipe_{std::move(pipe)}, stage_{profile::detail::registry::instance().intern(name)} {}
+
+    template <meta::string_like Str>
+    auto operator()(Str&& str) const {
+        const std::uint64_t in = profile::detail::byte_size(str);
+        const std::uint64_t start = profile::ticks();
+        auto result = pipe_(std::forward<Str>(str));
+        const std::uint64_t stop = profile::ticks();
+        profile::detail::record(stage_, start, stop - start, in, profile::detail::byte_size(result));
+        return result;
+    }
+
+    template <meta::string_like Str>
+    friend auto operator|(Str&& str, const profiled_pipe& p) {
+        return p(std::forward<Str>(str));
+    }
+
+private:
+    Pipe pipe_;
+    std::uint32_t stage_;
+};
+
+namespace detail {
+
+template <typename T>
+constexpr std::string_view raw_type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+    constexpr std::string_view f = __PRETTY_FUNCTION__;
+    constexpr std::size_t start = f.find("T = ") + 4;
+    return f.substr(start, f.find_first_of(";]", start) - start);
+#elif defined(_MSC_VER)
+    constexpr std::string_view f = __FUNCSIG__;
+    constexpr std::size_t start = f.find("raw_type_name<") + 14;
+    return f.substr(start, f.rfind(">(void)") - start);
+#else
+    return "stage";
+#endif
+}
+
+// "zuu::str::to_lower_fn" -> "to_lower"; a lambda made by a factory such as
+// split(',') is named after it ("split_char"), other lambdas generically
+template <typename T>
+std::string_view stage_name() {
+    std::string_view name = raw_type_name<T>();
+    if (name.starts_with("zuu::str::closure<")) return "closure";
+    if (const auto factory = name.find("::operator()"); factory != std::string_view::npos) {
+        name = name.substr(0, factory);
+    } else if (name.find("lambda") != std::string_view::npos) {
+        return "lambda";
+    }
+    name = name.substr(0, name.find('<'));
+    if (const auto scope = name.rfind("::"); scope != std::string_view::npos) name.remove_prefix(scope + 2);
+    if (name.ends_with("_fn")) name.remove_suffix(3);
+    if (const auto space = name.rfind(' '); space != std::string_view::npos) name.remove_prefix(space + 1);
+    return name;
+}
+
+template <typename T>
+inline constexpr bool is_composed_pipe = false;
+
+template <typename Fn1, typename Fn2>
+inline constexpr bool is_composed_pipe<composed_pipe<Fn1, Fn2>> = true;
+
+// Wrap each stage of a chain, left to right; repeated stages get "#2", "#3"...
+template <typename Pipe>
+auto profile_stages(const std::string& prefix, Pipe pipe, std::vector<std::string>& used) {
+    if constexpr (is_composed_pipe<Pipe>) {
+        auto first = profile_stages(prefix, std::move(pipe.first), used);
+        auto second = profile_stages(prefix, std::move(pipe.second), used);
+        return composed_pipe{std::move(first), std::move(second)};
+    } else {
+        const std::string base = prefix + "/" + std::string(stage_name<Pipe>());
+        std::string name = base;
+        for (int n = 2; std::find(used.begin(), used.end(), name) != used.end(); ++n) name = base + "#" + std::to_string(n);
+        used.push_back(name);
+        return profiled_pipe<Pipe>(name, std::move(pipe));
+    }
+}
+
+} // namespace detail
+
+#endif // ZUU_PROFILE
+
+// ==================== Factory ====================
+
+/**
+ * @brief Wrap `pipe` for profiling under `name`
+ *
+ * A composed_pipe is profiled as a whole under `name` and stage by stage
+ * as "name/stage". Without ZUU_PROFILE the pipe is returned unchanged.
+ */
+template <typename Pipe>
+constexpr auto profiled([[maybe_unused]] std::string_view name, Pipe pipe) {
+#if defined(ZUU_PROFILE)
+    if constexpr (detail::is_composed_pipe<Pipe>) {
+        std::vector<std::string> used;
+        auto stages = detail::profile_stages(std::string(name), std::move(pipe), used);
+        return profiled_pipe<decltype(stages)>(name, std::move(stages));
+    } else {
+        return profiled_pipe<Pipe>(name, std::move(pipe));
+    }
+#else
+    return pipe;
+#endif
+}
+
+#if !defined(ZUU_PROFILE)
+
+namespace profile {
+
+[[nodiscard]] inline std::vector<stage_stats> snapshot() { return {}; }
+inline void reset() noexcept {}
+inline void set_tracing(bool) noexcept {}
+
+inline void write_report(std::FILE* out) {
+    std::fputs("profiling disabled (define ZUU_PROFILE)\n", out);
+}
+
+inline std::size_t write_chrome_trace(std::FILE* out) {
+    std::fputs("{\"traceEvents\":[]}\n", out);
+    return 0;
+}
+
+} // namespace profile
+
+#endif // !ZUU_PROFILE
+
+} // namespace zuu::str
@@ -0,0 +1,164 @@
+#pragma once
+
+/**
+ * @file zuu/str/reverse.hpp
+ * @brief Reverse, rotate and word-order algorithms with pipe support
+ * @version 3.0.0
+ *
+ * Pipes build a new string (see policy.hpp for the result type); the
+ * `_in_place` variants rewrite a mutable string (basic_fstring,
+ * std::basic_string) without copying. All of them work on code units.
+ *
+ * Usage:
+ *   auto r = str | reverse;                 // "abc" -> "cba"
+ *   auto r = str | rotate(2);               // "abcde" -> "cdeab"
+ *   auto r = str | reverse_words;           // "a big cat" -> "cat big a"
+ *   reverse_in_place(buffer);
+ */
+
+#include "../core/core.hpp"
+#include "../simd/reverse.hpp"
+#include "pipe.hpp"
+#include "policy.hpp"
+#include "trim.hpp"
+
+namespace zuu::str {
+
+namespace detail {
+
+// Strings whose characters can be rewritten through data()
+template <typename Str>
+concept mutable_string = meta::string_like<Str> && requires(Str& str) {
+    { str.data() } -> std::same_as<meta::char_type_of_t<Str>*>;
+    { str.size() } -> std::convertible_to<std::size_t>;
+};
+
+// Reverse every run of non-space characters
+template <meta::character CharT>
+constexpr void reverse_each_word(CharT* data, std::size_t n) noexcept {
+    std::size_t i = 0;
+    while (i < n) {
+        while (i < n && is_space(data[i])) ++i;
+
+        std::size_t end = i;
+        while (end < n && !is_space(data[end])) ++end;
+
+        simd::reverse(data + i, end - i);
+        i = end;
+    }
+}
+
+} // namespace detail
+
+// ==================== Reverse ====================
+
+struct reverse_fn : pipe_adaptor<reverse_fn> {
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
+    }
+
+    // A shorter Out keeps the start of the reversed string
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
+        const auto sv = as_view(str);
+        return kernel_output<Out>(sv, [&sv](auto* dest, const auto* src, std::size_t n) {
+            simd::reverse_copy(dest, src + (sv.size() - n), n);
+        });
+    }
+};
+
+inline constexpr reverse_fn reverse;
+
+struct reverse_in_place_fn {
+    template <detail::mutable_string Str>
+    constexpr Str& operator()(Str& str) const noexcept {
+        simd::reverse(str.data(), str.size());
+        return str;
+    }
+};
+
+inline constexpr reverse_in_place_fn reverse_in_place;
+
+// ==================== Rotate ====================
+
+/**
+ * @brief Rotate left by `k` code units (modulo the length)
+ */
+struct rotate_fn {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr auto operator()(const Str& str, std::size_t k) const {
+        return into<owning_output_t<Str>>(str, k);
+    }
+
+    template <typename Out, meta::string_like Str>
+    [[nodiscard]] constexpr Out into(const Str& str, std::size_t k) const {
+        const auto sv = as_view(str);
+        return kernel_output<Out>(sv, [&sv, k](auto* dest, const auto* src, std::size_t n) {
+            if (n == sv.size()) {
+                simd::rotate_copy(dest, src, n, k);
+            } else {
+                for (std::size_t i = 0; i < n; ++i) dest[i] = src[(i + k) % sv.size()];
+            }
+        });
+    }
+
+    // Factory for piping
+    [[nodiscard]] constexpr auto operator()(std::size_t k) const noexcept {
+        return [k, this](const auto& str) {
+            return (*this)(str, k);
+        };
+    }
+};
+
+inline constexpr rotate_fn rotate;
+
+struct rotate_in_place_fn {
+    template <detail::mutable_string Str>
+    constexpr Str& operator()(Str& str, std::size_t k) const noexcept {
+        simd::rotate(str.data(), str.size(), k);
+        return str;
+    }
+};
+
+inline constexpr rotate_in_place_fn rotate_in_place;
+
+// ==================== Reverse Words ====================
+
+/**
+ * @brief Reverse the order of whitespace-separated words
+ *
+ * Whitespace runs are kept and mirrored with the words:
+ * "a  b c" -> "c b  a".
+ */
+struct reverse_words_fn : pipe_adaptor<reverse_words_fn> {
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        return into<owning_output_t<Str>>(str);
+    }
+
+    template <typename Out, meta::string_like Str>
+    constexpr Out into(const Str& str) const {
+        const auto sv = as_view(str);
+        return kernel_output<Out>(sv, [&sv](auto* dest, const auto* src, std::size_t n) {
+            // Whole-string reverse first, then each word back to reading order
+            simd::reverse_copy(dest, src + (sv.size() - n), n);
+            detail::reverse_each_word(dest, n);
+        });
+    }
+};
+
+inline constexpr reverse_words_fn reverse_words;
+
+struct reverse_words_in_place_fn {
+    template <detail::mutable_string Str>
+    constexpr Str& operator()(Str& str) const noexcept {
+        simd::reverse(str.data(), str.size());
+        detail::reverse_each_word(str.data(), str.size());
+        return str;
+    }
+};
+
+inline constexpr reverse_words_in_place_fn reverse_words_in_place;
+
+} // namespace zuu::str
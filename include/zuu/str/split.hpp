@@ -4,16 +4,29 @@
  * @file zuu/str/split.hpp
  * @brief Split and join operations with pipe support
  * @version 3.0.0
- * 
+ *
+ * Inputs may be any meta::string_like value. Parts follow the slice
+ * policy in policy.hpp: fstring inputs give fstring parts, string_view
+ * inputs give views into the source.
+ *
  * Usage:
  *   auto parts = split("a,b,c"_fs, ',');
  *   auto parts = "a,b,c"_fs | split(',');
  *   auto joined = join(parts, ", ");
+ *   auto status = join_into(buffer, std::vector<std::string>{...}, ',');
+ *   auto hp = split_n("host:8080"_fs, ':', 1);        // hp[0] "host", hp[1] "8080"
+ *   auto hp = split_n(std::string_view(addr), ':', 1); // views into addr
  */
 
 #include "../core/core.hpp"
+#include "../core/inline_vector.hpp"
+#include "../simd/search.hpp"
 #include "pipe.hpp"
-#include <array>
+#include "policy.hpp"
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
 
 namespace zuu::str {
 
@@ -21,64 +34,59 @@ namespace zuu::str {
 
 /**
  * @brief Container for split results
- * 
- * Provides array-like interface with actual count of parts
+ *
+ * Parts live in uninitialized inline storage: only the parts actually
+ * found are constructed, so cost scales with size() rather than MaxParts.
  */
 template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
-struct split_result {
-    basic_fstring<CharT, Cap> parts[MaxParts];
-    std::size_t count = 0;
-    
-    // Container interface
-    [[nodiscard]] constexpr auto begin() noexcept { return parts; }
-    [[nodiscard]] constexpr auto end() noexcept { return parts + count; }
-    [[nodiscard]] constexpr auto begin() const noexcept { return parts; }
-    [[nodiscard]] constexpr auto end() const noexcept { return parts + count; }
-    
-    [[nodiscard]] constexpr std::size_t size() const noexcept { return count; }
-    [[nodiscard]] constexpr bool empty() const noexcept { return count == 0; }
-    
-    [[nodiscard]] constexpr auto& operator[](std::size_t idx) noexcept {
-        return parts[idx];
+using split_result = inline_vector<basic_fstring<CharT, Cap>, MaxParts>;
+
+// Split result for any input type (split_result for fstrings)
+template <typename Str, std::size_t MaxParts = 16>
+using split_result_for = inline_vector<slice_output_t<Str>, MaxParts>;
+
+namespace detail {
+
+// Append [first, last) as a new part, skipping empty ranges
+template <typename Result, meta::character CharT>
+constexpr void emit_part(Result& result, const CharT* first, const CharT* last) {
+    if (first != last) {
+        result.emplace_back(first, static_cast<std::size_t>(last - first));
     }
-    
-    [[nodiscard]] constexpr const auto& operator[](std::size_t idx) const noexcept {
-        return parts[idx];
+}
+
+// Split [first, last) on a single delimiter, left to right
+template <typename Result, meta::character CharT>
+constexpr void split_char_into(
+    Result& result,
+    const CharT* first,
+    const CharT* last,
+    CharT delimiter
+) {
+    while (!result.full()) {
+        const CharT* found = simd::find_char(first, last, delimiter);
+        emit_part(result, first, found);
+        if (found == last) break;
+        first = found + 1;
     }
-};
+}
+
+} // namespace detail
 
 // ==================== Split by Character ====================
 
 struct split_char_fn {
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
+    template <meta::string_like Str, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap>& str, 
-        CharT delimiter
-    ) const noexcept {
-        split_result<CharT, Cap, MaxParts> result;
-        basic_fstring<CharT, Cap> current;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            if (str[i] == delimiter) {
-                if (!current.empty() && result.count < MaxParts) {
-                    result.parts[result.count++] = current;
-                    current.clear();
-                }
-            } else {
-                if (!current.full()) {
-                    current.push_back(str[i]);
-                }
-            }
-        }
-        
-        // Add last part if not empty
-        if (!current.empty() && result.count < MaxParts) {
-            result.parts[result.count++] = current;
-        }
-        
+        const Str& str,
+        meta::char_type_of_t<Str> delimiter
+    ) const {
+        const auto sv = as_view(str);
+        split_result_for<Str, MaxParts> result;
+        detail::split_char_into(result, sv.data(), sv.data() + sv.size(), delimiter);
         return result;
     }
-    
+
     // Factory for piping: str | split(',')
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
@@ -93,68 +101,47 @@ inline constexpr split_char_fn split;
 // ==================== Split by String ====================
 
 struct split_str_fn {
-    template <meta::character CharT, std::size_t Cap, std::size_t DelimCap, std::size_t MaxParts = 16>
+    template <meta::string_like Str, detail::needle_for<Str> Delim, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap>& str,
-        const basic_fstring<CharT, DelimCap>& delimiter
-    ) const noexcept {
-        split_result<CharT, Cap, MaxParts> result;
-        
-        if (delimiter.empty()) {
-            if (result.count < MaxParts) {
-                result.parts[result.count++] = str;
-            }
+        const Str& str,
+        const Delim& delimiter
+    ) const {
+        const auto sv = as_view(str);
+        const auto delim = detail::needle_view(delimiter);
+        split_result_for<Str, MaxParts> result;
+
+        if (delim.empty()) {
+            detail::emit_part(result, sv.data(), sv.data() + sv.size());
             return result;
         }
-        
+
         std::size_t pos = 0;
-        
-        while (pos < str.size() && result.count < MaxParts) {
-            std::size_t found = str.find(delimiter.data(), pos);
-            
-            if (found == basic_fstring<CharT, Cap>::npos) {
+
+        while (pos < sv.size() && !result.full()) {
+            std::size_t found = sv.find(delim, pos);
+
+            if (found == npos) {
                 // No more delimiters, add remaining string
-                basic_fstring<CharT, Cap> part;
-                for (std::size_t i = pos; i < str.size() && !part.full(); ++i) {
-                    part.push_back(str[i]);
-                }
-                if (!part.empty()) {
-                    result.parts[result.count++] = part;
-                }
+                detail::emit_part(result, sv.data() + pos, sv.data() + sv.size());
                 break;
             }
-            
+
             // Add part before delimiter
-            basic_fstring<CharT, Cap> part;
-            for (std::size_t i = pos; i < found && !part.full(); ++i) {
-                part.push_back(str[i]);
-            }
-            if (!part.empty()) {
-                result.parts[result.count++] = part;
-            }
-            
-            pos = found + delimiter.size();
+            detail::emit_part(result, sv.data() + pos, sv.data() + found);
+            pos = found + delim.size();
         }
-        
+
         return result;
     }
-    
-    // Factory for piping
-    template <meta::character CharT, std::size_t DelimCap>
-    [[nodiscard]] constexpr auto operator()(const basic_fstring<CharT, DelimCap>& delimiter) const noexcept {
+
+    // Factory for piping: str | split_by("::")
+    template <typename Delim>
+    requires (!meta::character<Delim>)
+    [[nodiscard]] constexpr auto operator()(const Delim& delimiter) const noexcept {
         return [delimiter, this](const auto& str) {
             return (*this)(str, delimiter);
         };
     }
-    
-    // C-string overload
-    template <meta::character CharT>
-    [[nodiscard]] constexpr auto operator()(const CharT* delimiter) const noexcept {
-        return [delimiter, this](const auto& str) {
-            basic_fstring<CharT, 64> delim(delimiter);
-            return (*this)(str, delim);
-        };
-    }
 };
 
 inline constexpr split_str_fn split_by;
@@ -162,41 +149,33 @@ inline constexpr split_str_fn split_by;
 // ==================== Split Lines ====================
 
 struct split_lines_fn : pipe_adaptor<split_lines_fn> {
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
-    [[nodiscard]] constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        split_result<CharT, Cap, MaxParts> result;
-        basic_fstring<CharT, Cap> current;
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            CharT ch = str[i];
-            
+    template <meta::string_like Str, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto apply(const Str& str) const {
+        using char_type = meta::char_type_of_t<Str>;
+
+        const auto sv = as_view(str);
+        const char_type* last = sv.data() + sv.size();
+        const char_type* part = sv.data();
+        split_result_for<Str, MaxParts> result;
+
+        for (const char_type* it = sv.data(); it != last && !result.full(); ++it) {
             // Handle different line endings: \n, \r, \r\n
-            if (ch == CharT('\n')) {
-                if (!current.empty() && result.count < MaxParts) {
-                    result.parts[result.count++] = current;
-                    current.clear();
-                }
-            } else if (ch == CharT('\r')) {
+            if (*it == char_type('\n') || *it == char_type('\r')) {
+                detail::emit_part(result, part, it);
+
                 // Check for \r\n
-                if (i + 1 < str.size() && str[i + 1] == CharT('\n')) {
-                    ++i; // Skip the \n
-                }
-                if (!current.empty() && result.count < MaxParts) {
-                    result.parts[result.count++] = current;
-                    current.clear();
-                }
-            } else {
-                if (!current.full()) {
-                    current.push_back(ch);
+                if (*it == char_type('\r') && it + 1 != last && it[1] == char_type('\n')) {
+                    ++it; // Skip the \n
                 }
+                part = it + 1;
             }
         }
-        
+
         // Add last line if not empty
-        if (!current.empty() && result.count < MaxParts) {
-            result.parts[result.count++] = current;
+        if (!result.full()) {
+            detail::emit_part(result, part, last);
         }
-        
+
         return result;
     }
 };
@@ -206,35 +185,33 @@ inline constexpr split_lines_fn split_lines;
 // ==================== Split Whitespace ====================
 
 struct split_whitespace_fn : pipe_adaptor<split_whitespace_fn> {
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
-    [[nodiscard]] constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        split_result<CharT, Cap, MaxParts> result;
-        basic_fstring<CharT, Cap> current;
-        
-        auto is_space = [](CharT ch) constexpr {
-            return ch == CharT(' ') || ch == CharT('\t') || 
-                   ch == CharT('\n') || ch == CharT('\r') ||
-                   ch == CharT('\f') || ch == CharT('\v');
+    template <meta::string_like Str, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto apply(const Str& str) const {
+        using char_type = meta::char_type_of_t<Str>;
+
+        auto is_space = [](char_type ch) constexpr {
+            return ch == char_type(' ') || ch == char_type('\t') ||
+                   ch == char_type('\n') || ch == char_type('\r') ||
+                   ch == char_type('\f') || ch == char_type('\v');
         };
-        
-        for (std::size_t i = 0; i < str.size(); ++i) {
-            if (is_space(str[i])) {
-                if (!current.empty() && result.count < MaxParts) {
-                    result.parts[result.count++] = current;
-                    current.clear();
-                }
-            } else {
-                if (!current.full()) {
-                    current.push_back(str[i]);
-                }
+
+        const auto sv = as_view(str);
+        const char_type* last = sv.data() + sv.size();
+        const char_type* part = sv.data();
+        split_result_for<Str, MaxParts> result;
+
+        for (const char_type* it = sv.data(); it != last && !result.full(); ++it) {
+            if (is_space(*it)) {
+                detail::emit_part(result, part, it);
+                part = it + 1;
             }
         }
-        
+
         // Add last part if not empty
-        if (!current.empty() && result.count < MaxParts) {
-            result.parts[result.count++] = current;
+        if (!result.full()) {
+            detail::emit_part(result, part, last);
         }
-        
+
         return result;
     }
 };
@@ -243,103 +220,250 @@ inline constexpr split_whitespace_fn split_whitespace;
 
 // ==================== Join Operations ====================
 
+namespace detail {
+
+// Capacity reserved per delimiter in fixed-capacity join results
+template <typename Delim>
+struct delimiter_capacity : std::integral_constant<std::size_t, 64> {};
+
+template <meta::character CharT>
+struct delimiter_capacity<CharT> : std::integral_constant<std::size_t, 1> {};
+
+template <meta::fixed_string Delim>
+struct delimiter_capacity<Delim> : std::integral_constant<std::size_t, Delim::capacity> {};
+
+template <typename Delim, typename Part>
+concept delimiter_for =
+    std::same_as<Delim, meta::char_type_of_t<Part>> || needle_for<Delim, Part>;
+
+template <typename Delim>
+constexpr auto delimiter_view(const Delim& delimiter) noexcept {
+    if constexpr (meta::character<Delim>) {
+        return std::basic_string_view<Delim>{&delimiter, 1};
+    } else {
+        return needle_view(delimiter);
+    }
+}
+
+// Fixed parts join into an fstring sized for every part (rounded to a
+// size class and capped by the ceiling), anything else joins into the
+// part type's owning string
+template <typename Part, std::size_t N, typename Delim, typename Ceiling>
+struct join_output {
+    using type = owning_output_t<Part>;
+};
+
+template <meta::fixed_string Part, std::size_t N, typename Delim, typename Ceiling>
+struct join_output<Part, N, Delim, Ceiling> {
+    using type = basic_fstring<
+        meta::char_type_of_t<Part>,
+        meta::result_capacity_v<
+            Part::capacity * N + delimiter_capacity<Delim>::value * (N > 0 ? N - 1 : 0),
+            Part::capacity,
+            Ceiling::value
+        >
+    >;
+};
+
+// First pass: exact number of characters the join produces
+template <typename Parts, meta::character CharT>
+constexpr std::size_t joined_length(const Parts& parts, std::basic_string_view<CharT> delim) noexcept {
+    std::size_t total = 0;
+    std::size_t count = 0;
+
+    for (const auto& part : parts) {
+        total += as_view(part).size();
+        ++count;
+    }
+
+    return count == 0 ? 0 : total + delim.size() * (count - 1);
+}
+
+// Second pass: bulk copy into a buffer known to be large enough
+template <typename Parts, meta::character CharT>
+constexpr CharT* joined_copy(CharT* dst, const Parts& parts, std::basic_string_view<CharT> delim) noexcept {
+    using traits = std::char_traits<CharT>;
+    bool first = true;
+
+    for (const auto& part : parts) {
+        const auto sv = as_view(part);
+        if (!first) {
+            traits::copy(dst, delim.data(), delim.size());
+            dst += delim.size();
+        }
+        traits::copy(dst, sv.data(), sv.size());
+        dst += sv.size();
+        first = false;
+    }
+
+    return dst;
+}
+
+// Growable destinations (std::string and friends)
+template <typename Out, typename CharT>
+concept join_builder = requires(Out& out, const CharT* str, std::size_t len) {
+    { out.append(str, len) };
+    { out.size() } -> std::convertible_to<std::size_t>;
+    { out.max_size() } -> std::convertible_to<std::size_t>;
+};
+
+template <typename Parts>
+using range_char_t = meta::char_type_of_t<std::ranges::range_value_t<Parts>>;
+
+} // namespace detail
+
 /**
- * @brief Join array of strings with delimiter
+ * @brief Outcome of join_into
+ *
+ * On overflow nothing is written; `required` tells how much room
+ * the full join needs.
  */
-struct join_fn {
-    // Join with character delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t N>
-    [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap> (&parts)[N],
-        CharT delimiter
+struct join_status {
+    std::size_t written = 0;
+    std::size_t required = 0;
+    bool overflow = false;
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return !overflow; }
+};
+
+/**
+ * @brief Join any forward range of strings into a caller-chosen destination
+ *
+ * Measures the exact result length first, then copies every part with a
+ * single bulk copy. Destinations:
+ *   - basic_fstring<C, N>&   appended to, limited by available()
+ *   - std::span<C>           written from the start, no terminator
+ *   - builders (std::string) reserved once, then appended to
+ *
+ * Usage:
+ *   fstring<64> out;
+ *   if (!join_into(out, names, ", ")) { handle overflow }
+ */
+struct join_into_fn {
+    template <meta::character CharT, std::size_t N, meta::string_range Parts, typename Delim>
+    requires std::ranges::forward_range<const Parts&> &&
+             std::same_as<detail::range_char_t<Parts>, CharT> &&
+             detail::delimiter_for<Delim, std::ranges::range_value_t<Parts>>
+    constexpr join_status operator()(
+        basic_fstring<CharT, N>& out,
+        const Parts& parts,
+        const Delim& delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * N + N;
-        basic_fstring<CharT, result_cap> result;
-        
-        for (std::size_t i = 0; i < N; ++i) {
-            if (i > 0 && !result.full()) {
-                result.push_back(delimiter);
-            }
-            if (!result.full()) {
-                result.append(parts[i].data(), parts[i].size());
-            }
-        }
-        
-        return result;
+        const auto delim = detail::delimiter_view(delimiter);
+        const std::size_t required = detail::joined_length(parts, delim);
+        if (required > out.available()) return {0, required, true};
+
+        const std::size_t offset = out.size();
+        out.resize_and_overwrite(offset + required, [&](CharT* data, std::size_t count) {
+            detail::joined_copy(data + offset, parts, delim);
+            return count;
+        });
+
+        return {required, required, false};
     }
-    
-    // Join with string delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t N, std::size_t DelimCap>
-    [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap> (&parts)[N],
-        const basic_fstring<CharT, DelimCap>& delimiter
+
+    template <meta::character CharT, meta::string_range Parts, typename Delim>
+    requires std::ranges::forward_range<const Parts&> &&
+             std::same_as<detail::range_char_t<Parts>, CharT> &&
+             detail::delimiter_for<Delim, std::ranges::range_value_t<Parts>>
+    constexpr join_status operator()(
+        std::span<CharT> out,
+        const Parts& parts,
+        const Delim& delimiter
     ) const noexcept {
-        constexpr std::size_t result_cap = Cap * N + DelimCap * N;
-        basic_fstring<CharT, result_cap> result;
-        
-        for (std::size_t i = 0; i < N; ++i) {
-            if (i > 0 && !result.full()) {
-                result.append(delimiter.data(), delimiter.size());
-            }
-            if (!result.full()) {
-                result.append(parts[i].data(), parts[i].size());
-            }
+        const auto delim = detail::delimiter_view(delimiter);
+        const std::size_t required = detail::joined_length(parts, delim);
+        if (required > out.size()) return {0, required, true};
+
+        detail::joined_copy(out.data(), parts, delim);
+        return {required, required, false};
+    }
+
+    template <typename Out, meta::string_range Parts, typename Delim>
+    requires std::ranges::forward_range<const Parts&> &&
+             detail::join_builder<Out, detail::range_char_t<Parts>> &&
+             detail::delimiter_for<Delim, std::ranges::range_value_t<Parts>>
+    constexpr join_status operator()(
+        Out& out,
+        const Parts& parts,
+        const Delim& delimiter
+    ) const {
+        const auto delim = detail::delimiter_view(delimiter);
+        const std::size_t required = detail::joined_length(parts, delim);
+        if (required > out.max_size() - out.size()) return {0, required, true};
+
+        if constexpr (requires { out.reserve(out.size() + required); }) {
+            out.reserve(out.size() + required);
         }
-        
-        return result;
+
+        bool first = true;
+        for (const auto& part : parts) {
+            const auto sv = as_view(part);
+            if (!first) out.append(delim.data(), delim.size());
+            out.append(sv.data(), sv.size());
+            first = false;
+        }
+
+        return {required, required, false};
     }
-    
-    // Join split_result with character delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts>
+};
+
+inline constexpr join_into_fn join_into;
+
+/**
+ * @brief Join array of strings with delimiter
+ *
+ * Parts may be any string-like type; the delimiter may be a character,
+ * a C-string or a string-like value. Built on join_into: the result is
+ * measured once and bulk-copied (truncated if it does not fit).
+ *
+ * Fixed-capacity results follow meta::result_capacity_v; pass
+ * meta::capacity_ceiling<N>{} as a third argument to override the cap.
+ */
+struct join_fn {
+    // Join a C array of parts
+    template <meta::string_like Part, std::size_t N, typename Delim,
+              typename Ceiling = meta::default_capacity_ceiling>
+    requires detail::delimiter_for<Delim, Part>
     [[nodiscard]] constexpr auto operator()(
-        const split_result<CharT, Cap, MaxParts>& result,
-        CharT delimiter
-    ) const noexcept {
-        constexpr std::size_t result_cap = Cap * MaxParts + MaxParts;
-        basic_fstring<CharT, result_cap> joined;
-        
-        for (std::size_t i = 0; i < result.count; ++i) {
-            if (i > 0 && !joined.full()) {
-                joined.push_back(delimiter);
-            }
-            if (!joined.full()) {
-                joined.append(result.parts[i].data(), result.parts[i].size());
-            }
-        }
-        
-        return joined;
+        const Part (&parts)[N],
+        const Delim& delimiter,
+        Ceiling = {}
+    ) const {
+        using out_t = typename detail::join_output<Part, N, Delim, Ceiling>::type;
+        return join_truncated<out_t>(parts, delimiter);
     }
-    
-    // Join split_result with string delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts, std::size_t DelimCap>
+
+    // Join a split result
+    template <meta::string_like Part, std::size_t MaxParts, typename Delim,
+              typename Ceiling = meta::default_capacity_ceiling>
+    requires detail::delimiter_for<Delim, Part>
     [[nodiscard]] constexpr auto operator()(
-        const split_result<CharT, Cap, MaxParts>& result,
-        const basic_fstring<CharT, DelimCap>& delimiter
-    ) const noexcept {
-        constexpr std::size_t result_cap = Cap * MaxParts + DelimCap * MaxParts;
-        basic_fstring<CharT, result_cap> joined;
-        
-        for (std::size_t i = 0; i < result.count; ++i) {
-            if (i > 0 && !joined.full()) {
-                joined.append(delimiter.data(), delimiter.size());
-            }
-            if (!joined.full()) {
-                joined.append(result.parts[i].data(), result.parts[i].size());
+        const inline_vector<Part, MaxParts>& parts,
+        const Delim& delimiter,
+        Ceiling = {}
+    ) const {
+        using out_t = typename detail::join_output<Part, MaxParts, Delim, Ceiling>::type;
+        return join_truncated<out_t>(parts, delimiter);
+    }
+
+private:
+    template <typename Out, typename Parts, typename Delim>
+    static constexpr Out join_truncated(const Parts& parts, const Delim& delimiter) {
+        Out joined;
+        if (!join_into(joined, parts, delimiter)) {
+            // Does not fit: fall back to appending what fits
+            const auto delim = detail::delimiter_view(delimiter);
+            bool first = true;
+            for (const auto& part : parts) {
+                const auto sv = as_view(part);
+                if (!first) joined.append(delim.data(), delim.size());
+                joined.append(sv.data(), sv.size());
+                first = false;
             }
         }
-        
         return joined;
     }
-    
-    // Join with C-string delimiter
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts>
-    [[nodiscard]] constexpr auto operator()(
-        const split_result<CharT, Cap, MaxParts>& result,
-        const CharT* delimiter
-    ) const noexcept {
-        basic_fstring<CharT, 64> delim(delimiter);
-        return (*this)(result, delim);
-    }
 };
 
 inline constexpr join_fn join;
@@ -347,33 +471,34 @@ inline constexpr join_fn join;
 // ==================== Partition (Split into 2 parts) ====================
 
 struct partition_fn {
-    template <meta::character CharT, std::size_t Cap>
+    template <meta::string_like Str>
     [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT delimiter
-    ) const noexcept {
+        const Str& str,
+        meta::char_type_of_t<Str> delimiter
+    ) const {
+        using part_t = slice_output_t<Str>;
+
         struct result_t {
-            basic_fstring<CharT, Cap> first;
-            basic_fstring<CharT, Cap> second;
+            part_t first;
+            part_t second;
             bool found = false;
         };
-        
+
+        const auto sv = as_view(str);
+        const std::size_t pos = sv.find(delimiter);
         result_t result;
-        std::size_t pos = str.find(delimiter);
-        
-        if (pos != basic_fstring<CharT, Cap>::npos) {
+
+        if (pos != npos) {
             result.found = true;
-            result.first = str.template substr<Cap>(0, pos);
-            if (pos + 1 < str.size()) {
-                result.second = str.template substr<Cap>(pos + 1);
-            }
+            result.first = make_output<part_t>(sv.substr(0, pos));
+            result.second = make_output<part_t>(sv.substr(pos + 1));
         } else {
-            result.first = str;
+            result.first = make_output<part_t>(sv);
         }
-        
+
         return result;
     }
-    
+
     // Factory for piping
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
@@ -388,52 +513,38 @@ inline constexpr partition_fn partition;
 // ==================== Reverse Split (from right) ====================
 
 struct rsplit_fn {
-    template <meta::character CharT, std::size_t Cap, std::size_t MaxParts = 16>
+    template <meta::string_like Str, std::size_t MaxParts = 16>
     [[nodiscard]] constexpr auto operator()(
-        const basic_fstring<CharT, Cap>& str,
-        CharT delimiter
-    ) const noexcept {
-        split_result<CharT, Cap, MaxParts> result;
-        basic_fstring<CharT, Cap> current;
-        
-        // Build parts in reverse
-        for (std::size_t i = str.size(); i > 0 && result.count < MaxParts; --i) {
-            CharT ch = str[i - 1];
-            
-            if (ch == delimiter) {
-                if (!current.empty()) {
-                    // Reverse current part before storing
-                    basic_fstring<CharT, Cap> reversed;
-                    for (std::size_t j = current.size(); j > 0; --j) {
-                        reversed.push_back(current[j - 1]);
-                    }
-                    result.parts[result.count++] = reversed;
-                    current.clear();
-                }
-            } else {
-                current.push_back(ch);
-            }
-        }
-        
-        // Add last part
-        if (!current.empty() && result.count < MaxParts) {
-            basic_fstring<CharT, Cap> reversed;
-            for (std::size_t j = current.size(); j > 0; --j) {
-                reversed.push_back(current[j - 1]);
+        const Str& str,
+        meta::char_type_of_t<Str> delimiter
+    ) const {
+        using char_type = meta::char_type_of_t<Str>;
+
+        const auto sv = as_view(str);
+        const char_type* begin = sv.data();
+        const char_type* end = sv.data() + sv.size();
+        split_result_for<Str, MaxParts> result;
+
+        // Walk back until MaxParts parts are covered, then split forward
+        // from there: parts come out in order without any reversing
+        const char_type* first = begin;
+        std::size_t parts = 0;
+
+        for (const char_type* it = end; it != begin;) {
+            const char_type* found = simd::rfind_char(begin, it, delimiter);
+            if (found == it) break;  // no delimiter left
+
+            if (found + 1 != it && ++parts == MaxParts) {
+                first = found + 1;
+                break;
             }
-            result.parts[result.count++] = reversed;
+            it = found;
         }
-        
-        // Reverse the entire result array
-        for (std::size_t i = 0; i < result.count / 2; ++i) {
-            auto temp = result.parts[i];
-            result.parts[i] = result.parts[result.count - 1 - i];
-            result.parts[result.count - 1 - i] = temp;
-        }
-        
+
+        detail::split_char_into(result, first, end, delimiter);
         return result;
     }
-    
+
     // Factory for piping
     template <meta::character CharT>
     [[nodiscard]] constexpr auto operator()(CharT delimiter) const noexcept {
@@ -445,4 +556,106 @@ struct rsplit_fn {
 
 inline constexpr rsplit_fn rsplit;
 
-} // namespace zuu::str
\ No newline at end of file
+// ==================== Split With Limit ====================
+
+/**
+ * @brief Split at most `maxsplit` times, scanning left to right
+ *
+ * Stops scanning as soon as the limit is reached; the remainder becomes
+ * the last part. Unlike split(), empty fields are kept so that positions
+ * are preserved ("a::b" with ':' gives "a", "", "b"). Parts follow the
+ * slice policy like split(): views for view inputs, copies otherwise.
+ */
+struct split_n_fn {
+    template <meta::string_like Str, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto operator()(
+        const Str& str,
+        meta::char_type_of_t<Str> delimiter,
+        std::size_t maxsplit = MaxParts - 1
+    ) const {
+        using char_type = meta::char_type_of_t<Str>;
+
+        const auto sv = as_view(str);
+        split_result_for<Str, MaxParts> result;
+        maxsplit = std::min(maxsplit, MaxParts - 1);
+
+        const char_type* first = sv.data();
+        const char_type* last = sv.data() + sv.size();
+
+        for (std::size_t splits = 0; splits < maxsplit; ++splits) {
+            const char_type* found = simd::find_char(first, last, delimiter);
+            if (found == last) break;
+            result.emplace_back(first, static_cast<std::size_t>(found - first));
+            first = found + 1;
+        }
+
+        result.emplace_back(first, static_cast<std::size_t>(last - first));
+        return result;
+    }
+
+    // Factory for piping: str | split_n(':', 1)
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT delimiter, std::size_t maxsplit) const noexcept {
+        return [delimiter, maxsplit, this](const auto& str) {
+            return (*this)(str, delimiter, maxsplit);
+        };
+    }
+};
+
+inline constexpr split_n_fn split_n;
+
+/**
+ * @brief Split at most `maxsplit` times, scanning right to left
+ *
+ * Parts are returned in source order; the unsplit remainder is the
+ * first part. `rsplit_n(path, '/', 1)` yields { dirname, basename }.
+ */
+struct rsplit_n_fn {
+    template <meta::string_like Str, std::size_t MaxParts = 16>
+    [[nodiscard]] constexpr auto operator()(
+        const Str& str,
+        meta::char_type_of_t<Str> delimiter,
+        std::size_t maxsplit = MaxParts - 1
+    ) const {
+        using char_type = meta::char_type_of_t<Str>;
+
+        const auto sv = as_view(str);
+        split_result_for<Str, MaxParts> result;
+        maxsplit = std::min(maxsplit, MaxParts - 1);
+
+        const char_type* first = sv.data();
+        const char_type* last = sv.data() + sv.size();
+
+        // Record delimiter positions from the right, then emit in order
+        const char_type* cuts[MaxParts];
+        std::size_t ncuts = 0;
+
+        for (const char_type* end = last; ncuts < maxsplit; ) {
+            const char_type* found = simd::rfind_char(first, end, delimiter);
+            if (found == end) break;
+            cuts[ncuts++] = found;
+            end = found;
+        }
+
+        const char_type* part = first;
+        for (std::size_t i = ncuts; i > 0; --i) {
+            result.emplace_back(part, static_cast<std::size_t>(cuts[i - 1] - part));
+            part = cuts[i - 1] + 1;
+        }
+
+        result.emplace_back(part, static_cast<std::size_t>(last - part));
+        return result;
+    }
+
+    // Factory for piping: str | rsplit_n('/', 1)
+    template <meta::character CharT>
+    [[nodiscard]] constexpr auto operator()(CharT delimiter, std::size_t maxsplit) const noexcept {
+        return [delimiter, maxsplit, this](const auto& str) {
+            return (*this)(str, delimiter, maxsplit);
+        };
+    }
+};
+
+inline constexpr rsplit_n_fn rsplit_n;
+
+} // namespace zuu::str
@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file zuu/str/stats.hpp
+ * @brief One-pass character statistics with pipe support
+ * @version 3.0.0
+ *
+ * `char_classes` counts ASCII, digit, alpha, space, control and non-ASCII
+ * code units with vector compares; `stats` additionally builds a full
+ * histogram of code unit values (< 256) and derives the class counts
+ * from it, still in a single pass over the input.
+ *
+ * Usage:
+ *   if ((str | char_classes).is_ascii()) { ... ASCII fast path ... }
+ *   auto s = str | stats;
+ *   double digits = s.classes.ratio(s.classes.digit);
+ *   std::size_t commas = s.histogram[','];
+ */
+
+#include "../core/core.hpp"
+#include "../simd/stats.hpp"
+#include "pipe.hpp"
+#include "policy.hpp"
+
+namespace zuu::str {
+
+using char_class_counts = simd::class_counts;
+
+struct text_stats {
+    char_class_counts classes;
+    simd::histogram histogram{};
+
+    [[nodiscard]] constexpr bool is_ascii() const noexcept { return classes.is_ascii(); }
+    [[nodiscard]] constexpr bool has_control() const noexcept { return classes.has_control(); }
+};
+
+// ==================== Class Counts ====================
+
+struct char_classes_fn : pipe_adaptor<char_classes_fn> {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr char_class_counts apply(const Str& str) const noexcept {
+        const auto sv = as_view(str);
+        return simd::count_classes(sv.data(), sv.size());
+    }
+};
+
+inline constexpr char_classes_fn char_classes;
+
+// ==================== Full Statistics ====================
+
+struct stats_fn : pipe_adaptor<stats_fn> {
+    template <meta::string_like Str>
+    [[nodiscard]] constexpr text_stats apply(const Str& str) const noexcept {
+        const auto sv = as_view(str);
+
+        text_stats result;
+        simd::byte_histogram(sv.data(), sv.size(), result.histogram);
+        result.classes = simd::classes_of(result.histogram);
+
+        // Wide code units >= 256 are not tabulated but are still non-ASCII
+        result.classes.non_ascii += sv.size() - result.classes.total;
+        result.classes.total = sv.size();
+        return result;
+    }
+};
+
+inline constexpr stats_fn stats;
+
+} // namespace zuu::str
@@ -9,10 +9,12 @@
  *   auto result = trim(str);           // Traditional
  *   auto result = str | trim;           // Piped
  *   auto result = str | trim_left;      // Left only
+ *   auto view = std::string_view{"  x "} | trim;  // Zero-copy view
  */
 
 #include "../core/core.hpp"
 #include "pipe.hpp"
+#include "policy.hpp"
 #include <string_view>
 
 namespace zuu::str {
@@ -44,36 +46,14 @@ constexpr std::size_t find_last_non_space(std::basic_string_view<CharT> sv) noex
 
 // ==================== Trim Left ====================
 
-struct trim_left_fn : view_pipe<trim_left_fn> {
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        const auto start = find_first_non_space(sv);
-        
-        // Return same capacity fstring
-        constexpr std::size_t result_cap = 256; // Default, will be optimized
-        basic_fstring<CharT, result_cap> result;
-        
-        if (start < sv.size()) {
-            const auto trimmed = sv.substr(start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    // Overload for fixed-capacity strings (preserve capacity)
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
+struct trim_left_fn : pipe_adaptor<trim_left_fn> {
+    // Views stay views, owning strings keep their type (see policy.hpp)
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        const auto sv = as_view(str);
         const auto start = find_first_non_space(sv);
         
-        basic_fstring<CharT, Cap> result;
-        if (start < sv.size()) {
-            const auto trimmed = sv.substr(start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+        return make_output<slice_output_t<Str>>(sv.substr(start));
     }
 };
 
@@ -81,34 +61,13 @@ inline constexpr trim_left_fn trim_left;
 
 // ==================== Trim Right ====================
 
-struct trim_right_fn : view_pipe<trim_right_fn> {
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        const auto end = find_last_non_space(sv);
-        
-        constexpr std::size_t result_cap = 256;
-        basic_fstring<CharT, result_cap> result;
-        
-        if (end > 0) {
-            const auto trimmed = sv.substr(0, end);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
+struct trim_right_fn : pipe_adaptor<trim_right_fn> {
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        const auto sv = as_view(str);
         const auto end = find_last_non_space(sv);
         
-        basic_fstring<CharT, Cap> result;
-        if (end > 0) {
-            const auto trimmed = sv.substr(0, end);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+        return make_output<slice_output_t<Str>>(sv.substr(0, end));
     }
 };
 
@@ -116,36 +75,15 @@ inline constexpr trim_right_fn trim_right;
 
 // ==================== Trim Both ====================
 
-struct trim_fn : view_pipe<trim_fn> {
-    template <meta::character CharT>
-    constexpr auto apply(std::basic_string_view<CharT> sv) const noexcept {
-        const auto start = find_first_non_space(sv);
-        const auto end = find_last_non_space(sv);
-        
-        constexpr std::size_t result_cap = 256;
-        basic_fstring<CharT, result_cap> result;
-        
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
-    }
-
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto apply(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
+struct trim_fn : pipe_adaptor<trim_fn> {
+    template <meta::string_like Str>
+    constexpr auto apply(const Str& str) const {
+        const auto sv = as_view(str);
         const auto start = find_first_non_space(sv);
         const auto end = find_last_non_space(sv);
         
-        basic_fstring<CharT, Cap> result;
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+        return make_output<slice_output_t<Str>>(
+            start < end ? sv.substr(start, end - start) : sv.substr(0, 0));
     }
 };
 
@@ -159,9 +97,9 @@ struct trim_if_fn {
 
     constexpr trim_if_fn(Pred p) : predicate{std::move(p)} {}
 
-    template <meta::character CharT, std::size_t Cap>
-    constexpr auto operator()(const basic_fstring<CharT, Cap>& str) const noexcept {
-        std::basic_string_view<CharT> sv{str.data(), str.size()};
+    template <meta::string_like Str>
+    constexpr auto operator()(const Str& str) const {
+        const auto sv = as_view(str);
         
         std::size_t start = 0;
         while (start < sv.size() && predicate(sv[start])) ++start;
@@ -169,13 +107,7 @@ struct trim_if_fn {
         std::size_t end = sv.size();
         while (end > start && predicate(sv[end - 1])) --end;
         
-        basic_fstring<CharT, Cap> result;
-        if (start < end) {
-            const auto trimmed = sv.substr(start, end - start);
-            result.append(trimmed.data(), trimmed.size());
-        }
-        
-        return result;
+        return make_output<slice_output_t<Str>>(sv.substr(start, end - start));
     }
 
     template <meta::string_like Str>
@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file zuu/stream.hpp
+ * @brief Coroutine streaming pipelines over fstring records
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: sources read lines lazily, stages apply
+ * str:: pipes per record and sinks drain the stream. Nothing is batched;
+ * one record is in flight per stage.
+ *
+ * @code
+ * #include <zuu/stream.hpp>
+ * using namespace zuu;
+ *
+ * auto written = stream::file_lines<256>("app.log")
+ *     | stream::transform(str::trim)
+ *     | stream::filter([](const auto& line) { return line.starts_with("ERROR"); })
+ *     | stream::write_to(stdout);
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "stream/generator.hpp"
+#include "stream/source.hpp"
+#include "stream/stage.hpp"
+#include "stream/sink.hpp"
+#include "stream/pipeline.hpp"
+#include "stream/mapped_file.hpp"
+#include "stream/parallel_split.hpp"
@@ -0,0 +1,250 @@
+#pragma once
+
+/**
+ * @file zuu/stream/generator.hpp
+ * @brief Lazy coroutine generator with pooled frames
+ * @version 3.0.0
+ *
+ * generator<T> yields references: `co_yield value` hands the consumer a
+ * pointer to `value` for the duration of the suspension, so records are
+ * never copied between stages. Coroutine frames (and source buffers, see
+ * pooled_buffer) come from a thread-local free list, so tearing down and
+ * rebuilding a pipeline reuses the previous allocations.
+ *
+ * Usage:
+ *   generator<int> iota(int n) { for (int i = 0; i < n; ++i) co_yield i; }
+ *   for (const int& i : iota(3)) { ... }
+ */
+
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace zuu::stream {
+
+// ==================== Frame Pool ====================
+
+/**
+ * @brief Thread-local free lists of power-of-two blocks (256 B to 1 MiB)
+ *
+ * At most `max_cached` blocks are kept per size class; larger requests go
+ * straight to operator new.
+ */
+class frame_pool {
+public:
+    static constexpr std::size_t min_block = 256;
+    static constexpr std::size_t max_block = std::size_t{1} << 20;
+    static constexpr std::size_t max_cached = 8;
+
+    frame_pool() = default;
+    frame_pool(const frame_pool&) = delete;
+    frame_pool& operator=(const frame_pool&) = delete;
+
+    ~frame_pool() {
+        for (auto& list : free_) {
+            while (list.head) {
+                node* next = list.head->next;
+                ::operator delete(list.head);
+                list.head = next;
+            }
+        }
+    }
+
+    [[nodiscard]] static frame_pool& local() noexcept {
+        thread_local frame_pool pool;
+        return pool;
+    }
+
+    [[nodiscard]] void* allocate(std::size_t n) {
+        const std::size_t cls = class_of(n);
+        if (cls == no_class) return ::operator new(n);
+
+        auto& list = free_[cls];
+        if (list.head) {
+            node* block = list.head;
+            list.head = block->next;
+            --list.count;
+            ++reused_;
+            return block;
+        }
+        return ::operator new(block_size(cls));
+    }
+
+    void deallocate(void* p, std::size_t n) noexcept {
+        const std::size_t cls = class_of(n);
+        if (cls == no_class || free_[cls].count == max_cached) {
+            ::operator delete(p);
+            return;
+        }
+
+        auto& list = free_[cls];
+        list.head = ::new (p) node{list.head};
+        ++list.count;
+    }
+
+    // Allocations served from a free list so far
+    [[nodiscard]] std::size_t reused() const noexcept { return reused_; }
+
+private:
+    struct node {
+        node* next;
+    };
+
+    struct free_list {
+        node* head = nullptr;
+        std::size_t count = 0;
+    };
+
+    static constexpr std::size_t no_class = static_cast<std::size_t>(-1);
+    static constexpr std::size_t class_count =
+        std::bit_width(max_block) - std::bit_width(min_block) + 1;
+
+    static constexpr std::size_t class_of(std::size_t n) noexcept {
+        if (n > max_block) return no_class;
+        if (n <= min_block) return 0;
+        return std::bit_width(n - 1) - std::bit_width(min_block - 1);
+    }
+
+    static constexpr std::size_t block_size(std::size_t cls) noexcept {
+        return min_block << cls;
+    }
+
+    free_list free_[class_count];
+    std::size_t reused_ = 0;
+};
+
+/**
+ * @brief Fixed-size scratch array allocated from the frame pool
+ */
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+class pooled_buffer {
+public:
+    explicit pooled_buffer(std::size_t n)
+        : data_{static_cast<T*>(frame_pool::local().allocate(n * sizeof(T)))}, size_{n} {}
+
+    pooled_buffer(const pooled_buffer&) = delete;
+    pooled_buffer& operator=(const pooled_buffer&) = delete;
+
+    ~pooled_buffer() { frame_pool::local().deallocate(data_, size_ * sizeof(T)); }
+
+    [[nodiscard]] T* data() noexcept { return data_; }
+    [[nodiscard]] const T* data() const noexcept { return data_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+// ==================== Generator ====================
+
+/**
+ * @brief Single-pass lazy sequence of `const T&`
+ *
+ * The body does not run until begin() (or next()). A yielded reference is
+ * valid until the generator is resumed again. Exceptions thrown by the
+ * body propagate out of begin() / operator++ / next().
+ */
+template <typename T>
+class [[nodiscard]] generator {
+public:
+    using value_type = std::remove_cvref_t<T>;
+    using reference = const value_type&;
+
+    struct promise_type {
+        const value_type* current = nullptr;
+
+        generator get_return_object() noexcept {
+            return generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        // Temporaries in the co_yield expression outlive the suspension
+        std::suspend_always yield_value(const value_type& value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+        void unhandled_exception() { throw; }
+
+        static void* operator new(std::size_t n) { return frame_pool::local().allocate(n); }
+        static void operator delete(void* p, std::size_t n) noexcept { frame_pool::local().deallocate(p, n); }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    class iterator {
+    public:
+        using value_type = generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(handle_type h) noexcept : h_{h} {}
+
+        reference operator*() const noexcept { return *h_.promise().current; }
+        const value_type* operator->() const noexcept { return h_.promise().current; }
+
+        iterator& operator++() {
+            h_.resume();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+            return !it.h_ || it.h_.done();
+        }
+
+    private:
+        handle_type h_{};
+    };
+
+    generator() noexcept = default;
+    generator(generator&& other) noexcept : h_{std::exchange(other.h_, {})} {}
+
+    generator& operator=(generator&& other) noexcept {
+        if (this != &other) {
+            if (h_) h_.destroy();
+            h_ = std::exchange(other.h_, {});
+        }
+        return *this;
+    }
+
+    ~generator() {
+        if (h_) h_.destroy();
+    }
+
+    // Starts the body; call once
+    iterator begin() {
+        if (h_) h_.resume();
+        return iterator{h_};
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+    /**
+     * @brief Pull the next item, or nullptr once the sequence is exhausted
+     */
+    const value_type* next() {
+        if (!h_ || h_.done()) return nullptr;
+        h_.resume();
+        return h_.done() ? nullptr : h_.promise().current;
+    }
+
+private:
+    explicit generator(handle_type h) noexcept : h_{h} {}
+
+    handle_type h_{};
+};
+
+} // namespace zuu::stream
@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file zuu/stream/mapped_file.hpp
+ * @brief Read-only memory-mapped files and zero-copy line views over them
+ * @version 3.0.0
+ *
+ * Regular files are mapped with mmap; pipes, terminals and systems without
+ * <sys/mman.h> fall back to reading the whole input into one buffer, so
+ * callers always get a single contiguous view. mapped_lines() yields each
+ * line as a string_view into the mapping: no copy and no truncation,
+ * unlike the fstring sources in source.hpp.
+ *
+ * Usage:
+ *   stream::mapped_file file("access.log");
+ *   if (!file) { ... }
+ *   for (std::string_view line : stream::mapped_lines(file)) { ... }
+ *
+ *   stream::mapped_file input(STDIN_FILENO);   // read to end, not mapped
+ */
+
+#include "generator.hpp"
+#include "source.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#if defined(ZUU_STREAM_HAS_FD) && __has_include(<sys/mman.h>)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define ZUU_STREAM_HAS_MMAP 1
+#endif
+
+namespace zuu::stream {
+
+class mapped_file {
+public:
+    mapped_file() noexcept = default;
+
+    /**
+     * @brief Map (or read) the file at `path`; check operator bool afterwards
+     */
+    explicit mapped_file(const char* path) {
+#if defined(ZUU_STREAM_HAS_MMAP)
+        const int fd = path ? ::open(path, O_RDONLY) : -1;
+        if (fd < 0) return;
+        load(fd);
+        ::close(fd);
+#else
+        detail::file_handle file{path ? std::fopen(path, "rb") : nullptr};
+        if (!file) return;
+        auto read = [f = file.get()](char* buffer, std::size_t n) { return std::fread(buffer, 1, n, f); };
+        read_all(read);
+#endif
+    }
+
+#if defined(ZUU_STREAM_HAS_FD)
+    /**
+     * @brief Map a regular file, or read a pipe to its end (fd is not closed)
+     */
+    explicit mapped_file(int fd) {
+        if (fd >= 0) load(fd);
+    }
+#endif
+
+    mapped_file(mapped_file&& other) noexcept
+        : data_{std::exchange(other.data_, nullptr)},
+          size_{std::exchange(other.size_, 0)},
+          mapped_{std::exchange(other.mapped_, false)},
+          buffer_{std::move(other.buffer_)} {}
+
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            mapped_ = std::exchange(other.mapped_, false);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file() { release(); }
+
+    [[nodiscard]] const char* data() const noexcept { return data_ ? data_ : ""; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] std::string_view view() const noexcept { return {data(), size_}; }
+
+    // True once the input was opened, even if it is empty
+    [[nodiscard]] bool is_open() const noexcept { return data_ != nullptr; }
+    [[nodiscard]] explicit operator bool() const noexcept { return is_open(); }
+
+    // True if backed by mmap rather than a read buffer
+    [[nodiscard]] bool is_mapped() const noexcept { return mapped_; }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::unique_ptr<char[]> buffer_;
+
+#if defined(ZUU_STREAM_HAS_FD)
+    void load(int fd) {
+#if defined(ZUU_STREAM_HAS_MMAP)
+        struct stat info{};
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+            size_ = static_cast<std::size_t>(info.st_size);
+            if (size_ == 0) {
+                data_ = "";
+                return;
+            }
+            void* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map != MAP_FAILED) {
+                ::madvise(map, size_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(map);
+                mapped_ = true;
+                return;
+            }
+            size_ = 0;  // fall back to reading
+        }
+#endif
+        auto read = [fd](char* buffer, std::size_t n) -> std::size_t {
+            for (;;) {
+                const auto got = ::read(fd, buffer, n);
+                if (got >= 0) return static_cast<std::size_t>(got);
+                if (errno != EINTR) return 0;
+            }
+        };
+        read_all(read);
+    }
+#endif
+
+    // Read to end, doubling the buffer as needed
+    template <typename Read>
+    void read_all(Read& read) {
+        std::size_t capacity = default_chunk_size;
+        buffer_ = std::make_unique<char[]>(capacity);
+        size_ = 0;
+
+        for (;;) {
+            if (size_ == capacity) {
+                auto grown = std::make_unique<char[]>(capacity * 2);
+                std::copy_n(buffer_.get(), size_, grown.get());
+                buffer_ = std::move(grown);
+                capacity *= 2;
+            }
+            const std::size_t got = read(buffer_.get() + size_, capacity - size_);
+            if (got == 0) break;
+            size_ += got;
+        }
+        data_ = buffer_.get();
+    }
+
+    void release() noexcept {
+#if defined(ZUU_STREAM_HAS_MMAP)
+        if (mapped_) ::munmap(const_cast<char*>(data_), size_);
+#endif
+        buffer_.reset();
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+    }
+};
+
+/**
+ * @brief Lines of a mapped file as views into it (the file must outlive the stream)
+ *
+ * Lines end at "\n", "\r" or "\r\n"; empty lines are skipped.
+ */
+inline generator<std::string_view> mapped_lines(std::string_view text) {
+    const char* first = text.data();
+    const char* last = first + text.size();
+
+    while (first != last) {
+        const char* eol = detail::find_eol(first, last);
+        if (eol != first) co_yield std::string_view(first, static_cast<std::size_t>(eol - first));
+        if (eol == last) break;
+        first = eol + 1;
+    }
+}
+
+inline generator<std::string_view> mapped_lines(const mapped_file& file) {
+    return mapped_lines(file.view());
+}
+
+} // namespace zuu::stream
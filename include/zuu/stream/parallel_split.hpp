@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file zuu/stream/parallel_split.hpp
+ * @brief Parallel record splitting of large buffers with boundary fix-up
+ * @version 3.0.0
+ *
+ * The buffer is cut into one region per thread. A region owns the records
+ * that start inside it, so each nominal cut is moved forward to the next
+ * record start (the record crossing the cut stays with the region before).
+ * In quote-aware mode (CSV), a delimiter inside "..." does not end a record;
+ * whether a cut falls inside quotes is derived from the parity of quote
+ * characters before it, counted per region in parallel. Doubled quotes
+ * ("") toggle twice and need no special case.
+ *
+ * Records are views into the buffer, without the delimiter. Regions are
+ * scanned 64 bytes at a time into delimiter bitmaps (simd/scan.hpp).
+ *
+ * Usage:
+ *   // Unordered: fn runs concurrently on different regions
+ *   stream::for_each_record(text, [&](std::size_t region, std::string_view line) { ... });
+ *
+ *   // Ordered: one record list per region, regions in buffer order
+ *   auto regions = stream::split_records(csv, {.delimiter = '\n', .quote_aware = true});
+ */
+
+#include "../simd/scan.hpp"
+#include "../simd/search.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace zuu::stream {
+
+struct split_options {
+    char delimiter = '\n';
+    bool quote_aware = false;                      // CSV: delimiters inside quotes do not split
+    char quote = '"';
+    bool keep_empty = false;                       // empty records are skipped by default (like split_lines)
+    std::size_t threads = 0;                       // 0 = hardware_concurrency
+    std::size_t min_region = std::size_t{1} << 20; // bytes per thread at least
+};
+
+namespace detail {
+
+inline std::size_t split_thread_count(std::size_t size, const split_options& options) noexcept {
+    std::size_t threads = options.threads != 0 ? options.threads : std::thread::hardware_concurrency();
+    threads = std::max<std::size_t>(threads, 1);
+    const std::size_t by_size = size / std::max<std::size_t>(options.min_region, 1);
+    return std::clamp<std::size_t>(by_size, 1, threads);
+}
+
+// Run fn(k) for k in [0, count) on `count` threads (the caller runs k = 0)
+template <typename Fn>
+void run_on_threads(std::size_t count, Fn&& fn) {
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto guarded = [&](std::size_t k) {
+        try {
+            fn(k);
+        } catch (...) {
+            std::lock_guard lock(error_mutex);
+            if (!error) error = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(count > 0 ? count - 1 : 0);
+        for (std::size_t k = 1; k < count; ++k) workers.emplace_back(guarded, k);
+        guarded(0);
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+// First unquoted delimiter in [first, last), given the quote state at `first`
+inline const char* find_delimiter(const char* first, const char* last, bool& in_quotes,
+                                  const split_options& options) noexcept {
+    if (!options.quote_aware) return simd::find_char(first, last, options.delimiter);
+
+    const char stops[] = {options.delimiter, options.quote};
+    while (first != last) {
+        if (in_quotes) {
+            first = simd::find_char(first, last, options.quote);
+            if (first == last) break;
+            in_quotes = false;
+            ++first;
+            continue;
+        }
+
+        first = simd::find_first_of(first, last, stops, 2);
+        if (first == last || *first == options.delimiter) break;
+        in_quotes = true;
+        ++first;
+    }
+    return first;
+}
+
+// Call emit(record) for every record of a region starting at a record start
+template <typename Emit>
+void split_region(std::string_view region, const split_options& options, Emit&& emit) {
+    const char* start = region.data();
+    const char* last = start + region.size();
+
+    auto on_delimiter = [&](const char* end) {
+        if (end != start || options.keep_empty) emit(std::string_view(start, static_cast<std::size_t>(end - start)));
+        start = end + 1;
+    };
+
+    if (options.quote_aware) {
+        simd::for_each_delimiter(start, last, options.delimiter, options.quote, on_delimiter);
+    } else {
+        simd::for_each_delimiter(start, last, options.delimiter, on_delimiter);
+    }
+
+    if (start != last) emit(std::string_view(start, static_cast<std::size_t>(last - start)));
+}
+
+} // namespace detail
+
+/**
+ * @brief Cut `buffer` into per-thread regions that each start at a record start
+ *
+ * Regions are contiguous and cover the buffer in order; a region may be
+ * empty if one record spans several nominal cuts.
+ */
+inline std::vector<std::string_view> split_regions(std::string_view buffer, const split_options& options = {}) {
+    const std::size_t count = detail::split_thread_count(buffer.size(), options);
+    const char* data = buffer.data();
+    const char* last = data + buffer.size();
+
+    std::vector<std::size_t> cuts(count + 1);
+    for (std::size_t k = 0; k <= count; ++k) cuts[k] = buffer.size() / count * k;
+    cuts[count] = buffer.size();
+
+    // Quote state at each nominal cut: prefix parity of per-region quote counts
+    std::vector<unsigned char> quoted_at(count, 0);
+    if (options.quote_aware && count > 1) {
+        std::vector<std::size_t> quotes(count);
+        detail::run_on_threads(count, [&](std::size_t k) {
+            quotes[k] = simd::count_char(data + cuts[k], data + cuts[k + 1], options.quote);
+        });
+        for (std::size_t k = 1; k < count; ++k) {
+            quoted_at[k] = static_cast<unsigned char>(quoted_at[k - 1] ^ (quotes[k - 1] & 1));
+        }
+    }
+
+    // Move each cut to the first record start at or after it
+    std::vector<std::size_t> starts(count + 1);
+    starts[0] = 0;
+    starts[count] = buffer.size();
+    for (std::size_t k = 1; k < count; ++k) {
+        const std::size_t from = cuts[k] - 1;  // a record starts at cuts[k] if the byte before ends one
+        bool in_quotes = quoted_at[k] ^ (options.quote_aware && data[from] == options.quote);
+        const char* end = detail::find_delimiter(data + from, last, in_quotes, options);
+        const std::size_t start = end == last ? buffer.size() : static_cast<std::size_t>(end - data) + 1;
+        starts[k] = std::max(start, starts[k - 1]);
+    }
+
+    std::vector<std::string_view> regions(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        regions[k] = buffer.substr(starts[k], starts[k + 1] - starts[k]);
+    }
+    return regions;
+}
+
+/**
+ * @brief Call fn(region_index, record) for every record, regions in parallel
+ *
+ * Within a region, records arrive in buffer order; across regions, calls
+ * are concurrent. The first exception thrown by fn is rethrown after all
+ * regions finish.
+ */
+template <typename Fn>
+requires std::invocable<Fn&, std::size_t, std::string_view>
+void for_each_record(std::string_view buffer, Fn fn, const split_options& options = {}) {
+    const auto regions = split_regions(buffer, options);
+    detail::run_on_threads(regions.size(), [&](std::size_t k) {
+        detail::split_region(regions[k], options, [&](std::string_view record) { std::invoke(fn, k, record); });
+    });
+}
+
+/**
+ * @brief Records of each region, regions in buffer order
+ *
+ * Concatenating the lists gives the records of a sequential split.
+ */
+inline std::vector<std::vector<std::string_view>> split_records(std::string_view buffer,
+                                                                const split_options& options = {}) {
+    const auto regions = split_regions(buffer, options);
+    std::vector<std::vector<std::string_view>> records(regions.size());
+
+    detail::run_on_threads(regions.size(), [&](std::size_t k) {
+        detail::split_region(regions[k], options, [&](std::string_view record) { records[k].push_back(record); });
+    });
+    return records;
+}
+
+} // namespace zuu::stream
@@ -0,0 +1,452 @@
+#pragma once
+
+/**
+ * @file zuu/stream/pipeline.hpp
+ * @brief Multi-threaded staged pipeline executor (parallel_pipeline style)
+ * @version 3.0.0
+ *
+ * A pipeline is a chain of stages joined with `&`. The first stage produces
+ * records until it calls flow_control::stop(); the last one consumes them.
+ * Stages run in one of three modes:
+ *
+ *   serial_in_order      one batch at a time, in input order
+ *   serial_out_of_order  one batch at a time, any order
+ *   parallel             any number of batches at once
+ *
+ * Records travel in batches ("tokens") of up to `batch` records, so each
+ * hand-off between threads and each serial-stage lock is paid once per
+ * batch. At most `tokens` batches are in flight: when all are taken the
+ * input stage waits for one to leave the last stage (back-pressure). Token
+ * storage for every stage's output is allocated once, up front, and reused
+ * for the whole run.
+ *
+ * Usage:
+ *   auto chain =
+ *       stream::make_stage<void, fstring<256>>(stage_mode::serial_in_order,
+ *           [&](flow_control& fc) { ... if (eof) fc.stop(); return line; })
+ *     & stream::make_stage<fstring<256>, record>(stage_mode::parallel, parse)
+ *     & stream::make_stage<record, void>(stage_mode::serial_in_order, write);
+ *   std::size_t n = stream::run_pipeline(chain, {.threads = 8});
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace zuu::stream {
+
+// ==================== Stages ====================
+
+enum class stage_mode {
+    serial_in_order,
+    serial_out_of_order,
+    parallel
+};
+
+/**
+ * @brief Passed to the input stage; stop() ends the input
+ *
+ * The value returned by the call that stops is discarded.
+ */
+class flow_control {
+public:
+    void stop() noexcept { stopped_ = true; }
+    [[nodiscard]] bool stopped() const noexcept { return stopped_; }
+
+private:
+    bool stopped_ = false;
+};
+
+template <typename In, typename Out, typename Fn>
+struct stage {
+    using input_type = In;
+    using output_type = Out;
+
+    stage_mode mode;
+    Fn fn;
+};
+
+/**
+ * @brief Stage taking In and returning Out
+ *
+ * In = void: input stage, called as fn(flow_control&).
+ * Out = void: output stage, its result is ignored.
+ */
+template <typename In, typename Out, typename Fn>
+[[nodiscard]] constexpr auto make_stage(stage_mode mode, Fn fn) {
+    if constexpr (std::is_void_v<In>) {
+        static_assert(std::is_invocable_r_v<Out, Fn&, flow_control&>,
+                      "input stage must be callable as Out(flow_control&)");
+    } else if constexpr (!std::is_void_v<Out>) {
+        static_assert(std::is_invocable_r_v<Out, Fn&, In&&>, "stage must be callable as Out(In)");
+    } else {
+        static_assert(std::is_invocable_v<Fn&, In&&>, "output stage must be callable with In");
+    }
+    return stage<In, Out, Fn>{mode, std::move(fn)};
+}
+
+template <typename... Stages>
+struct stage_chain {
+    std::tuple<Stages...> stages;
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_stage = false;
+
+template <typename In, typename Out, typename Fn>
+inline constexpr bool is_stage<stage<In, Out, Fn>> = true;
+
+template <typename Last, typename Next>
+inline constexpr bool links_to = std::is_same_v<typename Last::output_type, typename Next::input_type>;
+
+} // namespace detail
+
+template <typename In1, typename Out1, typename Fn1, typename In2, typename Out2, typename Fn2>
+requires std::is_same_v<Out1, In2>
+[[nodiscard]] constexpr auto operator&(stage<In1, Out1, Fn1> lhs, stage<In2, Out2, Fn2> rhs) {
+    return stage_chain<stage<In1, Out1, Fn1>, stage<In2, Out2, Fn2>>{{std::move(lhs), std::move(rhs)}};
+}
+
+template <typename... Stages, typename In, typename Out, typename Fn>
+requires detail::links_to<std::tuple_element_t<sizeof...(Stages) - 1, std::tuple<Stages...>>, stage<In, Out, Fn>>
+[[nodiscard]] constexpr auto operator&(stage_chain<Stages...> lhs, stage<In, Out, Fn> rhs) {
+    return stage_chain<Stages..., stage<In, Out, Fn>>{
+        std::tuple_cat(std::move(lhs.stages), std::tuple<stage<In, Out, Fn>>{std::move(rhs)})};
+}
+
+// ==================== Options ====================
+
+struct pipeline_options {
+    std::size_t threads = 0;  // including the calling thread; 0 = hardware_concurrency
+    std::size_t tokens = 0;   // batches in flight; 0 = 4 per thread
+    std::size_t batch = 64;   // records per batch (>= 1)
+};
+
+namespace detail {
+
+template <typename T>
+using slot_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+template <typename... Stages>
+class pipeline_executor {
+    static constexpr std::size_t stage_count = sizeof...(Stages);
+    static_assert(stage_count >= 2, "a pipeline needs an input and an output stage");
+
+    using chain_type = std::tuple<Stages...>;
+
+    template <std::size_t K>
+    using stage_at = std::tuple_element_t<K, chain_type>;
+
+    static_assert(std::is_void_v<typename stage_at<0>::input_type>, "first stage must be an input stage");
+    static_assert(std::is_void_v<typename stage_at<stage_count - 1>::output_type>,
+                  "last stage must be an output stage");
+
+    // Outputs of every stage but the last, one batch each
+    using slots_type = std::tuple<std::vector<slot_t<typename Stages::output_type>>...>;
+
+    struct token {
+        std::size_t seq = 0;
+        std::size_t count = 0;
+        slots_type slots;
+    };
+
+    struct serial_state {
+        std::mutex mutex;
+        bool busy = false;
+        std::size_t next_seq = 0;               // serial_in_order
+        std::vector<token*> waiting;            // serial_in_order: indexed by seq % tokens
+        std::deque<token*> queue;               // serial_out_of_order
+    };
+
+    struct task {
+        token* tok;          // nullptr: run the input stage
+        std::size_t stage;
+    };
+
+public:
+    pipeline_executor(chain_type& chain, const pipeline_options& options)
+        : chain_{chain},
+          threads_{options.threads != 0 ? options.threads
+                                         : std::max<std::size_t>(1, std::thread::hardware_concurrency())},
+          batch_{std::max<std::size_t>(1, options.batch)},
+          tokens_(options.tokens != 0 ? options.tokens : 4 * threads_),
+          serial_(stage_count) {
+        for (auto& tok : tokens_) {
+            std::apply([&](auto&... slot) { (slot.resize(batch_), ...); }, tok.slots);
+            free_.push_back(&tok);
+        }
+        for (auto& state : serial_) state.waiting.assign(tokens_.size(), nullptr);
+    }
+
+    std::size_t run() {
+        push_task({nullptr, 0});
+
+        std::vector<std::jthread> workers;
+        workers.reserve(threads_ - 1);
+        for (std::size_t i = 1; i < threads_; ++i) workers.emplace_back([this] { work(); });
+        work();
+        for (auto& worker : workers) worker.join();
+
+        if (error_) std::rethrow_exception(error_);
+        return records_;
+    }
+
+private:
+    // ---------- Task queue ----------
+
+    void push_task(task t) {
+        {
+            std::lock_guard lock(queue_mutex_);
+            ready_.push_back(t);
+        }
+        queue_cv_.notify_one();
+    }
+
+    void work() {
+        for (;;) {
+            task t;
+            {
+                std::unique_lock lock(queue_mutex_);
+                queue_cv_.wait(lock, [this] { return !ready_.empty() || finished_; });
+                if (ready_.empty()) return;
+                t = ready_.front();
+                ready_.pop_front();
+            }
+
+            if (t.tok == nullptr) {
+                produce();
+            } else {
+                advance(t.tok, t.stage);
+            }
+        }
+    }
+
+    // ---------- Input stage ----------
+
+    // Fill free tokens until none is left or the input stops. Each filled
+    // token is carried on by this thread; further input runs as a new task.
+    void produce() {
+        auto& input = serial_[0];
+        token* tok;
+        {
+            std::lock_guard lock(input.mutex);
+            if (input.busy || input_done_ || free_.empty()) return;
+            input.busy = true;
+            tok = free_.back();
+            free_.pop_back();
+        }
+
+        tok->seq = next_seq_++;
+        tok->count = 0;
+        bool stopped = cancelled_.load(std::memory_order_relaxed);
+
+        if (!stopped) {
+            try {
+                auto& out = std::get<0>(tok->slots);
+                auto& fn = std::get<0>(chain_).fn;
+                flow_control control;
+                while (tok->count < batch_) {
+                    auto value = std::invoke(fn, control);
+                    if (control.stopped()) break;
+                    out[tok->count++] = std::move(value);
+                }
+                stopped = control.stopped();
+            } catch (...) {
+                fail(std::current_exception());
+                stopped = true;
+            }
+        }
+
+        bool more;
+        {
+            std::lock_guard lock(input.mutex);
+            input.busy = false;
+            records_ += tok->count;
+            ++in_flight_;
+            if (stopped) input_done_ = true;
+            more = !input_done_ && !free_.empty();
+        }
+        if (more) push_task({nullptr, 0});
+
+        // Empty batches still pass every stage so serial_in_order sequence
+        // numbers stay contiguous
+        advance(tok, 1);
+    }
+
+    // ---------- Stage execution ----------
+
+    template <std::size_t K>
+    void run_stage_at(token& tok) {
+        if (cancelled_.load(std::memory_order_relaxed)) {
+            tok.count = 0;
+            return;
+        }
+
+        auto& fn = std::get<K>(chain_).fn;
+        auto& in = std::get<K - 1>(tok.slots);
+
+        try {
+            if constexpr (std::is_void_v<typename stage_at<K>::output_type>) {
+                for (std::size_t i = 0; i < tok.count; ++i) std::invoke(fn, std::move(in[i]));
+            } else {
+                auto& out = std::get<K>(tok.slots);
+                for (std::size_t i = 0; i < tok.count; ++i) out[i] = std::invoke(fn, std::move(in[i]));
+            }
+        } catch (...) {
+            fail(std::current_exception());
+            tok.count = 0;
+        }
+    }
+
+    void run_stage(std::size_t k, token& tok) {
+        [&]<std::size_t... K>(std::index_sequence<K...>) {
+            ((k == K + 1 ? run_stage_at<K + 1>(tok) : void()), ...);
+        }(std::make_index_sequence<stage_count - 1>{});
+    }
+
+    stage_mode mode_of(std::size_t k) const noexcept {
+        return [&]<std::size_t... K>(std::index_sequence<K...>) {
+            stage_mode mode = stage_mode::parallel;
+            ((k == K ? (mode = std::get<K>(chain_).mode, void()) : void()), ...);
+            return mode;
+        }(std::make_index_sequence<stage_count>{});
+    }
+
+    // Carry `tok` from stage k to the end, parking it at a busy serial stage
+    void advance(token* tok, std::size_t k) {
+        for (; k < stage_count; ++k) {
+            const stage_mode mode = mode_of(k);
+            if (mode == stage_mode::parallel) {
+                run_stage(k, *tok);
+                continue;
+            }
+
+            const bool in_order = mode == stage_mode::serial_in_order;
+            auto& state = serial_[k];
+            {
+                std::lock_guard lock(state.mutex);
+                if (state.busy || (in_order && tok->seq != state.next_seq)) {
+                    if (in_order) state.waiting[tok->seq % tokens_.size()] = tok;
+                    else state.queue.push_back(tok);
+                    return;
+                }
+                state.busy = true;
+            }
+
+            // Drain the batches that became runnable while this one ran;
+            // the finished ones move on as new tasks
+            for (;;) {
+                run_stage(k, *tok);
+
+                token* next = nullptr;
+                {
+                    std::lock_guard lock(state.mutex);
+                    if (in_order) {
+                        ++state.next_seq;
+                        auto& slot = state.waiting[state.next_seq % tokens_.size()];
+                        if (slot && slot->seq == state.next_seq) next = std::exchange(slot, nullptr);
+                    } else if (!state.queue.empty()) {
+                        next = state.queue.front();
+                        state.queue.pop_front();
+                    }
+                    if (!next) state.busy = false;
+                }
+
+                if (!next) break;
+                push_task({tok, k + 1});
+                tok = next;
+            }
+        }
+
+        finish(tok);
+    }
+
+    void finish(token* tok) {
+        auto& input = serial_[0];
+        bool produce_more = false;
+        bool done = false;
+        {
+            std::lock_guard lock(input.mutex);
+            free_.push_back(tok);
+            --in_flight_;
+            produce_more = !input_done_ && !input.busy;
+            done = input_done_ && in_flight_ == 0;
+        }
+
+        if (produce_more) push_task({nullptr, 0});
+        if (done) {
+            {
+                std::lock_guard lock(queue_mutex_);
+                finished_ = true;
+            }
+            queue_cv_.notify_all();
+        }
+    }
+
+    // First exception wins; the input stops and later stages skip their work
+    void fail(std::exception_ptr error) noexcept {
+        std::lock_guard lock(error_mutex_);
+        if (!error_) error_ = std::move(error);
+        cancelled_.store(true, std::memory_order_relaxed);
+    }
+
+    chain_type& chain_;
+    const std::size_t threads_;
+    const std::size_t batch_;
+
+    std::vector<token> tokens_;
+    std::vector<serial_state> serial_;
+
+    // Guarded by serial_[0].mutex
+    std::vector<token*> free_;
+    std::size_t next_seq_ = 0;
+    std::size_t in_flight_ = 0;
+    std::size_t records_ = 0;
+    bool input_done_ = false;
+
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::deque<task> ready_;
+    bool finished_ = false;
+
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+    std::atomic<bool> cancelled_{false};
+};
+
+} // namespace detail
+
+// ==================== Run ====================
+
+/**
+ * @brief Run a pipeline to completion on `options.threads` threads
+ *
+ * The calling thread takes part. The first exception thrown by a stage is
+ * rethrown here after the batches in flight have drained.
+ * @return Records produced by the input stage
+ */
+template <typename... Stages>
+std::size_t run_pipeline(stage_chain<Stages...>& chain, const pipeline_options& options = {}) {
+    detail::pipeline_executor<Stages...> executor(chain.stages, options);
+    return executor.run();
+}
+
+template <typename... Stages>
+std::size_t run_pipeline(stage_chain<Stages...>&& chain, const pipeline_options& options = {}) {
+    return run_pipeline(chain, options);
+}
+
+} // namespace zuu::stream
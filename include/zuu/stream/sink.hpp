@@ -0,0 +1,206 @@
+#pragma once
+
+/**
+ * @file zuu/stream/sink.hpp
+ * @brief Stream sinks: buffered line writers, counting and collecting
+ * @version 3.0.0
+ *
+ * A sink drains a generator when applied with `|` and returns a summary
+ * (records written or counted) or the collected records.
+ *
+ * Usage:
+ *   std::size_t n = stream::file_lines<256>("in.log")
+ *                 | stream::filter(is_error)
+ *                 | stream::write_to(stdout);
+ *   auto records = lines | stream::collect;
+ */
+
+#include "../meta/concepts.hpp"
+#include "../str/policy.hpp"
+#include "generator.hpp"
+#include "source.hpp"
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace zuu::stream {
+
+// ==================== Line Writer ====================
+
+/**
+ * @brief Buffered writer appending one line per record
+ *
+ * Output goes to a FILE* or (on POSIX) a file descriptor in chunk-sized
+ * writes. Records longer than the buffer are written directly. Flushes on
+ * destruction; after a failed write further output is dropped.
+ */
+class line_writer {
+public:
+    explicit line_writer(std::FILE* file, std::size_t chunk_size = default_chunk_size)
+        : buffer_(chunk_size), write_{&write_file}, target_{file}, fd_{-1} {}
+
+#if defined(ZUU_STREAM_HAS_FD)
+    explicit line_writer(int fd, std::size_t chunk_size = default_chunk_size)
+        : buffer_(chunk_size), write_{&write_fd}, target_{nullptr}, fd_{fd} {}
+#endif
+
+    line_writer(const line_writer&) = delete;
+    line_writer& operator=(const line_writer&) = delete;
+
+    ~line_writer() { flush(); }
+
+    void write(std::string_view text) noexcept {
+        if (used_ + text.size() > buffer_.size()) {
+            flush();
+            if (text.size() > buffer_.size()) {
+                emit(text.data(), text.size());
+                return;
+            }
+        }
+        std::memcpy(buffer_.data() + used_, text.data(), text.size());
+        used_ += text.size();
+    }
+
+    void write_line(std::string_view line) noexcept {
+        write(line);
+        write("\n");
+    }
+
+    void flush() noexcept {
+        if (used_ != 0) emit(buffer_.data(), used_);
+        used_ = 0;
+    }
+
+    [[nodiscard]] bool ok() const noexcept { return ok_; }
+
+private:
+    using write_fn = bool (*)(const line_writer&, const char*, std::size_t) noexcept;
+
+    static bool write_file(const line_writer& w, const char* data, std::size_t n) noexcept {
+        return w.target_ && std::fwrite(data, 1, n, w.target_) == n;
+    }
+
+#if defined(ZUU_STREAM_HAS_FD)
+    static bool write_fd(const line_writer& w, const char* data, std::size_t n) noexcept {
+        while (n != 0) {
+            const auto put = ::write(w.fd_, data, n);
+            if (put < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += put;
+            n -= static_cast<std::size_t>(put);
+        }
+        return true;
+    }
+#endif
+
+    void emit(const char* data, std::size_t n) noexcept {
+        if (ok_) ok_ = write_(*this, data, n);
+    }
+
+    pooled_buffer<char> buffer_;
+    std::size_t used_ = 0;
+    write_fn write_;
+    std::FILE* target_;
+    int fd_;
+    bool ok_ = true;
+};
+
+// ==================== Write ====================
+
+template <typename Target>
+struct write_sink {
+    Target target;
+    std::size_t chunk_size;
+
+    template <typename T>
+    requires meta::string_like<T> && std::same_as<meta::char_type_of_t<T>, char>
+    friend std::size_t operator|(generator<T> in, write_sink sink) {
+        line_writer out(sink.target, sink.chunk_size);
+        std::size_t written = 0;
+        for (const auto& record : in) {
+            out.write_line(str::as_view(record));
+            ++written;
+        }
+        return written;
+    }
+};
+
+/**
+ * @brief Write each record as a line to a FILE*; returns records written
+ */
+[[nodiscard]] inline write_sink<std::FILE*> write_to(std::FILE* file, std::size_t chunk_size = default_chunk_size) {
+    return {file, chunk_size};
+}
+
+#if defined(ZUU_STREAM_HAS_FD)
+/**
+ * @brief Write each record as a line to a file descriptor; returns records written
+ */
+[[nodiscard]] inline write_sink<int> write_to_fd(int fd, std::size_t chunk_size = default_chunk_size) {
+    return {fd, chunk_size};
+}
+#endif
+
+// ==================== Count ====================
+
+struct count_sink {
+    template <typename T>
+    friend std::size_t operator|(generator<T> in, count_sink) {
+        std::size_t n = 0;
+        for (const auto& record : in) {
+            (void)record;
+            ++n;
+        }
+        return n;
+    }
+};
+
+inline constexpr count_sink count;
+
+// ==================== For Each ====================
+
+template <typename Fn>
+struct for_each_sink {
+    Fn fn;
+
+    template <typename T>
+    requires std::invocable<Fn&, const std::remove_cvref_t<T>&>
+    friend std::size_t operator|(generator<T> in, for_each_sink sink) {
+        std::size_t n = 0;
+        for (const auto& record : in) {
+            std::invoke(sink.fn, record);
+            ++n;
+        }
+        return n;
+    }
+};
+
+/**
+ * @brief Call fn(record) for each record; returns the number of records
+ */
+template <typename Fn>
+[[nodiscard]] constexpr auto for_each(Fn fn) {
+    return for_each_sink<Fn>{std::move(fn)};
+}
+
+// ==================== Collect ====================
+
+struct collect_sink {
+    template <typename T>
+    friend auto operator|(generator<T> in, collect_sink) {
+        std::vector<typename generator<T>::value_type> out;
+        for (const auto& record : in) out.push_back(record);
+        return out;
+    }
+};
+
+/**
+ * @brief Copy all records into a std::vector (allocates; for tests and small streams)
+ */
+inline constexpr collect_sink collect;
+
+} // namespace zuu::stream
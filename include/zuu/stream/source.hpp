@@ -0,0 +1,169 @@
+#pragma once
+
+/**
+ * @file zuu/stream/source.hpp
+ * @brief Line sources: memory, FILE* and file descriptors
+ * @version 3.0.0
+ *
+ * Each source yields one basic_fstring<CharT, Cap> record per line. The
+ * record is a single object in the coroutine frame, overwritten for every
+ * line, and input is read through one pooled chunk buffer per stream, so
+ * the steady state performs no allocation. Lines follow split_lines:
+ * "\n", "\r" and "\r\n" end a line, empty lines are skipped and lines
+ * longer than Cap are truncated.
+ *
+ * Usage:
+ *   for (const auto& line : stream::memory_lines<128>(text)) { ... }
+ *   auto lines = stream::file_lines<256>("access.log");
+ *   auto lines = stream::fd_lines<256>(STDIN_FILENO);
+ */
+
+#include "../core/core.hpp"
+#include "../simd/search.hpp"
+#include "../str/policy.hpp"
+#include "generator.hpp"
+#include <cstdio>
+#include <memory>
+#include <string_view>
+
+#if __has_include(<unistd.h>)
+    #include <cerrno>
+    #include <unistd.h>
+    #define ZUU_STREAM_HAS_FD 1
+#endif
+
+namespace zuu::stream {
+
+inline constexpr std::size_t default_chunk_size = 64 * 1024;
+
+namespace detail {
+
+template <meta::character CharT>
+constexpr const CharT* find_eol(const CharT* first, const CharT* last) noexcept {
+    constexpr CharT eol[] = {CharT('\n'), CharT('\r')};
+    return simd::find_first_of(first, last, eol, 2);
+}
+
+template <std::size_t Cap, meta::character CharT>
+generator<basic_fstring<CharT, Cap>> memory_lines(std::basic_string_view<CharT> text) {
+    basic_fstring<CharT, Cap> record;
+    const CharT* first = text.data();
+    const CharT* last = first + text.size();
+
+    while (first != last) {
+        const CharT* eol = find_eol(first, last);
+        if (eol != first) {
+            record.clear();
+            record.append(first, static_cast<std::size_t>(eol - first));
+            co_yield record;
+        }
+        if (eol == last) break;
+        first = eol + 1;
+    }
+}
+
+// Lines of a chunked reader: read(buffer, n) returns bytes read, 0 at the end
+template <std::size_t Cap, typename Read>
+generator<basic_fstring<char, Cap>> chunk_lines(Read read, std::size_t chunk_size) {
+    pooled_buffer<char> chunk(chunk_size);
+    basic_fstring<char, Cap> record;
+    bool partial = false;  // record holds the start of a line continued in the next chunk
+
+    while (const std::size_t got = read(chunk.data(), chunk.size())) {
+        const char* first = chunk.data();
+        const char* last = first + got;
+
+        while (first != last) {
+            const char* eol = find_eol(first, last);
+            if (!partial) record.clear();
+            record.append(first, static_cast<std::size_t>(eol - first));
+
+            if (eol == last) {
+                partial = true;
+                break;
+            }
+
+            partial = false;
+            if (!record.empty()) co_yield record;
+            first = eol + 1;
+        }
+    }
+
+    if (partial && !record.empty()) co_yield record;
+}
+
+struct file_closer {
+    void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+};
+
+using file_handle = std::unique_ptr<std::FILE, file_closer>;
+
+template <std::size_t Cap>
+generator<basic_fstring<char, Cap>> owned_file_lines(file_handle file, std::size_t chunk_size) {
+    if (!file) co_return;
+
+    auto read = [f = file.get()](char* buffer, std::size_t n) {
+        return std::fread(buffer, 1, n, f);
+    };
+    for (const auto& line : chunk_lines<Cap>(read, chunk_size)) co_yield line;
+}
+
+} // namespace detail
+
+// ==================== Memory ====================
+
+/**
+ * @brief Lines of an in-memory string (which must outlive the stream)
+ */
+template <std::size_t Cap = 256, meta::string_like Str>
+auto memory_lines(const Str& text) {
+    return detail::memory_lines<Cap>(str::as_view(text));
+}
+
+// ==================== FILE* ====================
+
+/**
+ * @brief Lines read from an open FILE* (not closed by the stream)
+ */
+template <std::size_t Cap = 256>
+generator<basic_fstring<char, Cap>> file_lines(std::FILE* file, std::size_t chunk_size = default_chunk_size) {
+    auto read = [file](char* buffer, std::size_t n) -> std::size_t {
+        return file ? std::fread(buffer, 1, n, file) : 0;
+    };
+    return detail::chunk_lines<Cap>(read, chunk_size);
+}
+
+/**
+ * @brief Lines of the file at `path`; an unreadable file gives an empty stream
+ *
+ * The file is opened immediately and closed with the stream.
+ */
+template <std::size_t Cap = 256>
+generator<basic_fstring<char, Cap>> file_lines(const char* path, std::size_t chunk_size = default_chunk_size) {
+    return detail::owned_file_lines<Cap>(detail::file_handle{path ? std::fopen(path, "rb") : nullptr}, chunk_size);
+}
+
+// ==================== File Descriptor ====================
+
+#if defined(ZUU_STREAM_HAS_FD)
+
+/**
+ * @brief Lines read from a POSIX file descriptor (not closed by the stream)
+ *
+ * Interrupted reads are retried; any other read error ends the stream.
+ */
+template <std::size_t Cap = 256>
+generator<basic_fstring<char, Cap>> fd_lines(int fd, std::size_t chunk_size = default_chunk_size) {
+    auto read = [fd](char* buffer, std::size_t n) -> std::size_t {
+        for (;;) {
+            const auto got = ::read(fd, buffer, n);
+            if (got >= 0) return static_cast<std::size_t>(got);
+            if (errno != EINTR) return 0;
+        }
+    };
+    return detail::chunk_lines<Cap>(read, chunk_size);
+}
+
+#endif // ZUU_STREAM_HAS_FD
+
+} // namespace zuu::stream
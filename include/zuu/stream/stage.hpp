@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+ * @file zuu/stream/stage.hpp
+ * @brief Stream stages that lift str:: pipes and predicates to generators
+ * @version 3.0.0
+ *
+ * A stage wraps a callable and is applied with `|`. Any callable works, in
+ * particular the pipe objects of zuu::str (and compositions of them), so a
+ * per-record pipeline reads the same as a one-shot one:
+ *
+ *   auto out = stream::memory_lines<128>(text)
+ *            | stream::transform(str::trim | str::to_upper)
+ *            | stream::filter([](const auto& s) { return !s.empty(); })
+ *            | stream::flat_map(str::split(','))
+ *            | stream::take(100);
+ *
+ * Each stage is one coroutine that reads its input by reference; results
+ * of transform are yielded from a temporary in the stage's frame.
+ */
+
+#include "generator.hpp"
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace zuu::stream {
+
+namespace detail {
+
+template <typename T, typename Fn>
+using transform_result_t = std::remove_cvref_t<std::invoke_result_t<const Fn&, const T&>>;
+
+template <typename T, typename Fn>
+generator<transform_result_t<T, Fn>> transform_stream(generator<T> in, Fn fn) {
+    for (const auto& item : in) co_yield std::invoke(fn, item);
+}
+
+template <typename T, typename Pred>
+generator<T> filter_stream(generator<T> in, Pred pred) {
+    for (const auto& item : in) {
+        if (std::invoke(pred, item)) co_yield item;
+    }
+}
+
+template <typename T, typename Fn>
+using flat_map_element_t = std::ranges::range_value_t<transform_result_t<T, Fn>>;
+
+template <typename T, typename Fn>
+generator<flat_map_element_t<T, Fn>> flat_map_stream(generator<T> in, Fn fn) {
+    for (const auto& item : in) {
+        const auto parts = std::invoke(fn, item);
+        for (const auto& part : parts) co_yield part;
+    }
+}
+
+template <typename T>
+generator<T> take_stream(generator<T> in, std::size_t count) {
+    if (count == 0) co_return;
+    for (const auto& item : in) {
+        co_yield item;
+        if (--count == 0) break;
+    }
+}
+
+} // namespace detail
+
+// ==================== Transform ====================
+
+template <typename Fn>
+struct transform_stage {
+    Fn fn;
+
+    template <typename T>
+    requires std::invocable<const Fn&, const std::remove_cvref_t<T>&>
+    friend auto operator|(generator<T> in, transform_stage stage) {
+        return detail::transform_stream(std::move(in), std::move(stage.fn));
+    }
+};
+
+/**
+ * @brief Replace every record by fn(record)
+ */
+template <typename Fn>
+[[nodiscard]] constexpr auto transform(Fn fn) {
+    return transform_stage<Fn>{std::move(fn)};
+}
+
+// ==================== Filter ====================
+
+template <typename Pred>
+struct filter_stage {
+    Pred pred;
+
+    template <typename T>
+    requires std::predicate<const Pred&, const std::remove_cvref_t<T>&>
+    friend auto operator|(generator<T> in, filter_stage stage) {
+        return detail::filter_stream(std::move(in), std::move(stage.pred));
+    }
+};
+
+/**
+ * @brief Keep the records for which pred(record) is true
+ */
+template <typename Pred>
+[[nodiscard]] constexpr auto filter(Pred pred) {
+    return filter_stage<Pred>{std::move(pred)};
+}
+
+// ==================== Flat Map ====================
+
+template <typename Fn>
+struct flat_map_stage {
+    Fn fn;
+
+    template <typename T>
+    requires std::ranges::input_range<detail::transform_result_t<T, Fn>>
+    friend auto operator|(generator<T> in, flat_map_stage stage) {
+        return detail::flat_map_stream(std::move(in), std::move(stage.fn));
+    }
+};
+
+/**
+ * @brief Replace every record by the elements of fn(record), e.g. str::split(',')
+ */
+template <typename Fn>
+[[nodiscard]] constexpr auto flat_map(Fn fn) {
+    return flat_map_stage<Fn>{std::move(fn)};
+}
+
+// ==================== Take ====================
+
+struct take_stage {
+    std::size_t count;
+
+    template <typename T>
+    friend auto operator|(generator<T> in, take_stage stage) {
+        return detail::take_stream(std::move(in), stage.count);
+    }
+};
+
+/**
+ * @brief Stop after `count` records (the input is not read further)
+ */
+[[nodiscard]] constexpr take_stage take(std::size_t count) noexcept {
+    return take_stage{count};
+}
+
+} // namespace zuu::stream
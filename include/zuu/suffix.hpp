@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file zuu/suffix.hpp
+ * @brief Suffix-array substring index over fstring corpora
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: SA-IS suffix arrays and Kasai LCP
+ * arrays, and a sharded index that answers substring queries over many
+ * records in O(m log n), reports hits as (record id, offset) and saves to
+ * a file that loads by mapping it, with no rebuild.
+ *
+ * @code
+ * #include <zuu/suffix.hpp>
+ * using namespace zuu;
+ *
+ * suffix::suffix_index index;
+ * for (std::string_view line : stream::mapped_lines(file)) index.add(line);
+ * index.build({.shards = 4});
+ * index.save("lines.sa");
+ *
+ * suffix::suffix_index mapped;
+ * mapped.load("lines.sa");
+ * for (const auto& [record, offset] : mapped.find_all("error 503")) { ... }
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "suffix/sais.hpp"
+#include "suffix/index.hpp"
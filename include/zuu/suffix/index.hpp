@@ -0,0 +1,435 @@
+#pragma once
+
+/**
+ * @file zuu/suffix/index.hpp
+ * @brief Substring index over a corpus of records: sharded suffix arrays,
+ *        record-mapped hits and a mmap-able file format
+ * @version 3.0.0
+ *
+ * Records are stored back to back, each followed by a '\0' separator, and
+ * the corpus is cut into shards of whole records whose suffix arrays (SA-IS)
+ * and LCP arrays (Kasai) are built in parallel. A pattern is found in each
+ * shard by two binary searches over the suffix array, O(m log n) character
+ * comparisons, skipping the prefix already matched against both bounds.
+ * Every suffix in the resulting range is one occurrence; its position maps
+ * back to (record id, offset in record) through the record start table.
+ *
+ * Patterns never match across records, since they cannot contain the
+ * separator (a pattern containing '\0' has no hits). LCP values count
+ * common bytes as stored, separators included.
+ *
+ * save() writes the corpus, record table and arrays in native byte order,
+ * each section 8-byte aligned; load() maps the file and searches it in
+ * place, without copying or rebuilding. The header, section bounds and
+ * record table are validated, and every SA and LCP entry is range-checked;
+ * the suffix array is not checked to be a permutation, so a corrupted file
+ * can give wrong hits but never out-of-bounds reads.
+ *
+ * Usage:
+ *   suffix::suffix_index index;
+ *   for (const auto& line : lines) index.add(line);    // record ids count from 0
+ *   index.build({.shards = 8});
+ *   for (auto [record, offset] : index.find_all("timeout")) { ... }
+ *   index.save("corpus.sa");
+ *
+ *   suffix::suffix_index mapped;
+ *   if (mapped.load("corpus.sa")) std::size_t n = mapped.count("timeout");
+ */
+
+#include "../meta/concepts.hpp"
+#include "../meta/traits.hpp"
+#include "../str/policy.hpp"
+#include "../stream/mapped_file.hpp"
+#include "../stream/parallel_split.hpp"
+#include "sais.hpp"
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace zuu::suffix {
+
+struct build_options {
+    std::size_t shards = 1;   // at least this many (more if a shard would reach 2^31 bytes)
+    std::size_t threads = 0;  // 0 = hardware_concurrency
+};
+
+// One occurrence: the record it lies in and its offset there
+struct hit {
+    std::uint32_t record = 0;
+    std::uint32_t offset = 0;
+
+    friend constexpr bool operator==(const hit&, const hit&) noexcept = default;
+    friend constexpr auto operator<=>(const hit&, const hit&) noexcept = default;
+};
+
+// A shard's part of the corpus and its arrays; sa and lcp index into text
+struct shard_view {
+    std::string_view text;
+    std::span<const std::int32_t> sa;
+    std::span<const std::int32_t> lcp;
+    std::size_t first_record = 0;
+    std::size_t records = 0;
+};
+
+namespace detail {
+
+inline constexpr char index_magic[8] = {'Z', 'U', 'U', 'S', 'A', 'I', 'X', '1'};
+inline constexpr std::uint32_t index_byte_order = 0x01020304;
+inline constexpr std::size_t max_shard_bytes = std::size_t{1} << 31;
+
+struct file_header {
+    char magic[8];
+    std::uint32_t byte_order;
+    std::uint32_t shards;
+    std::uint64_t records;
+    std::uint64_t corpus_size;
+    std::uint64_t starts_at;  // records + 1 uint64 record starts
+    std::uint64_t corpus_at;
+};
+
+struct file_shard {
+    std::uint64_t first_record;
+    std::uint64_t records;
+    std::uint64_t sa_at;   // int32 per byte of the shard's text
+    std::uint64_t lcp_at;
+};
+
+constexpr std::uint64_t align8(std::uint64_t n) noexcept { return (n + 7) & ~std::uint64_t{7}; }
+
+/**
+ * @brief First rank whose suffix, cut to pattern length, is >= pattern
+ *        (or > pattern for the upper bound)
+ *
+ * Suffixes between two bounds share at least min(lcp with each bound) bytes
+ * with the pattern, so those bytes are not compared again.
+ */
+inline std::size_t suffix_bound(std::string_view text, std::span<const std::int32_t> sa,
+                                std::string_view pattern, bool upper) noexcept {
+    std::size_t lo = 0;
+    std::size_t hi = sa.size();
+    std::size_t lo_lcp = 0;
+    std::size_t hi_lcp = 0;
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        const std::size_t start = static_cast<std::size_t>(sa[mid]);
+        const std::size_t available = text.size() - start;
+        std::size_t k = std::min(lo_lcp, hi_lcp);
+        while (k < pattern.size() && k < available && text[start + k] == pattern[k]) ++k;
+
+        bool before;
+        if (k == pattern.size()) before = upper;
+        else if (k == available) before = true;
+        else before = static_cast<unsigned char>(text[start + k]) < static_cast<unsigned char>(pattern[k]);
+
+        if (before) {
+            lo = mid + 1;
+            lo_lcp = k;
+        } else {
+            hi = mid;
+            hi_lcp = k;
+        }
+    }
+    return lo;
+}
+
+} // namespace detail
+
+class suffix_index {
+public:
+    suffix_index() = default;
+
+    /**
+     * @brief Append a record; returns its id. The index must be built again
+     *        before the record is searchable.
+     */
+    template <meta::string_like Str>
+        requires(sizeof(meta::char_type_of_t<Str>) == 1)
+    std::size_t add(const Str& record) {
+        const auto view = str::as_view(record);
+        own();
+        shards_.clear();
+        corpus_buffer_.insert(corpus_buffer_.end(), reinterpret_cast<const char*>(view.data()),
+                              reinterpret_cast<const char*>(view.data()) + view.size());
+        corpus_buffer_.push_back('\0');
+        starts_buffer_.push_back(corpus_buffer_.size());
+        point_at_buffers();
+        return size() - 1;
+    }
+
+    /**
+     * @brief Build the suffix and LCP arrays of every shard, in parallel
+     */
+    void build(build_options options = {}) {
+        own();
+        shards_.clear();
+        const std::size_t total = corpus_.size();
+        if (total == 0) return;
+
+        // Byte-balanced shards of whole records, each under 2^31 bytes
+        std::size_t count = std::max<std::size_t>(options.shards, 1);
+        count = std::max(count, (total + detail::max_shard_bytes / 2 - 1) / (detail::max_shard_bytes / 2));
+        count = std::min(count, size());
+        shards_.resize(count);
+        for (std::size_t k = 1, first = 0; k <= count; ++k) {
+            const std::uint64_t target = total * k / count;
+            const auto at = std::lower_bound(starts_.begin(), starts_.end(), target) - starts_.begin();
+            const std::size_t last = std::clamp(static_cast<std::size_t>(at), first + 1, size() - (count - k));
+            shards_[k - 1].first_record = first;
+            shards_[k - 1].records = last - first;
+            first = last;
+        }
+
+        std::size_t threads = options.threads != 0 ? options.threads : std::thread::hardware_concurrency();
+        threads = std::clamp<std::size_t>(threads, 1, shards_.size());
+        stream::detail::run_on_threads(threads, [&](std::size_t k) {
+            for (std::size_t s = k; s < shards_.size(); s += threads) {
+                shard_data& shard = shards_[s];
+                const std::string_view text = shard_text(shard);
+                shard.sa_buffer = suffix_array(text);
+                shard.lcp_buffer = lcp_array(text, shard.sa_buffer);
+                shard.sa = shard.sa_buffer;
+                shard.lcp = shard.lcp_buffer;
+            }
+        });
+    }
+
+    // ==================== Search ====================
+
+    // Number of occurrences of `pattern` in all records
+    [[nodiscard]] std::size_t count(std::string_view pattern) const noexcept {
+        if (pattern.empty() || pattern.find('\0') != std::string_view::npos) return 0;
+        std::size_t n = 0;
+        for (const shard_data& shard : shards_) {
+            const auto [lo, hi] = rank_range(shard, pattern);
+            n += hi - lo;
+        }
+        return n;
+    }
+
+    /**
+     * @brief Call fn(hit) for every occurrence of `pattern`, shard by
+     *        shard, in suffix order within a shard
+     */
+    template <typename Fn>
+    void for_each_occurrence(std::string_view pattern, Fn&& fn) const {
+        if (pattern.empty() || pattern.find('\0') != std::string_view::npos) return;
+        for (const shard_data& shard : shards_) {
+            const auto [lo, hi] = rank_range(shard, pattern);
+            const std::uint64_t base = starts_[shard.first_record];
+            for (std::size_t r = lo; r < hi; ++r) fn(locate(base + static_cast<std::uint64_t>(shard.sa[r]), shard));
+        }
+    }
+
+    // Every occurrence of `pattern` into `out` (cleared first), by record then offset
+    void find_all(std::string_view pattern, std::vector<hit>& out) const {
+        out.clear();
+        for_each_occurrence(pattern, [&out](hit h) { out.push_back(h); });
+        std::sort(out.begin(), out.end());
+    }
+
+    [[nodiscard]] std::vector<hit> find_all(std::string_view pattern) const {
+        std::vector<hit> out;
+        find_all(pattern, out);
+        return out;
+    }
+
+    // ==================== Access ====================
+
+    [[nodiscard]] std::size_t size() const noexcept { return starts_.size() - 1; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+    // True once build() or load() has made the current records searchable
+    [[nodiscard]] bool built() const noexcept { return empty() || !shards_.empty(); }
+
+    [[nodiscard]] std::string_view record(std::size_t id) const noexcept {
+        return corpus_.substr(starts_[id], starts_[id + 1] - starts_[id] - 1);
+    }
+
+    [[nodiscard]] std::size_t shard_count() const noexcept { return shards_.size(); }
+
+    [[nodiscard]] shard_view shard(std::size_t i) const noexcept {
+        const shard_data& s = shards_[i];
+        return {shard_text(s), s.sa, s.lcp, s.first_record, s.records};
+    }
+
+    // ==================== Persistence ====================
+
+    /**
+     * @brief Write the built index to `path`; false on I/O failure or if
+     *        records were added since the last build
+     */
+    bool save(const char* path) const {
+        if (!built()) return false;
+        std::unique_ptr<std::FILE, stream::detail::file_closer> file{path ? std::fopen(path, "wb") : nullptr};
+        if (!file) return false;
+
+        detail::file_header header{};
+        std::memcpy(header.magic, detail::index_magic, sizeof header.magic);
+        header.byte_order = detail::index_byte_order;
+        header.shards = static_cast<std::uint32_t>(shards_.size());
+        header.records = size();
+        header.corpus_size = corpus_.size();
+        header.starts_at = detail::align8(sizeof header + shards_.size() * sizeof(detail::file_shard));
+        header.corpus_at = header.starts_at + starts_.size() * sizeof(std::uint64_t);
+
+        std::vector<detail::file_shard> table(shards_.size());
+        std::uint64_t at = detail::align8(header.corpus_at + corpus_.size());
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            const std::uint64_t bytes = shards_[i].sa.size() * sizeof(std::int32_t);
+            table[i] = {shards_[i].first_record, shards_[i].records, at, detail::align8(at + bytes)};
+            at = detail::align8(table[i].lcp_at + bytes);
+        }
+
+        std::uint64_t written = 0;
+        bool ok = true;
+        auto put = [&](std::uint64_t offset, const void* data, std::size_t n) {
+            static constexpr char zeros[8] = {};
+            ok = ok && std::fwrite(zeros, 1, offset - written, file.get()) == offset - written;
+            ok = ok && std::fwrite(data, 1, n, file.get()) == n;
+            written = offset + n;
+        };
+        put(0, &header, sizeof header);
+        put(sizeof header, table.data(), table.size() * sizeof(detail::file_shard));
+        put(header.starts_at, starts_.data(), starts_.size_bytes());
+        put(header.corpus_at, corpus_.data(), corpus_.size());
+        for (std::size_t i = 0; i < shards_.size(); ++i) {
+            put(table[i].sa_at, shards_[i].sa.data(), shards_[i].sa.size_bytes());
+            put(table[i].lcp_at, shards_[i].lcp.data(), shards_[i].lcp.size_bytes());
+        }
+        return ok && std::fflush(file.get()) == 0;
+    }
+
+    /**
+     * @brief Replace this index with the one saved at `path`, searched in
+     *        place from the mapping; false (index unchanged) if the file
+     *        is missing or malformed
+     */
+    bool load(const char* path) {
+        stream::mapped_file file(path);
+        if (!file || file.size() < sizeof(detail::file_header)) return false;
+        const char* data = file.data();
+        const std::uint64_t size = file.size();
+        if (reinterpret_cast<std::uintptr_t>(data) % 8 != 0) return false;
+
+        detail::file_header header;
+        std::memcpy(&header, data, sizeof header);
+        auto fits = [size](std::uint64_t at, std::uint64_t count, std::uint64_t width) {
+            return at % 8 == 0 && at <= size && count <= (size - at) / width;
+        };
+        if (std::memcmp(header.magic, detail::index_magic, sizeof header.magic) != 0 ||
+            header.byte_order != detail::index_byte_order ||
+            !fits(sizeof header, header.shards, sizeof(detail::file_shard)) ||
+            header.records >= ~std::uint64_t{0} / 8 || !fits(header.starts_at, header.records + 1, 8) ||
+            header.corpus_at > size || header.corpus_size > size - header.corpus_at) {
+            return false;
+        }
+
+        const std::span starts(reinterpret_cast<const std::uint64_t*>(data + header.starts_at), header.records + 1);
+        if (starts.front() != 0 || starts.back() != header.corpus_size) return false;
+        for (std::size_t i = 1; i < starts.size(); ++i) {
+            if (starts[i] <= starts[i - 1]) return false;
+        }
+
+        std::vector<detail::file_shard> table(header.shards);
+        std::memcpy(table.data(), data + sizeof header, table.size() * sizeof(detail::file_shard));
+        std::vector<shard_data> shards(table.size());
+        std::uint64_t next = 0;
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            const detail::file_shard& t = table[i];
+            if (t.first_record != next || t.records == 0 || t.records > header.records - next) return false;
+            next += t.records;
+            const std::uint64_t bytes = starts[next] - starts[t.first_record];
+            if (!fits(t.sa_at, bytes, 4) || !fits(t.lcp_at, bytes, 4)) return false;
+            shards[i].first_record = t.first_record;
+            shards[i].records = t.records;
+            shards[i].sa = {reinterpret_cast<const std::int32_t*>(data + t.sa_at), bytes};
+            shards[i].lcp = {reinterpret_cast<const std::int32_t*>(data + t.lcp_at), bytes};
+
+            // Searches index the text by these without further checks
+            for (std::size_t k = 0; k < bytes; ++k) {
+                const std::int32_t start = shards[i].sa[k];
+                const std::int32_t common = shards[i].lcp[k];
+                if (start < 0 || static_cast<std::uint64_t>(start) >= bytes || common < 0 ||
+                    static_cast<std::uint64_t>(common) > bytes - static_cast<std::uint64_t>(start)) {
+                    return false;
+                }
+            }
+        }
+        if (next != header.records || (header.records != 0 && table.empty())) return false;
+
+        file_ = std::move(file);
+        corpus_buffer_.clear();
+        starts_buffer_.assign(1, 0);
+        corpus_ = {data + header.corpus_at, header.corpus_size};
+        starts_ = starts;
+        shards_ = std::move(shards);
+        return true;
+    }
+
+    // True if the index lives in a file mapped by load()
+    [[nodiscard]] bool is_loaded() const noexcept { return static_cast<bool>(file_); }
+
+private:
+    struct shard_data {
+        std::size_t first_record = 0;
+        std::size_t records = 0;
+        std::span<const std::int32_t> sa;   // into sa_buffer, or the loaded file
+        std::span<const std::int32_t> lcp;
+        std::vector<std::int32_t> sa_buffer;
+        std::vector<std::int32_t> lcp_buffer;
+    };
+
+    [[nodiscard]] std::string_view shard_text(const shard_data& shard) const noexcept {
+        const std::uint64_t begin = starts_[shard.first_record];
+        return corpus_.substr(begin, starts_[shard.first_record + shard.records] - begin);
+    }
+
+    [[nodiscard]] std::pair<std::size_t, std::size_t> rank_range(const shard_data& shard,
+                                                                 std::string_view pattern) const noexcept {
+        const std::string_view text = shard_text(shard);
+        const std::size_t lo = detail::suffix_bound(text, shard.sa, pattern, false);
+        const std::size_t hi = detail::suffix_bound(text, shard.sa.subspan(lo), pattern, true);
+        return {lo, lo + hi};
+    }
+
+    // Record and offset of corpus position `pos` inside `shard`
+    [[nodiscard]] hit locate(std::uint64_t pos, const shard_data& shard) const noexcept {
+        const auto first = starts_.begin() + static_cast<std::ptrdiff_t>(shard.first_record);
+        const auto last = first + static_cast<std::ptrdiff_t>(shard.records);
+        const auto record = static_cast<std::size_t>(std::upper_bound(first, last, pos) - starts_.begin()) - 1;
+        return {static_cast<std::uint32_t>(record), static_cast<std::uint32_t>(pos - starts_[record])};
+    }
+
+    // Copy a loaded index's records into owned buffers before changing them
+    void own() {
+        if (!file_) return;
+        corpus_buffer_.assign(corpus_.begin(), corpus_.end());
+        starts_buffer_.assign(starts_.begin(), starts_.end());
+        shards_.clear();
+        file_ = stream::mapped_file();
+        point_at_buffers();
+    }
+
+    void point_at_buffers() noexcept {
+        corpus_ = {corpus_buffer_.data(), corpus_buffer_.size()};
+        starts_ = starts_buffer_;
+    }
+
+    std::vector<char> corpus_buffer_;                  // records, each followed by '\0'
+    std::vector<std::uint64_t> starts_buffer_{0};      // record i at [starts[i], starts[i + 1] - 1)
+    std::string_view corpus_;                          // into corpus_buffer_, or the loaded file
+    std::span<const std::uint64_t> starts_{starts_buffer_};
+    std::vector<shard_data> shards_;
+    stream::mapped_file file_;
+};
+
+} // namespace zuu::suffix
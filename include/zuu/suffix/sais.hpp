@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file zuu/suffix/sais.hpp
+ * @brief Linear-time suffix array (SA-IS) and LCP array (Kasai) construction
+ * @version 3.0.0
+ *
+ * SA-IS (Nong, Zhang and Chan): suffixes are typed S or L by comparing each
+ * with its successor; the leftmost-S (LMS) substrings are sorted by one
+ * induced-sorting pass, renamed, and sorted recursively if any two are
+ * equal; a second induced pass then places every suffix. Each level is
+ * linear and works on at most half as many symbols as the one above.
+ *
+ * Kasai et al.: walking suffixes in text order, the common prefix with the
+ * lexicographic predecessor shrinks by at most one per step, so all LCPs
+ * cost O(n) character comparisons.
+ *
+ * Bytes compare as unsigned char, like memcmp and std::string_view. Indexes
+ * are 32-bit: texts must be shorter than 2^31 bytes.
+ *
+ * Usage:
+ *   std::vector<std::int32_t> sa = suffix::suffix_array(text);
+ *   std::vector<std::int32_t> lcp = suffix::lcp_array(text, sa);   // lcp[i]: sa[i - 1] vs sa[i]
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace zuu::suffix {
+
+namespace detail {
+
+/**
+ * @brief Suffix array of s (symbols in [0, upper]) into sa (size n)
+ */
+template <typename Symbol>
+void sais(std::span<const Symbol> s, std::int32_t upper, std::span<std::int32_t> sa) {
+    const auto n = static_cast<std::int32_t>(s.size());
+    if (n == 0) return;
+    if (n == 1) {
+        sa[0] = 0;
+        return;
+    }
+    if (n == 2) {
+        sa[0] = s[0] < s[1] ? 0 : 1;
+        sa[1] = 1 - sa[0];
+        return;
+    }
+
+    auto symbol = [&s](std::int32_t i) { return static_cast<std::int32_t>(s[static_cast<std::size_t>(i)]); };
+
+    // is_s[i]: suffix i is smaller than suffix i + 1 (the last suffix is L);
+    // bytes rather than vector<bool>, which costs a shift and mask per read
+    std::vector<unsigned char> is_s(static_cast<std::size_t>(n), 0);
+    for (std::int32_t i = n - 2; i >= 0; --i) {
+        is_s[i] = symbol(i) == symbol(i + 1) ? is_s[i + 1] : symbol(i) < symbol(i + 1);
+    }
+
+    // Bucket c holds suffixes starting with c: L-type first (from l_start[c]),
+    // then S-type (from s_start[c])
+    std::vector<std::int32_t> l_start(static_cast<std::size_t>(upper) + 2, 0);
+    std::vector<std::int32_t> s_start(static_cast<std::size_t>(upper) + 2, 0);
+    for (std::int32_t i = 0; i < n; ++i) {
+        if (!is_s[i]) ++s_start[symbol(i)];
+        else ++l_start[symbol(i) + 1];
+    }
+    for (std::int32_t c = 0; c <= upper; ++c) {
+        s_start[c] += l_start[c];
+        l_start[c + 1] += s_start[c];
+    }
+
+    std::vector<std::int32_t> bucket(static_cast<std::size_t>(upper) + 2);
+    auto induce = [&](std::span<const std::int32_t> lms) {
+        std::fill(sa.begin(), sa.end(), -1);
+        std::copy(s_start.begin(), s_start.end(), bucket.begin());
+        for (const std::int32_t d : lms) {
+            if (d != n) sa[bucket[symbol(d)]++] = d;
+        }
+
+        // L-type suffixes, left to right, each after its successor
+        std::copy(l_start.begin(), l_start.end(), bucket.begin());
+        sa[bucket[symbol(n - 1)]++] = n - 1;
+        for (std::int32_t i = 0; i < n; ++i) {
+            const std::int32_t v = sa[i];
+            if (v >= 1 && !is_s[v - 1]) sa[bucket[symbol(v - 1)]++] = v - 1;
+        }
+
+        // S-type suffixes, right to left, filling each bucket from its end
+        std::copy(l_start.begin(), l_start.end(), bucket.begin());
+        for (std::int32_t i = n - 1; i >= 0; --i) {
+            const std::int32_t v = sa[i];
+            if (v >= 1 && is_s[v - 1]) sa[--bucket[symbol(v - 1) + 1]] = v - 1;
+        }
+    };
+
+    // LMS positions in text order, and each one's rank among them
+    std::vector<std::int32_t> lms_rank(static_cast<std::size_t>(n) + 1, -1);
+    std::vector<std::int32_t> lms;
+    for (std::int32_t i = 1; i < n; ++i) {
+        if (!is_s[i - 1] && is_s[i]) {
+            lms_rank[i] = static_cast<std::int32_t>(lms.size());
+            lms.push_back(i);
+        }
+    }
+    induce(lms);
+    if (lms.empty()) return;
+
+    // Name the LMS substrings in sorted order; equal substrings share a name
+    const auto m = static_cast<std::int32_t>(lms.size());
+    std::vector<std::int32_t> sorted_lms;
+    sorted_lms.reserve(lms.size());
+    for (const std::int32_t v : sa) {
+        if (lms_rank[v] != -1) sorted_lms.push_back(v);
+    }
+
+    std::vector<std::int32_t> reduced(lms.size());
+    std::int32_t name = 0;
+    reduced[lms_rank[sorted_lms[0]]] = 0;
+    for (std::int32_t i = 1; i < m; ++i) {
+        std::int32_t l = sorted_lms[i - 1];
+        std::int32_t r = sorted_lms[i];
+        const std::int32_t end_l = lms_rank[l] + 1 < m ? lms[lms_rank[l] + 1] : n;
+        const std::int32_t end_r = lms_rank[r] + 1 < m ? lms[lms_rank[r] + 1] : n;
+        bool same = end_l - l == end_r - r;
+        if (same) {
+            while (l < end_l && symbol(l) == symbol(r)) {
+                ++l;
+                ++r;
+            }
+            same = l != n && symbol(l) == symbol(r);
+        }
+        if (!same) ++name;
+        reduced[lms_rank[sorted_lms[i]]] = name;
+    }
+
+    // Sort the LMS suffixes through the reduced string, then induce the rest
+    std::vector<std::int32_t> reduced_sa(lms.size());
+    sais<std::int32_t>(reduced, name, reduced_sa);
+    for (std::int32_t i = 0; i < m; ++i) sorted_lms[i] = lms[reduced_sa[i]];
+    induce(sorted_lms);
+}
+
+} // namespace detail
+
+/**
+ * @brief Start positions of the suffixes of `text` in lexicographic order
+ */
+[[nodiscard]] inline std::vector<std::int32_t> suffix_array(std::string_view text) {
+    std::vector<std::int32_t> sa(text.size());
+    const std::span<const unsigned char> bytes(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+    detail::sais(bytes, 255, std::span<std::int32_t>(sa));
+    return sa;
+}
+
+/**
+ * @brief lcp[i] = length of the common prefix of suffixes sa[i - 1] and
+ *        sa[i] (lcp[0] = 0)
+ *
+ * Kasai's bound, computed in the Phi form (Karkkainen, Manzini and Puglisi):
+ * the predecessor of each suffix is stored by text position, so the
+ * comparison loop walks the text in order and only the final scatter reads
+ * in suffix order.
+ */
+[[nodiscard]] inline std::vector<std::int32_t> lcp_array(std::string_view text, std::span<const std::int32_t> sa) {
+    const std::size_t n = sa.size();
+    std::vector<std::int32_t> lcp(n, 0);
+    if (n == 0) return lcp;
+
+    // phi[p]: start of the suffix just before suffix p in sa (-1 for the first)
+    std::vector<std::int32_t> phi(n);
+    phi[sa[0]] = -1;
+    for (std::size_t i = 1; i < n; ++i) phi[sa[i]] = sa[i - 1];
+
+    // Reuse phi for the common prefix by text position
+    std::size_t h = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (phi[i] < 0) {
+            h = 0;
+            phi[i] = 0;
+            continue;
+        }
+        const auto j = static_cast<std::size_t>(phi[i]);
+        while (i + h < n && j + h < n && text[i + h] == text[j + h]) ++h;
+        phi[i] = static_cast<std::int32_t>(h);
+        if (h > 0) --h;
+    }
+    for (std::size_t i = 1; i < n; ++i) lcp[i] = phi[sa[i]];
+    return lcp;
+}
+
+} // namespace zuu::suffix
@@ -0,0 +1,256 @@
+#pragma once
+
+/**
+ * @file zuu/testing/alloc_audit.hpp
+ * @brief Heap allocation counting for tests and benchmarks
+ * @version 3.0.0
+ *
+ * Checks the "no heap" guarantee: replacement global operator new/delete
+ * count allocations per thread, and ZUU_EXPECT_NO_ALLOC fails its block
+ * if the current thread allocated inside it.
+ *
+ * Exactly one translation unit of the program defines
+ * ZUU_ALLOC_AUDIT_MAIN before including this header; that unit provides
+ * the replacement operators. Additionally defining ZUU_ALLOC_AUDIT_MALLOC
+ * there also interposes malloc, calloc, realloc and free (glibc only, and
+ * not under AddressSanitizer/ThreadSanitizer, which own those symbols),
+ * so C allocations are caught too. Without the main unit nothing is
+ * counted and active() is false.
+ *
+ * Usage:
+ *   #define ZUU_ALLOC_AUDIT_MAIN
+ *   #include <zuu/testing/alloc_audit.hpp>
+ *
+ *   ZUU_EXPECT_NO_ALLOC {
+ *       auto parts = line | trim | split(',');
+ *   }   // throws testing::alloc_violation if anything was allocated
+ *
+ *   testing::alloc_scope scope;
+ *   run_workload();
+ *   std::printf("%zu allocations\n", scope.count());
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <stdexcept>
+
+namespace zuu::testing {
+
+namespace detail {
+
+struct alloc_counters {
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+};
+
+// Trivially initialized, so reading it never allocates (even from malloc)
+inline thread_local alloc_counters thread_counters;
+
+inline bool audit_installed = false;
+
+inline void note_allocation(std::size_t bytes) noexcept {
+    ++thread_counters.allocations;
+    thread_counters.bytes += bytes;
+}
+
+} // namespace detail
+
+// True if the replacement operators are linked in (ZUU_ALLOC_AUDIT_MAIN)
+[[nodiscard]] inline bool active() noexcept { return detail::audit_installed; }
+
+// Allocations made by the calling thread since it started
+[[nodiscard]] inline std::size_t thread_allocations() noexcept { return detail::thread_counters.allocations; }
+
+class alloc_violation : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief Counts the calling thread's allocations from construction on
+ */
+class alloc_scope {
+public:
+    alloc_scope() noexcept
+        : start_{detail::thread_counters} {}
+
+    alloc_scope(const char* file, int line) noexcept
+        : start_{detail::thread_counters}, file_{file}, line_{line} {}
+
+    [[nodiscard]] std::size_t count() const noexcept {
+        return detail::thread_counters.allocations - start_.allocations;
+    }
+
+    [[nodiscard]] std::size_t bytes() const noexcept {
+        return detail::thread_counters.bytes - start_.bytes;
+    }
+
+    // Throw alloc_violation if anything was allocated so far
+    void expect_none() const {
+        const std::size_t n = count();
+        if (n == 0) return;
+        // Built after the check, so the message itself is not counted
+        char message[256];
+        std::snprintf(message, sizeof message, "%zu heap allocation(s), %zu bytes, in scope at %s:%d", n,
+                      bytes(), file_ ? file_ : "?", line_);
+        throw alloc_violation(message);
+    }
+
+    // Drives ZUU_EXPECT_NO_ALLOC: true once for the body, then checks
+    [[nodiscard]] bool run_once() {
+        if (!ran_) return ran_ = true;
+        expect_none();
+        return false;
+    }
+
+private:
+    detail::alloc_counters start_;
+    const char* file_ = nullptr;
+    int line_ = 0;
+    bool ran_ = false;
+};
+
+} // namespace zuu::testing
+
+/**
+ * @brief Run the following block and throw testing::alloc_violation if the
+ *        calling thread allocated inside it
+ *
+ * A `break` or exception leaves the block without the check.
+ */
+#define ZUU_EXPECT_NO_ALLOC \
+    for (::zuu::testing::alloc_scope zuu_alloc_scope_{__FILE__, __LINE__}; zuu_alloc_scope_.run_once();)
+
+// ==================== Replacement Operators ====================
+
+#if defined(ZUU_ALLOC_AUDIT_MAIN)
+
+#include <cstdlib>
+#include <new>
+
+#if defined(ZUU_ALLOC_AUDIT_MALLOC) && defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && \
+    !defined(__SANITIZE_THREAD__)
+    #if defined(__has_feature)
+        #if !__has_feature(address_sanitizer) && !__has_feature(thread_sanitizer)
+            #define ZUU_ALLOC_AUDIT_INTERPOSE 1
+        #endif
+    #else
+        #define ZUU_ALLOC_AUDIT_INTERPOSE 1
+    #endif
+#endif
+
+#if defined(ZUU_ALLOC_AUDIT_INTERPOSE)
+
+extern "C" {
+void* __libc_malloc(std::size_t);
+void* __libc_calloc(std::size_t, std::size_t);
+void* __libc_realloc(void*, std::size_t);
+void __libc_free(void*);
+
+void* malloc(std::size_t n) {
+    zuu::testing::detail::note_allocation(n);
+    return __libc_malloc(n);
+}
+
+void* calloc(std::size_t count, std::size_t n) {
+    zuu::testing::detail::note_allocation(count * n);
+    return __libc_calloc(count, n);
+}
+
+void* realloc(void* p, std::size_t n) {
+    zuu::testing::detail::note_allocation(n);
+    return __libc_realloc(p, n);
+}
+
+void free(void* p) { __libc_free(p); }
+}
+
+#endif // ZUU_ALLOC_AUDIT_INTERPOSE
+
+namespace zuu::testing::detail {
+
+inline const bool audit_registered = (audit_installed = true);
+
+inline void* counted_alloc(std::size_t n) noexcept {
+#if defined(ZUU_ALLOC_AUDIT_INTERPOSE)
+    return std::malloc(n == 0 ? 1 : n);  // counted by the malloc above
+#else
+    note_allocation(n);
+    return std::malloc(n == 0 ? 1 : n);
+#endif
+}
+
+inline void* counted_aligned_alloc(std::size_t n, std::align_val_t align) noexcept {
+    const auto a = static_cast<std::size_t>(align);
+    note_allocation(n);
+#if defined(_MSC_VER)
+    return _aligned_malloc(n == 0 ? 1 : n, a);
+#else
+    void* p = nullptr;
+    return ::posix_memalign(&p, a < sizeof(void*) ? sizeof(void*) : a, n == 0 ? 1 : n) == 0 ? p : nullptr;
+#endif
+}
+
+// Kept out of line: once inlined into operator delete, GCC pairs the free
+// with operator new and warns (-Wmismatched-new-delete)
+#if defined(__GNUC__)
+[[gnu::noinline]]
+#endif
+inline void release(void* p) noexcept { std::free(p); }
+
+inline void aligned_free(void* p) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(p);
+#else
+    release(p);
+#endif
+}
+
+} // namespace zuu::testing::detail
+
+void* operator new(std::size_t n) {
+    if (void* p = zuu::testing::detail::counted_alloc(n)) return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t n) {
+    if (void* p = zuu::testing::detail::counted_alloc(n)) return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept { return zuu::testing::detail::counted_alloc(n); }
+void* operator new[](std::size_t n, const std::nothrow_t&) noexcept { return zuu::testing::detail::counted_alloc(n); }
+
+void* operator new(std::size_t n, std::align_val_t a) {
+    if (void* p = zuu::testing::detail::counted_aligned_alloc(n, a)) return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t n, std::align_val_t a) {
+    if (void* p = zuu::testing::detail::counted_aligned_alloc(n, a)) return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return zuu::testing::detail::counted_aligned_alloc(n, a);
+}
+
+void* operator new[](std::size_t n, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return zuu::testing::detail::counted_aligned_alloc(n, a);
+}
+
+void operator delete(void* p) noexcept { zuu::testing::detail::release(p); }
+void operator delete[](void* p) noexcept { zuu::testing::detail::release(p); }
+void operator delete(void* p, std::size_t) noexcept { zuu::testing::detail::release(p); }
+void operator delete[](void* p, std::size_t) noexcept { zuu::testing::detail::release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { zuu::testing::detail::release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { zuu::testing::detail::release(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { zuu::testing::detail::aligned_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { zuu::testing::detail::aligned_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { zuu::testing::detail::aligned_free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { zuu::testing::detail::aligned_free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { zuu::testing::detail::aligned_free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { zuu::testing::detail::aligned_free(p); }
+
+#endif // ZUU_ALLOC_AUDIT_MAIN
@@ -0,0 +1,26 @@
+#pragma once
+
+/**
+ * @file zuu/unicode.hpp
+ * @brief Unicode canonical normalization for UTF-8 fstrings
+ * @version 3.0.0
+ *
+ * Opt-in companion to fstring.hpp: NFC and NFD normalization of
+ * u8fstring (or any single-byte UTF-8 text), with a vectorized quick check
+ * that lets already-normalized input through untouched, and truncation
+ * reporting when a normalized result outgrows its fixed capacity.
+ *
+ * @code
+ * #include <zuu/unicode.hpp>
+ * using namespace zuu;
+ *
+ * u8fstring<64> user = input;
+ * unicode::normalize(user, unicode::normal_form::nfc);   // before comparing or hashing
+ * auto key = user | unicode::to_nfd;
+ * @endcode
+ */
+
+#include "fstring.hpp"
+
+#include "unicode/tables.hpp"
+#include "unicode/normalize.hpp"
@@ -0,0 +1,496 @@
+#pragma once
+
+/**
+ * @file zuu/unicode/normalize.hpp
+ * @brief Canonical normalization (NFC / NFD) of UTF-8 fstrings
+ * @version 3.0.0
+ *
+ * Quick check first: a code point is "safe" for a form if it is a starter
+ * that the form leaves alone and that cannot combine with what precedes
+ * it, so any run of safe code points is already normalized. The check
+ * runs 16 bytes at a time: blocks of ASCII and continuation bytes are
+ * skipped outright, and lead bytes are looked up in a 256-bit set of
+ * leads whose every code point is safe (all of Latin-1 and CJK for NFC,
+ * say); only other leads are decoded and looked up one by one.
+ *
+ * Normalization copies safe runs verbatim and rebuilds only the stretch
+ * from the last safe code point before an unsafe one up to the next safe
+ * one: full canonical decomposition (Hangul algorithmically), canonical
+ * reordering by combining class and, for NFC, canonical composition.
+ * Tables are sorted packed words (unicode/tables.hpp, generated from the
+ * Unicode character database by tools/gen_unicode_tables.py).
+ *
+ * Normalization can change the length (NFD of "é" is 3 bytes, of a Hangul
+ * syllable 9). A result that does not fit the destination is cut at a
+ * code point boundary and reported in normalize_status, with the size the
+ * whole result needs. Invalid UTF-8 bytes are passed through unchanged.
+ * Stretches of more than 60 or so combining marks in a row (beyond the
+ * Stream-Safe Text Format of UAX #15) are reordered in pieces.
+ *
+ * Usage:
+ *   u8fstring<64> name = read_name();
+ *   if (!unicode::is_nfc(name)) unicode::normalize(name, unicode::normal_form::nfc);
+ *
+ *   auto decomposed = name | unicode::to_nfd;             // same capacity, may truncate
+ *   u8fstring<128> out;
+ *   auto status = unicode::normalize_into(out, name, unicode::normal_form::nfd);
+ *   if (!status) { ... status.required ... }
+ */
+
+#include "../core/core.hpp"
+#include "../meta/concepts.hpp"
+#include "../meta/traits.hpp"
+#include "../simd/config.hpp"
+#include "../str/pipe.hpp"
+#include "../str/policy.hpp"
+#include "tables.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+
+namespace zuu::unicode {
+
+enum class normal_form { nfc, nfd };
+
+/**
+ * @brief Outcome of a normalization: bytes written, bytes the whole
+ *        result needs, and whether it was cut short
+ */
+struct normalize_status {
+    std::size_t written = 0;
+    std::size_t required = 0;
+    bool truncated = false;
+
+    [[nodiscard]] explicit operator bool() const noexcept { return !truncated; }
+};
+
+namespace detail {
+
+// ==================== Character Data ====================
+
+// Invalid UTF-8 byte b travels through as the pseudo code point raw_byte + b
+inline constexpr char32_t raw_byte = 0x110000;
+
+inline constexpr char32_t hangul_s = 0xAC00;
+inline constexpr char32_t hangul_l = 0x1100;
+inline constexpr char32_t hangul_v = 0x1161;
+inline constexpr char32_t hangul_t = 0x11A7;
+inline constexpr char32_t hangul_v_count = 21;
+inline constexpr char32_t hangul_t_count = 28;
+inline constexpr char32_t hangul_n_count = hangul_v_count * hangul_t_count;
+inline constexpr char32_t hangul_s_count = 19 * hangul_n_count;
+
+inline std::uint8_t combining_class(char32_t cp) noexcept {
+    const std::uint64_t key = std::uint64_t{cp} << 32 | 0xFFFFFFFFu;
+    const auto* it = std::upper_bound(std::begin(combining_classes), std::end(combining_classes), key);
+    if (it == std::begin(combining_classes)) return 0;
+    --it;
+    return cp <= ((*it >> 8) & 0xFFFFFF) ? static_cast<std::uint8_t>(*it) : 0;
+}
+
+// True if cp lies in one of the packed first << 32 | last ranges
+inline bool in_ranges(std::span<const std::uint64_t> ranges, char32_t cp) noexcept {
+    const std::uint64_t key = std::uint64_t{cp} << 32 | 0xFFFFFFFFu;
+    const auto it = std::upper_bound(ranges.begin(), ranges.end(), key);
+    return it != ranges.begin() && cp <= (it[-1] & 0xFFFFFFFFu);
+}
+
+template <normal_form Form>
+bool is_safe(char32_t cp) noexcept {
+    if (cp < 0xC0 || cp >= raw_byte) return true;
+    if (cp >= hangul_s && cp < hangul_s + hangul_s_count) return Form == normal_form::nfc;
+    return !in_ranges(Form == normal_form::nfc ? std::span<const std::uint64_t>(nfc_unsafe)
+                                               : std::span<const std::uint64_t>(nfd_unsafe), cp);
+}
+
+template <normal_form Form>
+bool is_safe_lead(unsigned char lead) noexcept {
+    const auto& leads = Form == normal_form::nfc ? nfc_safe_leads : nfd_safe_leads;
+    return (leads[lead / 64] >> (lead % 64)) & 1;
+}
+
+// Composite of the pair, or 0
+inline char32_t compose_pair(char32_t a, char32_t b) noexcept {
+    if (a >= hangul_l && a < hangul_l + 19 && b >= hangul_v && b < hangul_v + hangul_v_count) {
+        return hangul_s + ((a - hangul_l) * hangul_v_count + (b - hangul_v)) * hangul_t_count;
+    }
+    if (a >= hangul_s && a < hangul_s + hangul_s_count && (a - hangul_s) % hangul_t_count == 0 &&
+        b > hangul_t && b < hangul_t + hangul_t_count) {
+        return a + (b - hangul_t);
+    }
+    if (a >= raw_byte || b >= raw_byte) return 0;
+
+    const std::uint64_t key = std::uint64_t{a} << 42 | std::uint64_t{b} << 21;
+    const auto* it = std::lower_bound(std::begin(compositions), std::end(compositions), key);
+    if (it == std::end(compositions) || (*it >> 21) != (key >> 21)) return 0;
+    return static_cast<char32_t>(*it & 0x1FFFFF);
+}
+
+// ==================== UTF-8 ====================
+
+struct decoded {
+    char32_t cp;
+    std::size_t length;
+};
+
+// Code point at p (n bytes available); an invalid sequence yields one raw byte
+inline decoded decode(const unsigned char* p, std::size_t n) noexcept {
+    const unsigned char b = p[0];
+    if (b < 0x80) return {b, 1};
+
+    std::size_t length;
+    char32_t cp;
+    char32_t min;
+    if (b >= 0xC2 && b <= 0xDF) {
+        length = 2;
+        cp = b & 0x1F;
+        min = 0x80;
+    } else if (b >= 0xE0 && b <= 0xEF) {
+        length = 3;
+        cp = b & 0x0F;
+        min = 0x800;
+    } else if (b >= 0xF0 && b <= 0xF4) {
+        length = 4;
+        cp = b & 0x07;
+        min = 0x10000;
+    } else {
+        return {raw_byte + b, 1};
+    }
+    if (length > n) return {raw_byte + b, 1};
+    for (std::size_t i = 1; i < length; ++i) {
+        if ((p[i] & 0xC0) != 0x80) return {raw_byte + b, 1};
+        cp = cp << 6 | (p[i] & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return {raw_byte + b, 1};
+    return {cp, length};
+}
+
+inline std::size_t encoded_length(char32_t cp) noexcept {
+    if (cp < 0x80 || cp >= raw_byte) return 1;
+    if (cp < 0x800) return 2;
+    return cp < 0x10000 ? 3 : 4;
+}
+
+inline void encode(char32_t cp, unsigned char* out) noexcept {
+    if (cp >= raw_byte) {
+        out[0] = static_cast<unsigned char>(cp - raw_byte);
+    } else if (cp < 0x80) {
+        out[0] = static_cast<unsigned char>(cp);
+    } else if (cp < 0x800) {
+        out[0] = static_cast<unsigned char>(0xC0 | (cp >> 6));
+        out[1] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out[0] = static_cast<unsigned char>(0xE0 | (cp >> 12));
+        out[1] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+    } else {
+        out[0] = static_cast<unsigned char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<unsigned char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<unsigned char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<unsigned char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// ==================== Quick Check ====================
+
+/**
+ * @brief Length of the longest prefix of safe code points (ends at the
+ *        first unsafe code point, or n)
+ */
+template <normal_form Form>
+std::size_t safe_prefix(const unsigned char* p, std::size_t n) noexcept {
+    std::size_t i = 0;
+    while (i < n) {
+#if defined(ZUU_SIMD_SSE2)
+        if (i + 16 <= n) {
+            // Lead bytes (0xC0-0xFF) are the only ones that start non-ASCII code points
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            const __m128i lead_mask = _mm_cmpgt_epi8(block, _mm_set1_epi8(-65));   // signed: ASCII or lead
+            auto leads = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(lead_mask, block)));
+            while (leads != 0 && is_safe_lead<Form>(p[i + static_cast<std::size_t>(std::countr_zero(leads))])) {
+                leads &= leads - 1;
+            }
+            if (leads == 0) {
+                i += 16;
+                continue;
+            }
+            i += static_cast<std::size_t>(std::countr_zero(leads));
+        }
+#endif
+        const unsigned char b = p[i];
+        if (b < 0xC0 || is_safe_lead<Form>(b)) {
+            ++i;
+            continue;
+        }
+        const decoded d = decode(p + i, n - i);
+        if (!is_safe<Form>(d.cp)) return i;
+        i += d.length;
+    }
+    return n;
+}
+
+// ==================== Output ====================
+
+/**
+ * @brief Writes into [data, data + capacity) until something does not fit,
+ *        counting the full size; with `expected` set, compares instead
+ */
+struct sink {
+    unsigned char* data = nullptr;
+    std::size_t capacity = 0;
+    const unsigned char* expected = nullptr;
+    std::size_t expected_size = 0;
+    normalize_status status;
+    bool differs = false;
+
+    void copy(const unsigned char* bytes, std::size_t n) noexcept {
+        if (expected) {
+            differs = differs || status.required + n > expected_size ||
+                      !std::equal(bytes, bytes + n, expected + status.required);
+        } else if (!status.truncated) {
+            std::size_t take = n;
+            if (take > capacity - status.written) {
+                take = capacity - status.written;
+                while (take > 0 && (bytes[take] & 0xC0) == 0x80) --take;  // keep code points whole
+                status.truncated = true;
+            }
+            std::copy_n(bytes, take, data + status.written);
+            status.written += take;
+        }
+        status.required += n;
+    }
+
+    void put(char32_t cp) noexcept {
+        unsigned char bytes[4];
+        encode(cp, bytes);
+        const std::size_t n = encoded_length(cp);
+        if (expected || n <= capacity - status.written) {
+            copy(bytes, n);
+        } else {
+            status.truncated = true;
+            status.required += n;
+        }
+    }
+};
+
+// ==================== Normalization ====================
+
+struct mark {
+    char32_t cp;
+    std::uint8_t ccc;
+};
+
+inline constexpr std::size_t max_segment = 64;  // code points rebuilt at once
+
+struct segment {
+    mark items[max_segment];
+    std::size_t size = 0;
+
+    void push(char32_t cp) noexcept { items[size++] = {cp, cp >= raw_byte ? std::uint8_t{0} : combining_class(cp)}; }
+};
+
+// Full canonical decomposition of cp, appended to seg
+inline void decompose(char32_t cp, segment& seg) noexcept {
+    if (cp >= hangul_s && cp < hangul_s + hangul_s_count) {
+        const char32_t s = cp - hangul_s;
+        seg.push(hangul_l + s / hangul_n_count);
+        seg.push(hangul_v + (s % hangul_n_count) / hangul_t_count);
+        if (s % hangul_t_count != 0) seg.push(hangul_t + s % hangul_t_count);
+        return;
+    }
+    if (cp >= 0xC0 && cp < raw_byte) {
+        const std::uint64_t key = std::uint64_t{cp} << 42;
+        const auto* it = std::lower_bound(std::begin(decompositions), std::end(decompositions), key);
+        if (it != std::end(decompositions) && (*it >> 42) == cp) {
+            decompose(static_cast<char32_t>((*it >> 21) & 0x1FFFFF), seg);
+            if (const auto second = static_cast<char32_t>(*it & 0x1FFFFF); second != 0) decompose(second, seg);
+            return;
+        }
+    }
+    seg.push(cp);
+}
+
+// Canonical order (stable by class within runs of non-starters), then for NFC compose; emit
+template <normal_form Form>
+void flush(segment& seg, sink& out) noexcept {
+    mark* m = seg.items;
+    for (std::size_t i = 1; i < seg.size; ++i) {
+        const mark item = m[i];
+        if (item.ccc == 0) continue;
+        std::size_t j = i;
+        for (; j > 0 && m[j - 1].ccc > item.ccc; --j) m[j] = m[j - 1];
+        m[j] = item;
+    }
+
+    std::size_t size = seg.size;
+    if constexpr (Form == normal_form::nfc) {
+        if (size > 1) {
+            std::size_t starter = m[0].ccc == 0 ? 0 : max_segment;
+            unsigned last_class = m[0].ccc == 0 ? 0 : 256;
+            size = 1;
+            for (std::size_t i = 1; i < seg.size; ++i) {
+                const mark item = m[i];
+                if (starter != max_segment && (last_class < item.ccc || last_class == 0)) {
+                    if (const char32_t composite = compose_pair(m[starter].cp, item.cp); composite != 0) {
+                        m[starter].cp = composite;
+                        continue;
+                    }
+                }
+                if (item.ccc == 0) starter = size;
+                last_class = item.ccc;
+                m[size++] = item;
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < size; ++i) out.put(m[i].cp);
+    seg.size = 0;
+}
+
+template <normal_form Form>
+void normalize(const unsigned char* p, std::size_t n, sink& out) noexcept {
+    segment seg;
+    std::size_t pos = 0;
+    while (pos < n) {
+        const std::size_t unsafe = pos + safe_prefix<Form>(p + pos, n - pos);
+        std::size_t start = unsafe;
+        if (Form == normal_form::nfc && unsafe > pos && unsafe < n) {
+            // The starter before may compose with what follows
+            --start;
+            while (start > pos && (p[start] & 0xC0) == 0x80) --start;
+        }
+        out.copy(p + pos, start - pos);
+        if (unsafe == n || out.differs) return;
+
+        // Rebuild up to the next safe code point
+        pos = start;
+        bool first = true;
+        while (pos < n) {
+            const decoded d = decode(p + pos, n - pos);
+            if (!first && is_safe<Form>(d.cp)) break;
+            if (seg.size + 4 > max_segment) flush<Form>(seg, out);
+            decompose(d.cp, seg);
+            pos += d.length;
+            first = false;
+        }
+        flush<Form>(seg, out);
+    }
+}
+
+template <normal_form Form, typename CharT>
+normalize_status write(const CharT* text, std::size_t n, CharT* dest, std::size_t capacity) noexcept {
+    sink out;
+    out.data = reinterpret_cast<unsigned char*>(dest);
+    out.capacity = capacity;
+    normalize<Form>(reinterpret_cast<const unsigned char*>(text), n, out);
+    return out.status;
+}
+
+template <normal_form Form, typename CharT>
+bool is_normalized(const CharT* text, std::size_t n) noexcept {
+    const auto* p = reinterpret_cast<const unsigned char*>(text);
+    if (safe_prefix<Form>(p, n) == n) return true;
+    sink out;
+    out.expected = p;
+    out.expected_size = n;
+    normalize<Form>(p, n, out);
+    return !out.differs && out.status.required == n;
+}
+
+template <typename Str>
+concept utf8_text = meta::string_like<Str> && sizeof(meta::char_type_of_t<Str>) == 1;
+
+template <normal_form Form>
+struct normalize_fn : str::pipe_adaptor<normalize_fn<Form>> {
+    template <meta::string_like Str>
+    auto apply(const Str& text) const {
+        return into<str::owning_output_t<Str>>(text);
+    }
+
+    // Explicit result type; fixed capacities truncate at a code point boundary
+    template <typename Out, utf8_text Str>
+    Out into(const Str& text) const {
+        const auto view = str::as_view(text);
+        using char_type = meta::char_type_of_t<Out>;
+        const auto* src = reinterpret_cast<const char_type*>(view.data());
+        Out out;
+        std::size_t capacity = 0;
+        if constexpr (meta::fixed_string<Out>) {
+            capacity = out.max_size();
+        } else {
+            capacity = write<Form>(src, view.size(), static_cast<char_type*>(nullptr), 0).required;
+        }
+        out.resize_and_overwrite(capacity, [&](char_type* dest, std::size_t count) {
+            return write<Form>(src, view.size(), dest, count).written;
+        });
+        return out;
+    }
+};
+
+} // namespace detail
+
+// ==================== Quick Check ====================
+
+/**
+ * @brief True if `text` is in NFC; mostly answered by the quick check,
+ *        otherwise by normalizing the unsafe stretches and comparing
+ */
+template <detail::utf8_text Str>
+[[nodiscard]] bool is_nfc(const Str& text) noexcept {
+    const auto view = str::as_view(text);
+    return detail::is_normalized<normal_form::nfc>(view.data(), view.size());
+}
+
+template <detail::utf8_text Str>
+[[nodiscard]] bool is_nfd(const Str& text) noexcept {
+    const auto view = str::as_view(text);
+    return detail::is_normalized<normal_form::nfd>(view.data(), view.size());
+}
+
+// ==================== Normalization ====================
+
+/**
+ * @brief Append the normalized form of `text` to `out`; if it does not
+ *        fit, as much as fits (whole code points) is appended and the
+ *        status reports truncated and the size the whole result needs
+ */
+template <meta::character CharT, std::size_t N, detail::utf8_text Str>
+    requires(sizeof(CharT) == 1)
+normalize_status normalize_into(basic_fstring<CharT, N>& out, const Str& text, normal_form form) noexcept {
+    const auto view = str::as_view(text);
+    const auto* src = reinterpret_cast<const CharT*>(view.data());
+    const std::size_t offset = out.size();
+    normalize_status status;
+    out.resize_and_overwrite(N, [&](CharT* dest, std::size_t count) {
+        status = form == normal_form::nfc ? detail::write<normal_form::nfc>(src, view.size(), dest + offset, count - offset)
+                                          : detail::write<normal_form::nfd>(src, view.size(), dest + offset, count - offset);
+        return offset + status.written;
+    });
+    return status;
+}
+
+/**
+ * @brief Normalize `text` in place (untouched if the quick check passes)
+ */
+template <meta::character CharT, std::size_t N>
+    requires(sizeof(CharT) == 1)
+normalize_status normalize(basic_fstring<CharT, N>& text, normal_form form) noexcept {
+    const auto* p = reinterpret_cast<const unsigned char*>(text.data());
+    const std::size_t safe = form == normal_form::nfc ? detail::safe_prefix<normal_form::nfc>(p, text.size())
+                                                      : detail::safe_prefix<normal_form::nfd>(p, text.size());
+    if (safe == text.size()) return {text.size(), text.size(), false};
+
+    basic_fstring<CharT, N> out;
+    const normalize_status status = normalize_into(out, text, form);
+    text = out;
+    return status;
+}
+
+// text | unicode::to_nfc, or to_nfc.into<Out>(text); fixed capacities may truncate
+inline constexpr detail::normalize_fn<normal_form::nfc> to_nfc;
+inline constexpr detail::normalize_fn<normal_form::nfd> to_nfd;
+
+} // namespace zuu::unicode
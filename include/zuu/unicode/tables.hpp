@@ -0,0 +1,1063 @@
+#pragma once
+
+/**
+ * @file zuu/unicode/tables.hpp
+ * @brief Canonical normalization data (generated, do not edit)
+ * @version 3.0.0
+ *
+ * Generated by tools/gen_unicode_tables.py from the Unicode 14.0.0
+ * character database. Entries are packed into sorted 64-bit words for
+ * binary search; see the script for the layouts. Hangul syllables are
+ * handled algorithmically and are not listed.
+ */
+
+#include <cstdint>
+
+namespace zuu::unicode::detail {
+
+inline constexpr const char* unicode_version = "14.0.0";
+
+// first << 32 | last << 8 | canonical combining class (non-zero classes only)
+inline constexpr std::uint64_t combining_classes[] = {
+    0x00000300000314e6, 0x00000315000315e8, 0x00000316000319dc, 0x0000031a00031ae8,
+    0x0000031b00031bd8, 0x0000031c000320dc, 0x00000321000322ca, 0x00000323000326dc,
+    0x00000327000328ca, 0x00000329000333dc, 0x0000033400033801, 0x0000033900033cdc,
+    0x0000033d000344e6, 0x00000345000345f0, 0x00000346000346e6, 0x00000347000349dc,
+    0x0000034a00034ce6, 0x0000034d00034edc, 0x00000350000352e6, 0x00000353000356dc,
+    0x00000357000357e6, 0x00000358000358e8, 0x0000035900035adc, 0x0000035b00035be6,
+    0x0000035c00035ce9, 0x0000035d00035eea, 0x0000035f00035fe9, 0x00000360000361ea,
+    0x00000362000362e9, 0x0000036300036fe6, 0x00000483000487e6, 0x00000591000591dc,
+    0x00000592000595e6, 0x00000596000596dc, 0x00000597000599e6, 0x0000059a00059ade,
+    0x0000059b00059bdc, 0x0000059c0005a1e6, 0x000005a20005a7dc, 0x000005a80005a9e6,
+    0x000005aa0005aadc, 0x000005ab0005ace6, 0x000005ad0005adde, 0x000005ae0005aee4,
+    0x000005af0005afe6, 0x000005b00005b00a, 0x000005b10005b10b, 0x000005b20005b20c,
+    0x000005b30005b30d, 0x000005b40005b40e, 0x000005b50005b50f, 0x000005b60005b610,
+    0x000005b70005b711, 0x000005b80005b812, 0x000005b90005ba13, 0x000005bb0005bb14,
+    0x000005bc0005bc15, 0x000005bd0005bd16, 0x000005bf0005bf17, 0x000005c10005c118,
+    0x000005c20005c219, 0x000005c40005c4e6, 0x000005c50005c5dc, 0x000005c70005c712,
+    0x00000610000617e6, 0x000006180006181e, 0x000006190006191f, 0x0000061a00061a20,
+    0x0000064b00064b1b, 0x0000064c00064c1c, 0x0000064d00064d1d, 0x0000064e00064e1e,
+    0x0000064f00064f1f, 0x0000065000065020, 0x0000065100065121, 0x0000065200065222,
+    0x00000653000654e6, 0x00000655000656dc, 0x0000065700065be6, 0x0000065c00065cdc,
+    0x0000065d00065ee6, 0x0000065f00065fdc, 0x0000067000067023, 0x000006d60006dce6,
+    0x000006df0006e2e6, 0x000006e30006e3dc, 0x000006e40006e4e6, 0x000006e70006e8e6,
+    0x000006ea0006eadc, 0x000006eb0006ece6, 0x000006ed0006eddc, 0x0000071100071124,
+    0x00000730000730e6, 0x00000731000731dc, 0x00000732000733e6, 0x00000734000734dc,
+    0x00000735000736e6, 0x00000737000739dc, 0x0000073a00073ae6, 0x0000073b00073cdc,
+    0x0000073d00073de6, 0x0000073e00073edc, 0x0000073f000741e6, 0x00000742000742dc,
+    0x00000743000743e6, 0x00000744000744dc, 0x00000745000745e6, 0x00000746000746dc,
+    0x00000747000747e6, 0x00000748000748dc, 0x0000074900074ae6, 0x000007eb0007f1e6,
+    0x000007f20007f2dc, 0x000007f30007f3e6, 0x000007fd0007fddc, 0x00000816000819e6,
+    0x0000081b000823e6, 0x00000825000827e6, 0x0000082900082de6, 0x0000085900085bdc,
+    0x00000898000898e6, 0x0000089900089bdc, 0x0000089c00089fe6, 0x000008ca0008cee6,
+    0x000008cf0008d3dc, 0x000008d40008e1e6, 0x000008e30008e3dc, 0x000008e40008e5e6,
+    0x000008e60008e6dc, 0x000008e70008e8e6, 0x000008e90008e9dc, 0x000008ea0008ece6,
+    0x000008ed0008efdc, 0x000008f00008f01b, 0x000008f10008f11c, 0x000008f20008f21d,
+    0x000008f30008f5e6, 0x000008f60008f6dc, 0x000008f70008f8e6, 0x000008f90008fadc,
+    0x000008fb0008ffe6, 0x0000093c00093c07, 0x0000094d00094d09, 0x00000951000951e6,
+    0x00000952000952dc, 0x00000953000954e6, 0x000009bc0009bc07, 0x000009cd0009cd09,
+    0x000009fe0009fee6, 0x00000a3c000a3c07, 0x00000a4d000a4d09, 0x00000abc000abc07,
+    0x00000acd000acd09, 0x00000b3c000b3c07, 0x00000b4d000b4d09, 0x00000bcd000bcd09,
+    0x00000c3c000c3c07, 0x00000c4d000c4d09, 0x00000c55000c5554, 0x00000c56000c565b,
+    0x00000cbc000cbc07, 0x00000ccd000ccd09, 0x00000d3b000d3c09, 0x00000d4d000d4d09,
+    0x00000dca000dca09, 0x00000e38000e3967, 0x00000e3a000e3a09, 0x00000e48000e4b6b,
+    0x00000eb8000eb976, 0x00000eba000eba09, 0x00000ec8000ecb7a, 0x00000f18000f19dc,
+    0x00000f35000f35dc, 0x00000f37000f37dc, 0x00000f39000f39d8, 0x00000f71000f7181,
+    0x00000f72000f7282, 0x00000f74000f7484, 0x00000f7a000f7d82, 0x00000f80000f8082,
+    0x00000f82000f83e6, 0x00000f84000f8409, 0x00000f86000f87e6, 0x00000fc6000fc6dc,
+    0x0000103700103707, 0x0000103900103a09, 0x0000108d00108ddc, 0x0000135d00135fe6,
+    0x0000171400171509, 0x0000173400173409, 0x000017d20017d209, 0x000017dd0017dde6,
+    0x000018a90018a9e4, 0x00001939001939de, 0x0000193a00193ae6, 0x0000193b00193bdc,
+    0x00001a17001a17e6, 0x00001a18001a18dc, 0x00001a60001a6009, 0x00001a75001a7ce6,
+    0x00001a7f001a7fdc, 0x00001ab0001ab4e6, 0x00001ab5001abadc, 0x00001abb001abce6,
+    0x00001abd001abddc, 0x00001abf001ac0dc, 0x00001ac1001ac2e6, 0x00001ac3001ac4dc,
+    0x00001ac5001ac9e6, 0x00001aca001acadc, 0x00001acb001acee6, 0x00001b34001b3407,
+    0x00001b44001b4409, 0x00001b6b001b6be6, 0x00001b6c001b6cdc, 0x00001b6d001b73e6,
+    0x00001baa001bab09, 0x00001be6001be607, 0x00001bf2001bf309, 0x00001c37001c3707,
+    0x00001cd0001cd2e6, 0x00001cd4001cd401, 0x00001cd5001cd9dc, 0x00001cda001cdbe6,
+    0x00001cdc001cdfdc, 0x00001ce0001ce0e6, 0x00001ce2001ce801, 0x00001ced001ceddc,
+    0x00001cf4001cf4e6, 0x00001cf8001cf9e6, 0x00001dc0001dc1e6, 0x00001dc2001dc2dc,
+    0x00001dc3001dc9e6, 0x00001dca001dcadc, 0x00001dcb001dcce6, 0x00001dcd001dcdea,
+    0x00001dce001dced6, 0x00001dcf001dcfdc, 0x00001dd0001dd0ca, 0x00001dd1001df5e6,
+    0x00001df6001df6e8, 0x00001df7001df8e4, 0x00001df9001df9dc, 0x00001dfa001dfada,
+    0x00001dfb001dfbe6, 0x00001dfc001dfce9, 0x00001dfd001dfddc, 0x00001dfe001dfee6,
+    0x00001dff001dffdc, 0x000020d00020d1e6, 0x000020d20020d301, 0x000020d40020d7e6,
+    0x000020d80020da01, 0x000020db0020dce6, 0x000020e10020e1e6, 0x000020e50020e601,
+    0x000020e70020e7e6, 0x000020e80020e8dc, 0x000020e90020e9e6, 0x000020ea0020eb01,
+    0x000020ec0020efdc, 0x000020f00020f0e6, 0x00002cef002cf1e6, 0x00002d7f002d7f09,
+    0x00002de0002dffe6, 0x0000302a00302ada, 0x0000302b00302be4, 0x0000302c00302ce8,
+    0x0000302d00302dde, 0x0000302e00302fe0, 0x0000309900309a08, 0x0000a66f00a66fe6,
+    0x0000a67400a67de6, 0x0000a69e00a69fe6, 0x0000a6f000a6f1e6, 0x0000a80600a80609,
+    0x0000a82c00a82c09, 0x0000a8c400a8c409, 0x0000a8e000a8f1e6, 0x0000a92b00a92ddc,
+    0x0000a95300a95309, 0x0000a9b300a9b307, 0x0000a9c000a9c009, 0x0000aab000aab0e6,
+    0x0000aab200aab3e6, 0x0000aab400aab4dc, 0x0000aab700aab8e6, 0x0000aabe00aabfe6,
+    0x0000aac100aac1e6, 0x0000aaf600aaf609, 0x0000abed00abed09, 0x0000fb1e00fb1e1a,
+    0x0000fe2000fe26e6, 0x0000fe2700fe2ddc, 0x0000fe2e00fe2fe6, 0x000101fd0101fddc,
+    0x000102e00102e0dc, 0x0001037601037ae6, 0x00010a0d010a0ddc, 0x00010a0f010a0fe6,
+    0x00010a38010a38e6, 0x00010a39010a3901, 0x00010a3a010a3adc, 0x00010a3f010a3f09,
+    0x00010ae5010ae5e6, 0x00010ae6010ae6dc, 0x00010d24010d27e6, 0x00010eab010eace6,
+    0x00010f46010f47dc, 0x00010f48010f4ae6, 0x00010f4b010f4bdc, 0x00010f4c010f4ce6,
+    0x00010f4d010f50dc, 0x00010f82010f82e6, 0x00010f83010f83dc, 0x00010f84010f84e6,
+    0x00010f85010f85dc, 0x0001104601104609, 0x0001107001107009, 0x0001107f01107f09,
+    0x000110b90110b909, 0x000110ba0110ba07, 0x00011100011102e6, 0x0001113301113409,
+    0x0001117301117307, 0x000111c00111c009, 0x000111ca0111ca07, 0x0001123501123509,
+    0x0001123601123607, 0x000112e90112e907, 0x000112ea0112ea09, 0x0001133b01133c07,
+    0x0001134d01134d09, 0x0001136601136ce6, 0x00011370011374e6, 0x0001144201144209,
+    0x0001144601144607, 0x0001145e01145ee6, 0x000114c20114c209, 0x000114c30114c307,
+    0x000115bf0115bf09, 0x000115c00115c007, 0x0001163f01163f09, 0x000116b60116b609,
+    0x000116b70116b707, 0x0001172b01172b09, 0x0001183901183909, 0x0001183a01183a07,
+    0x0001193d01193e09, 0x0001194301194307, 0x000119e00119e009, 0x00011a34011a3409,
+    0x00011a47011a4709, 0x00011a99011a9909, 0x00011c3f011c3f09, 0x00011d42011d4207,
+    0x00011d44011d4509, 0x00011d97011d9709, 0x00016af0016af401, 0x00016b30016b36e6,
+    0x00016ff0016ff106, 0x0001bc9e01bc9e01, 0x0001d16501d166d8, 0x0001d16701d16901,
+    0x0001d16d01d16de2, 0x0001d16e01d172d8, 0x0001d17b01d182dc, 0x0001d18501d189e6,
+    0x0001d18a01d18bdc, 0x0001d1aa01d1ade6, 0x0001d24201d244e6, 0x0001e00001e006e6,
+    0x0001e00801e018e6, 0x0001e01b01e021e6, 0x0001e02301e024e6, 0x0001e02601e02ae6,
+    0x0001e13001e136e6, 0x0001e2ae01e2aee6, 0x0001e2ec01e2efe6, 0x0001e8d001e8d6dc,
+    0x0001e94401e949e6, 0x0001e94a01e94a07,
+};
+
+// code << 42 | first << 21 | second (0 for singleton decompositions)
+inline constexpr std::uint64_t decompositions[] = {
+    0x0003000008200300, 0x0003040008200301, 0x0003080008200302, 0x00030c0008200303,
+    0x0003100008200308, 0x000314000820030a, 0x00031c0008600327, 0x0003200008a00300,
+    0x0003240008a00301, 0x0003280008a00302, 0x00032c0008a00308, 0x0003300009200300,
+    0x0003340009200301, 0x0003380009200302, 0x00033c0009200308, 0x0003440009c00303,
+    0x0003480009e00300, 0x00034c0009e00301, 0x0003500009e00302, 0x0003540009e00303,
+    0x0003580009e00308, 0x000364000aa00300, 0x000368000aa00301, 0x00036c000aa00302,
+    0x000370000aa00308, 0x000374000b200301, 0x000380000c200300, 0x000384000c200301,
+    0x000388000c200302, 0x00038c000c200303, 0x000390000c200308, 0x000394000c20030a,
+    0x00039c000c600327, 0x0003a0000ca00300, 0x0003a4000ca00301, 0x0003a8000ca00302,
+    0x0003ac000ca00308, 0x0003b0000d200300, 0x0003b4000d200301, 0x0003b8000d200302,
+    0x0003bc000d200308, 0x0003c4000dc00303, 0x0003c8000de00300, 0x0003cc000de00301,
+    0x0003d0000de00302, 0x0003d4000de00303, 0x0003d8000de00308, 0x0003e4000ea00300,
+    0x0003e8000ea00301, 0x0003ec000ea00302, 0x0003f0000ea00308, 0x0003f4000f200301,
+    0x0003fc000f200308, 0x0004000008200304, 0x000404000c200304, 0x0004080008200306,
+    0x00040c000c200306, 0x0004100008200328, 0x000414000c200328, 0x0004180008600301,
+    0x00041c000c600301, 0x0004200008600302, 0x000424000c600302, 0x0004280008600307,
+    0x00042c000c600307, 0x000430000860030c, 0x000434000c60030c, 0x000438000880030c,
+    0x00043c000c80030c, 0x0004480008a00304, 0x00044c000ca00304, 0x0004500008a00306,
+    0x000454000ca00306, 0x0004580008a00307, 0x00045c000ca00307, 0x0004600008a00328,
+    0x000464000ca00328, 0x0004680008a0030c, 0x00046c000ca0030c, 0x0004700008e00302,
+    0x000474000ce00302, 0x0004780008e00306, 0x00047c000ce00306, 0x0004800008e00307,
+    0x000484000ce00307, 0x0004880008e00327, 0x00048c000ce00327, 0x0004900009000302,
+    0x000494000d000302, 0x0004a00009200303, 0x0004a4000d200303, 0x0004a80009200304,
+    0x0004ac000d200304, 0x0004b00009200306, 0x0004b4000d200306, 0x0004b80009200328,
+    0x0004bc000d200328, 0x0004c00009200307, 0x0004d00009400302, 0x0004d4000d400302,
+    0x0004d80009600327, 0x0004dc000d600327, 0x0004e40009800301, 0x0004e8000d800301,
+    0x0004ec0009800327, 0x0004f0000d800327, 0x0004f4000980030c, 0x0004f8000d80030c,
+    0x00050c0009c00301, 0x000510000dc00301, 0x0005140009c00327, 0x000518000dc00327,
+    0x00051c0009c0030c, 0x000520000dc0030c, 0x0005300009e00304, 0x000534000de00304,
+    0x0005380009e00306, 0x00053c000de00306, 0x0005400009e0030b, 0x000544000de0030b,
+    0x000550000a400301, 0x000554000e400301, 0x000558000a400327, 0x00055c000e400327,
+    0x000560000a40030c, 0x000564000e40030c, 0x000568000a600301, 0x00056c000e600301,
+    0x000570000a600302, 0x000574000e600302, 0x000578000a600327, 0x00057c000e600327,
+    0x000580000a60030c, 0x000584000e60030c, 0x000588000a800327, 0x00058c000e800327,
+    0x000590000a80030c, 0x000594000e80030c, 0x0005a0000aa00303, 0x0005a4000ea00303,
+    0x0005a8000aa00304, 0x0005ac000ea00304, 0x0005b0000aa00306, 0x0005b4000ea00306,
+    0x0005b8000aa0030a, 0x0005bc000ea0030a, 0x0005c0000aa0030b, 0x0005c4000ea0030b,
+    0x0005c8000aa00328, 0x0005cc000ea00328, 0x0005d0000ae00302, 0x0005d4000ee00302,
+    0x0005d8000b200302, 0x0005dc000f200302, 0x0005e0000b200308, 0x0005e4000b400301,
+    0x0005e8000f400301, 0x0005ec000b400307, 0x0005f0000f400307, 0x0005f4000b40030c,
+    0x0005f8000f40030c, 0x0006800009e0031b, 0x000684000de0031b, 0x0006bc000aa0031b,
+    0x0006c0000ea0031b, 0x000734000820030c, 0x000738000c20030c, 0x00073c000920030c,
+    0x000740000d20030c, 0x0007440009e0030c, 0x000748000de0030c, 0x00074c000aa0030c,
+    0x000750000ea0030c, 0x000754001b800304, 0x000758001f800304, 0x00075c001b800301,
+    0x000760001f800301, 0x000764001b80030c, 0x000768001f80030c, 0x00076c001b800300,
+    0x000770001f800300, 0x0007780018800304, 0x00077c001c800304, 0x0007800044c00304,
+    0x0007840044e00304, 0x0007880018c00304, 0x00078c001cc00304, 0x0007980008e0030c,
+    0x00079c000ce0030c, 0x0007a0000960030c, 0x0007a4000d60030c, 0x0007a80009e00328,
+    0x0007ac000de00328, 0x0007b0003d400304, 0x0007b4003d600304, 0x0007b80036e0030c,
+    0x0007bc005240030c, 0x0007c0000d40030c, 0x0007d00008e00301, 0x0007d4000ce00301,
+    0x0007e00009c00300, 0x0007e4000dc00300, 0x0007e80018a00301, 0x0007ec001ca00301,
+    0x0007f00018c00301, 0x0007f4001cc00301, 0x0007f8001b000301, 0x0007fc001f000301,
+    0x000800000820030f, 0x000804000c20030f, 0x0008080008200311, 0x00080c000c200311,
+    0x0008100008a0030f, 0x000814000ca0030f, 0x0008180008a00311, 0x00081c000ca00311,
+    0x000820000920030f, 0x000824000d20030f, 0x0008280009200311, 0x00082c000d200311,
+    0x0008300009e0030f, 0x000834000de0030f, 0x0008380009e00311, 0x00083c000de00311,
+    0x000840000a40030f, 0x000844000e40030f, 0x000848000a400311, 0x00084c000e400311,
+    0x000850000aa0030f, 0x000854000ea0030f, 0x000858000aa00311, 0x00085c000ea00311,
+    0x000860000a600326, 0x000864000e600326, 0x000868000a800326, 0x00086c000e800326,
+    0x000878000900030c, 0x00087c000d00030c, 0x0008980008200307, 0x00089c000c200307,
+    0x0008a00008a00327, 0x0008a4000ca00327, 0x0008a8001ac00304, 0x0008ac001ec00304,
+    0x0008b0001aa00304, 0x0008b4001ea00304, 0x0008b80009e00307, 0x0008bc000de00307,
+    0x0008c00045c00304, 0x0008c40045e00304, 0x0008c8000b200304, 0x0008cc000f200304,
+    0x000d000060000000, 0x000d040060200000, 0x000d0c0062600000, 0x000d100061000301,
+    0x000dd00057200000, 0x000df80007600000, 0x000e140015000301, 0x000e180072200301,
+    0x000e1c0016e00000, 0x000e200072a00301, 0x000e240072e00301, 0x000e280073200301,
+    0x000e300073e00301, 0x000e380074a00301, 0x000e3c0075200301, 0x000e400079400301,
+    0x000ea80073200308, 0x000eac0074a00308, 0x000eb00076200301, 0x000eb40076a00301,
+    0x000eb80076e00301, 0x000ebc0077200301, 0x000ec00079600301, 0x000f280077200308,
+    0x000f2c0078a00308, 0x000f300077e00301, 0x000f340078a00301, 0x000f380079200301,
+    0x000f4c007a400301, 0x000f50007a400308, 0x0010000082a00300, 0x0010040082a00308,
+    0x00100c0082600301, 0x00101c0080c00308, 0x0010300083400301, 0x0010340083000300,
+    0x0010380084600306, 0x0010640083000306, 0x0010e40087000306, 0x0011400086a00300,
+    0x0011440086a00308, 0x00114c0086600301, 0x00115c008ac00308, 0x0011700087400301,
+    0x0011740087000300, 0x0011780088600306, 0x0011d8008e80030f, 0x0011dc008ea0030f,
+    0x0013040082c00306, 0x0013080086c00306, 0x0013400082000306, 0x0013440086000306,
+    0x0013480082000308, 0x00134c0086000308, 0x0013580082a00306, 0x00135c0086a00306,
+    0x001368009b000308, 0x00136c009b200308, 0x0013700082c00308, 0x0013740086c00308,
+    0x0013780082e00308, 0x00137c0086e00308, 0x0013880083000304, 0x00138c0087000304,
+    0x0013900083000308, 0x0013940087000308, 0x0013980083c00308, 0x00139c0087c00308,
+    0x0013a8009d000308, 0x0013ac009d200308, 0x0013b00085a00308, 0x0013b40089a00308,
+    0x0013b80084600304, 0x0013bc0088600304, 0x0013c00084600308, 0x0013c40088600308,
+    0x0013c8008460030b, 0x0013cc008860030b, 0x0013d00084e00308, 0x0013d40088e00308,
+    0x0013e00085600308, 0x0013e40089600308, 0x00188800c4e00653, 0x00188c00c4e00654,
+    0x00189000c9000654, 0x00189400c4e00655, 0x00189800c9400654, 0x001b0000daa00654,
+    0x001b0800d8200654, 0x001b4c00da400654, 0x0024a4012500093c, 0x0024c4012600093c,
+    0x0024d0012660093c, 0x0025600122a0093c, 0x0025640122c0093c, 0x0025680122e0093c,
+    0x00256c012380093c, 0x002570012420093c, 0x002574012440093c, 0x002578012560093c,
+    0x00257c0125e0093c, 0x00272c0138e009be, 0x0027300138e009d7, 0x00277001342009bc,
+    0x00277401344009bc, 0x00277c0135e009bc, 0x0028cc0146400a3c, 0x0028d80147000a3c,
+    0x0029640142c00a3c, 0x0029680142e00a3c, 0x00296c0143800a3c, 0x0029780145600a3c,
+    0x002d200168e00b56, 0x002d2c0168e00b3e, 0x002d300168e00b57, 0x002d700164200b3c,
+    0x002d740164400b3c, 0x002e500172400bd7, 0x002f280178c00bbe, 0x002f2c0178e00bbe,
+    0x002f300178c00bd7, 0x0031200188c00c56, 0x0033000197e00cd5, 0x00331c0198c00cd5,
+    0x0033200198c00cd6, 0x0033280198c00cc2, 0x00332c0199400cd5, 0x00352801a8c00d3e,
+    0x00352c01a8e00d3e, 0x00353001a8c00d57, 0x00376801bb200dca, 0x00377001bb200dcf,
+    0x00377401bb800dca, 0x00377801bb200ddf, 0x003d0c01e8400fb7, 0x003d3401e9800fb7,
+    0x003d4801ea200fb7, 0x003d5c01eac00fb7, 0x003d7001eb600fb7, 0x003da401e8000fb5,
+    0x003dcc01ee200f72, 0x003dd401ee200f74, 0x003dd801f6400f80, 0x003de001f6600f80,
+    0x003e0401ee200f80, 0x003e4c01f2400fb7, 0x003e7401f3800fb7, 0x003e8801f4200fb7,
+    0x003e9c01f4c00fb7, 0x003eb001f5600fb7, 0x003ee401f2000fb5, 0x0040980204a0102e,
+    0x006c180360a01b35, 0x006c200360e01b35, 0x006c280361201b35, 0x006c300361601b35,
+    0x006c380361a01b35, 0x006c480362201b35, 0x006cec0367401b35, 0x006cf40367801b35,
+    0x006d000367c01b35, 0x006d040367e01b35, 0x006d0c0368401b35, 0x0078000008200325,
+    0x007804000c200325, 0x0078080008400307, 0x00780c000c400307, 0x0078100008400323,
+    0x007814000c400323, 0x0078180008400331, 0x00781c000c400331, 0x0078200018e00301,
+    0x007824001ce00301, 0x0078280008800307, 0x00782c000c800307, 0x0078300008800323,
+    0x007834000c800323, 0x0078380008800331, 0x00783c000c800331, 0x0078400008800327,
+    0x007844000c800327, 0x007848000880032d, 0x00784c000c80032d, 0x0078500022400300,
+    0x0078540022600300, 0x0078580022400301, 0x00785c0022600301, 0x0078600008a0032d,
+    0x007864000ca0032d, 0x0078680008a00330, 0x00786c000ca00330, 0x0078700045000306,
+    0x0078740045200306, 0x0078780008c00307, 0x00787c000cc00307, 0x0078800008e00304,
+    0x007884000ce00304, 0x0078880009000307, 0x00788c000d000307, 0x0078900009000323,
+    0x007894000d000323, 0x0078980009000308, 0x00789c000d000308, 0x0078a00009000327,
+    0x0078a4000d000327, 0x0078a8000900032e, 0x0078ac000d00032e, 0x0078b00009200330,
+    0x0078b4000d200330, 0x0078b80019e00301, 0x0078bc001de00301, 0x0078c00009600301,
+    0x0078c4000d600301, 0x0078c80009600323, 0x0078cc000d600323, 0x0078d00009600331,
+    0x0078d4000d600331, 0x0078d80009800323, 0x0078dc000d800323, 0x0078e003c6c00304,
+    0x0078e403c6e00304, 0x0078e80009800331, 0x0078ec000d800331, 0x0078f0000980032d,
+    0x0078f4000d80032d, 0x0078f80009a00301, 0x0078fc000da00301, 0x0079000009a00307,
+    0x007904000da00307, 0x0079080009a00323, 0x00790c000da00323, 0x0079100009c00307,
+    0x007914000dc00307, 0x0079180009c00323, 0x00791c000dc00323, 0x0079200009c00331,
+    0x007924000dc00331, 0x0079280009c0032d, 0x00792c000dc0032d, 0x007930001aa00301,
+    0x007934001ea00301, 0x007938001aa00308, 0x00793c001ea00308, 0x0079400029800300,
+    0x0079440029a00300, 0x0079480029800301, 0x00794c0029a00301, 0x007950000a000301,
+    0x007954000e000301, 0x007958000a000307, 0x00795c000e000307, 0x007960000a400307,
+    0x007964000e400307, 0x007968000a400323, 0x00796c000e400323, 0x00797003cb400304,
+    0x00797403cb600304, 0x007978000a400331, 0x00797c000e400331, 0x007980000a600307,
+    0x007984000e600307, 0x007988000a600323, 0x00798c000e600323, 0x007990002b400307,
+    0x007994002b600307, 0x007998002c000307, 0x00799c002c200307, 0x0079a003cc400307,
+    0x0079a403cc600307, 0x0079a8000a800307, 0x0079ac000e800307, 0x0079b0000a800323,
+    0x0079b4000e800323, 0x0079b8000a800331, 0x0079bc000e800331, 0x0079c0000a80032d,
+    0x0079c4000e80032d, 0x0079c8000aa00324, 0x0079cc000ea00324, 0x0079d0000aa00330,
+    0x0079d4000ea00330, 0x0079d8000aa0032d, 0x0079dc000ea0032d, 0x0079e0002d000301,
+    0x0079e4002d200301, 0x0079e8002d400308, 0x0079ec002d600308, 0x0079f0000ac00303,
+    0x0079f4000ec00303, 0x0079f8000ac00323, 0x0079fc000ec00323, 0x007a00000ae00300,
+    0x007a04000ee00300, 0x007a08000ae00301, 0x007a0c000ee00301, 0x007a10000ae00308,
+    0x007a14000ee00308, 0x007a18000ae00307, 0x007a1c000ee00307, 0x007a20000ae00323,
+    0x007a24000ee00323, 0x007a28000b000307, 0x007a2c000f000307, 0x007a30000b000308,
+    0x007a34000f000308, 0x007a38000b200307, 0x007a3c000f200307, 0x007a40000b400302,
+    0x007a44000f400302, 0x007a48000b400323, 0x007a4c000f400323, 0x007a50000b400331,
+    0x007a54000f400331, 0x007a58000d000331, 0x007a5c000e800308, 0x007a60000ee0030a,
+    0x007a64000f20030a, 0x007a6c002fe00307, 0x007a800008200323, 0x007a84000c200323,
+    0x007a880008200309, 0x007a8c000c200309, 0x007a900018400301, 0x007a94001c400301,
+    0x007a980018400300, 0x007a9c001c400300, 0x007aa00018400309, 0x007aa4001c400309,
+    0x007aa80018400303, 0x007aac001c400303, 0x007ab003d4000302, 0x007ab403d4200302,
+    0x007ab80020400301, 0x007abc0020600301, 0x007ac00020400300, 0x007ac40020600300,
+    0x007ac80020400309, 0x007acc0020600309, 0x007ad00020400303, 0x007ad40020600303,
+    0x007ad803d4000306, 0x007adc03d4200306, 0x007ae00008a00323, 0x007ae4000ca00323,
+    0x007ae80008a00309, 0x007aec000ca00309, 0x007af00008a00303, 0x007af4000ca00303,
+    0x007af80019400301, 0x007afc001d400301, 0x007b000019400300, 0x007b04001d400300,
+    0x007b080019400309, 0x007b0c001d400309, 0x007b100019400303, 0x007b14001d400303,
+    0x007b1803d7000302, 0x007b1c03d7200302, 0x007b200009200309, 0x007b24000d200309,
+    0x007b280009200323, 0x007b2c000d200323, 0x007b300009e00323, 0x007b34000de00323,
+    0x007b380009e00309, 0x007b3c000de00309, 0x007b40001a800301, 0x007b44001e800301,
+    0x007b48001a800300, 0x007b4c001e800300, 0x007b50001a800309, 0x007b54001e800309,
+    0x007b58001a800303, 0x007b5c001e800303, 0x007b6003d9800302, 0x007b6403d9a00302,
+    0x007b680034000301, 0x007b6c0034200301, 0x007b700034000300, 0x007b740034200300,
+    0x007b780034000309, 0x007b7c0034200309, 0x007b800034000303, 0x007b840034200303,
+    0x007b880034000323, 0x007b8c0034200323, 0x007b90000aa00323, 0x007b94000ea00323,
+    0x007b98000aa00309, 0x007b9c000ea00309, 0x007ba00035e00301, 0x007ba40036000301,
+    0x007ba80035e00300, 0x007bac0036000300, 0x007bb00035e00309, 0x007bb40036000309,
+    0x007bb80035e00303, 0x007bbc0036000303, 0x007bc00035e00323, 0x007bc40036000323,
+    0x007bc8000b200300, 0x007bcc000f200300, 0x007bd0000b200323, 0x007bd4000f200323,
+    0x007bd8000b200309, 0x007bdc000f200309, 0x007be0000b200303, 0x007be4000f200303,
+    0x007c000076200313, 0x007c040076200314, 0x007c0803e0000300, 0x007c0c03e0200300,
+    0x007c1003e0000301, 0x007c1403e0200301, 0x007c1803e0000342, 0x007c1c03e0200342,
+    0x007c200072200313, 0x007c240072200314, 0x007c2803e1000300, 0x007c2c03e1200300,
+    0x007c3003e1000301, 0x007c3403e1200301, 0x007c3803e1000342, 0x007c3c03e1200342,
+    0x007c400076a00313, 0x007c440076a00314, 0x007c4803e2000300, 0x007c4c03e2200300,
+    0x007c5003e2000301, 0x007c5403e2200301, 0x007c600072a00313, 0x007c640072a00314,
+    0x007c6803e3000300, 0x007c6c03e3200300, 0x007c7003e3000301, 0x007c7403e3200301,
+    0x007c800076e00313, 0x007c840076e00314, 0x007c8803e4000300, 0x007c8c03e4200300,
+    0x007c9003e4000301, 0x007c9403e4200301, 0x007c9803e4000342, 0x007c9c03e4200342,
+    0x007ca00072e00313, 0x007ca40072e00314, 0x007ca803e5000300, 0x007cac03e5200300,
+    0x007cb003e5000301, 0x007cb403e5200301, 0x007cb803e5000342, 0x007cbc03e5200342,
+    0x007cc00077200313, 0x007cc40077200314, 0x007cc803e6000300, 0x007ccc03e6200300,
+    0x007cd003e6000301, 0x007cd403e6200301, 0x007cd803e6000342, 0x007cdc03e6200342,
+    0x007ce00073200313, 0x007ce40073200314, 0x007ce803e7000300, 0x007cec03e7200300,
+    0x007cf003e7000301, 0x007cf403e7200301, 0x007cf803e7000342, 0x007cfc03e7200342,
+    0x007d000077e00313, 0x007d040077e00314, 0x007d0803e8000300, 0x007d0c03e8200300,
+    0x007d1003e8000301, 0x007d1403e8200301, 0x007d200073e00313, 0x007d240073e00314,
+    0x007d2803e9000300, 0x007d2c03e9200300, 0x007d3003e9000301, 0x007d3403e9200301,
+    0x007d400078a00313, 0x007d440078a00314, 0x007d4803ea000300, 0x007d4c03ea200300,
+    0x007d5003ea000301, 0x007d5403ea200301, 0x007d5803ea000342, 0x007d5c03ea200342,
+    0x007d640074a00314, 0x007d6c03eb200300, 0x007d7403eb200301, 0x007d7c03eb200342,
+    0x007d800079200313, 0x007d840079200314, 0x007d8803ec000300, 0x007d8c03ec200300,
+    0x007d9003ec000301, 0x007d9403ec200301, 0x007d9803ec000342, 0x007d9c03ec200342,
+    0x007da00075200313, 0x007da40075200314, 0x007da803ed000300, 0x007dac03ed200300,
+    0x007db003ed000301, 0x007db403ed200301, 0x007db803ed000342, 0x007dbc03ed200342,
+    0x007dc00076200300, 0x007dc40075800000, 0x007dc80076a00300, 0x007dcc0075a00000,
+    0x007dd00076e00300, 0x007dd40075c00000, 0x007dd80077200300, 0x007ddc0075e00000,
+    0x007de00077e00300, 0x007de40079800000, 0x007de80078a00300, 0x007dec0079a00000,
+    0x007df00079200300, 0x007df40079c00000, 0x007e0003e0000345, 0x007e0403e0200345,
+    0x007e0803e0400345, 0x007e0c03e0600345, 0x007e1003e0800345, 0x007e1403e0a00345,
+    0x007e1803e0c00345, 0x007e1c03e0e00345, 0x007e2003e1000345, 0x007e2403e1200345,
+    0x007e2803e1400345, 0x007e2c03e1600345, 0x007e3003e1800345, 0x007e3403e1a00345,
+    0x007e3803e1c00345, 0x007e3c03e1e00345, 0x007e4003e4000345, 0x007e4403e4200345,
+    0x007e4803e4400345, 0x007e4c03e4600345, 0x007e5003e4800345, 0x007e5403e4a00345,
+    0x007e5803e4c00345, 0x007e5c03e4e00345, 0x007e6003e5000345, 0x007e6403e5200345,
+    0x007e6803e5400345, 0x007e6c03e5600345, 0x007e7003e5800345, 0x007e7403e5a00345,
+    0x007e7803e5c00345, 0x007e7c03e5e00345, 0x007e8003ec000345, 0x007e8403ec200345,
+    0x007e8803ec400345, 0x007e8c03ec600345, 0x007e9003ec800345, 0x007e9403eca00345,
+    0x007e9803ecc00345, 0x007e9c03ece00345, 0x007ea003ed000345, 0x007ea403ed200345,
+    0x007ea803ed400345, 0x007eac03ed600345, 0x007eb003ed800345, 0x007eb403eda00345,
+    0x007eb803edc00345, 0x007ebc03ede00345, 0x007ec00076200306, 0x007ec40076200304,
+    0x007ec803ee000345, 0x007ecc0076200345, 0x007ed00075800345, 0x007ed80076200342,
+    0x007edc03f6c00345, 0x007ee00072200306, 0x007ee40072200304, 0x007ee80072200300,
+    0x007eec0070c00000, 0x007ef00072200345, 0x007ef80077200000, 0x007f040015000342,
+    0x007f0803ee800345, 0x007f0c0076e00345, 0x007f100075c00345, 0x007f180076e00342,
+    0x007f1c03f8c00345, 0x007f200072a00300, 0x007f240071000000, 0x007f280072e00300,
+    0x007f2c0071200000, 0x007f300072e00345, 0x007f3403f7e00300, 0x007f3803f7e00301,
+    0x007f3c03f7e00342, 0x007f400077200306, 0x007f440077200304, 0x007f480079400300,
+    0x007f4c0072000000, 0x007f580077200342, 0x007f5c0079400342, 0x007f600073200306,
+    0x007f640073200304, 0x007f680073200300, 0x007f6c0071400000, 0x007f7403ffc00300,
+    0x007f7803ffc00301, 0x007f7c03ffc00342, 0x007f800078a00306, 0x007f840078a00304,
+    0x007f880079600300, 0x007f8c0076000000, 0x007f900078200313, 0x007f940078200314,
+    0x007f980078a00342, 0x007f9c0079600342, 0x007fa00074a00306, 0x007fa40074a00304,
+    0x007fa80074a00300, 0x007fac0071c00000, 0x007fb00074200314, 0x007fb40015000300,
+    0x007fb80070a00000, 0x007fbc000c000000, 0x007fc803ef800345, 0x007fcc0079200345,
+    0x007fd00079c00345, 0x007fd80079200342, 0x007fdc03fec00345, 0x007fe00073e00300,
+    0x007fe40071800000, 0x007fe80075200300, 0x007fec0071e00000, 0x007ff00075200345,
+    0x007ff40016800000, 0x0080000400400000, 0x0080040400600000, 0x0084980075200000,
+    0x0084a80009600000, 0x0084ac0018a00000, 0x0086680432000338, 0x00866c0432400338,
+    0x0086b80432800338, 0x008734043a000338, 0x008738043a800338, 0x00873c043a400338,
+    0x0088100440600338, 0x0088240441000338, 0x0088300441600338, 0x0088900444600338,
+    0x0088980444a00338, 0x0089040447800338, 0x0089100448600338, 0x00891c0448a00338,
+    0x0089240449000338, 0x0089800007a00338, 0x008988044c200338, 0x0089b40449a00338,
+    0x0089b80007800338, 0x0089bc0007c00338, 0x0089c0044c800338, 0x0089c4044ca00338,
+    0x0089d0044e400338, 0x0089d4044e600338, 0x0089e0044ec00338, 0x0089e4044ee00338,
+    0x008a00044f400338, 0x008a04044f600338, 0x008a100450400338, 0x008a140450600338,
+    0x008a200450c00338, 0x008a240450e00338, 0x008ab00454400338, 0x008ab40455000338,
+    0x008ab80455200338, 0x008abc0455600338, 0x008b80044f800338, 0x008b84044fa00338,
+    0x008b880452200338, 0x008b8c0452400338, 0x008ba80456400338, 0x008bac0456600338,
+    0x008bb00456800338, 0x008bb40456a00338, 0x008ca40601000000, 0x008ca80601200000,
+    0x00ab70055ba00338, 0x00c1300609603099, 0x00c1380609a03099, 0x00c1400609e03099,
+    0x00c148060a203099, 0x00c150060a603099, 0x00c158060aa03099, 0x00c160060ae03099,
+    0x00c168060b203099, 0x00c170060b603099, 0x00c178060ba03099, 0x00c180060be03099,
+    0x00c188060c203099, 0x00c194060c803099, 0x00c19c060cc03099, 0x00c1a4060d003099,
+    0x00c1c0060de03099, 0x00c1c4060de0309a, 0x00c1cc060e403099, 0x00c1d0060e40309a,
+    0x00c1d8060ea03099, 0x00c1dc060ea0309a, 0x00c1e4060f003099, 0x00c1e8060f00309a,
+    0x00c1f0060f603099, 0x00c1f4060f60309a, 0x00c2500608c03099, 0x00c2780613a03099,
+    0x00c2b00615603099, 0x00c2b80615a03099, 0x00c2c00615e03099, 0x00c2c80616203099,
+    0x00c2d00616603099, 0x00c2d80616a03099, 0x00c2e00616e03099, 0x00c2e80617203099,
+    0x00c2f00617603099, 0x00c2f80617a03099, 0x00c3000617e03099, 0x00c3080618203099,
+    0x00c3140618803099, 0x00c31c0618c03099, 0x00c3240619003099, 0x00c3400619e03099,
+    0x00c3440619e0309a, 0x00c34c061a403099, 0x00c350061a40309a, 0x00c358061aa03099,
+    0x00c35c061aa0309a, 0x00c364061b003099, 0x00c368061b00309a, 0x00c370061b603099,
+    0x00c374061b60309a, 0x00c3d00614c03099, 0x00c3dc061de03099, 0x00c3e0061e003099,
+    0x00c3e4061e203099, 0x00c3e8061e403099, 0x00c3f8061fa03099, 0x03e4001189000000,
+    0x03e4040cde800000, 0x03e40811d9400000, 0x03e40c1199000000, 0x03e4100dda200000,
+    0x03e41409c6400000, 0x03e4180a7ca00000, 0x03e41c13f3800000, 0x03e42013f3800000,
+    0x03e4240b2a200000, 0x03e428123a200000, 0x03e42c0ab0e00000, 0x03e4300b29000000,
+    0x03e4340c3ec00000, 0x03e4380ecd200000, 0x03e43c0ff0a00000, 0x03e44010c7e00000,
+    0x03e44410f7400000, 0x03e448111f000000, 0x03e44c1211e00000, 0x03e4500d40400000,
+    0x03e4540da3600000, 0x03e4580e1b200000, 0x03e45c0e7bc00000, 0x03e4601087a00000,
+    0x03e464122d400000, 0x03e468133e200000, 0x03e46c09d0400000, 0x03e4700a6ea00000,
+    0x03e4740d60800000, 0x03e4780e43600000, 0x03e47c10c5a00000, 0x03e48013c3c00000,
+    0x03e4840baa000000, 0x03e4880dfd600000, 0x03e48c10b9a00000, 0x03e490112c800000,
+    0x03e4940c59200000, 0x03e498103b000000, 0x03e49c1103e00000, 0x03e4a00bd9400000,
+    0x03e4a40ce2e00000, 0x03e4a80dad400000, 0x03e4ac0e5f800000, 0x03e4b01219c00000,
+    0x03e4b409f0c00000, 0x03e4b80a36e00000, 0x03e4bc0a5bc00000, 0x03e4c00c98800000,
+    0x03e4c40d5a600000, 0x03e4c80e42000000, 0x03e4cc0edce00000, 0x03e4d01000200000,
+    0x03e4d410c0c00000, 0x03e4d810cb800000, 0x03e4dc11bde00000, 0x03e4e012e6400000,
+    0x03e4e4136de00000, 0x03e4e813bf400000, 0x03e4ec0f11800000, 0x03e4f00f2fe00000,
+    0x03e4f40fb4000000, 0x03e4f81079200000, 0x03e4fc1260800000, 0x03e50013cfe00000,
+    0x03e504115ac00000, 0x03e5080b1be00000, 0x03e50c0be0800000, 0x03e5100f8c000000,
+    0x03e514100fc00000, 0x03e5180e4c400000, 0x03e51c0f19400000, 0x03e5201198400000,
+    0x03e52412dee00000, 0x03e5280b1b000000, 0x03e52c0b8c400000, 0x03e5300d42600000,
+    0x03e5340dbb400000, 0x03e5380de1e00000, 0x03e53c0fa5e00000, 0x03e5400fc6e00000,
+    0x03e54412c9600000, 0x03e5480a5a400000, 0x03e54c1011600000, 0x03e5500a3b800000,
+    0x03e5540a39800000, 0x03e5580f43800000, 0x03e55c0fb7c00000, 0x03e560107e200000,
+    0x03e56412cea00000, 0x03e5681170000000, 0x03e56c0c59e00000, 0x03e5700d40400000,
+    0x03e574115fc00000, 0x03e57809c7200000, 0x03e57c0b7ce00000, 0x03e5800c02400000,
+    0x03e5840e70e00000, 0x03e5880eae000000, 0x03e58c0a62e00000, 0x03e5900f1f600000,
+    0x03e59409f7e00000, 0x03e5980bf5200000, 0x03e59c09c1a00000, 0x03e5a00d99800000,
+    0x03e5a40caf000000, 0x03e5a80fa4400000, 0x03e5ac0a78600000, 0x03e5b00b0bc00000,
+    0x03e5b40ee0200000, 0x03e5b81089200000, 0x03e5bc1155400000, 0x03e5c00d77400000,
+    0x03e5c411f6000000, 0x03e5c80d91000000, 0x03e5cc0c5fc00000, 0x03e5d0105ca00000,
+    0x03e5d40c74000000, 0x03e5d80eaca00000, 0x03e5dc09d5c00000, 0x03e5e00a2d200000,
+    0x03e5e40a39200000, 0x03e5e80d10200000, 0x03e5ec0f9ce00000, 0x03e5f0104de00000,
+    0x03e5f4115a400000, 0x03e5f81239e00000, 0x03e5fc0a5ea00000, 0x03e6000a88400000,
+    0x03e6040b2e600000, 0x03e6080bdd800000, 0x03e60c0cb8a00000, 0x03e6100dffc00000,
+    0x03e6140f25400000, 0x03e61812b5a00000, 0x03e61c134d400000, 0x03e62013d2e00000,
+    0x03e62413d9c00000, 0x03e6280a53600000, 0x03e62c0cd8c00000, 0x03e6300d6ee00000,
+    0x03e63411ec400000, 0x03e6380bce800000, 0x03e63c0c32000000, 0x03e6400c40000000,
+    0x03e6440c93400000, 0x03e6480de4600000, 0x03e64c0e29200000, 0x03e6500e91200000,
+    0x03e6540f39400000, 0x03e6580fbe800000, 0x03e65c100de00000, 0x03e66011e4c00000,
+    0x03e664109dc00000, 0x03e6681204600000, 0x03e66c1269400000, 0x03e6700a42e00000,
+    0x03e6740a54600000, 0x03e6780a97a00000, 0x03e67c0e19000000, 0x03e6801118400000,
+    0x03e6841155400000, 0x03e6880bd9200000, 0x03e68c0bfea00000, 0x03e6900c6f600000,
+    0x03e6940d75c00000, 0x03e6980f87c00000, 0x03e69c0e6ea00000, 0x03e6a009dc800000,
+    0x03e6a40adf200000, 0x03e6a80b7ce00000, 0x03e6ac0bb7400000, 0x03e6b00c03800000,
+    0x03e6b40e76400000, 0x03e6b80e8d200000, 0x03e6bc0ff3400000, 0x03e6c01008c00000,
+    0x03e6c41246800000, 0x03e6c812dec00000, 0x03e6cc12e9000000, 0x03e6d01303000000,
+    0x03e6d409f1600000, 0x03e6d80f35c00000, 0x03e6dc1236800000, 0x03e6e012d7000000,
+    0x03e6e40c1c200000, 0x03e6e809d0c00000, 0x03e6ec0a1b400000, 0x03e6f00b7dc00000,
+    0x03e6f40b87e00000, 0x03e6f80cb3200000, 0x03e6fc0d40400000, 0x03e7000e39c00000,
+    0x03e7040ec8400000, 0x03e708109f800000, 0x03e70c120f800000, 0x03e71013f1a00000,
+    0x03e7140cd1000000, 0x03e71812c5c00000, 0x03e71c0a51200000, 0x03e7200cef600000,
+    0x03e7240cfe600000, 0x03e7280da8200000, 0x03e72c0dd3800000, 0x03e7300e81200000,
+    0x03e7340eab200000, 0x03e7380f0d600000, 0x03e73c0fa2000000, 0x03e740130bc00000,
+    0x03e7440a2da00000, 0x03e7480c45c00000, 0x03e74c12cf000000, 0x03e7500a05600000,
+    0x03e7540ba3200000, 0x03e7580dbd400000, 0x03e75c11e5400000, 0x03e7600bf1600000,
+    0x03e7640c28800000, 0x03e7680d02e00000, 0x03e76c0e70e00000, 0x03e77012d0c00000,
+    0x03e7740a45200000, 0x03e7780a81e00000, 0x03e77c0b8ca00000, 0x03e7800cc2600000,
+    0x03e7840ce9c00000, 0x03e7880d15000000, 0x03e78c0d9ca00000, 0x03e7900e80c00000,
+    0x03e7940ebc400000, 0x03e7980fef200000, 0x03e79c1119e00000, 0x03e7a0111c200000,
+    0x03e7a41239800000, 0x03e7a812dc400000, 0x03e7ac0a67e00000, 0x03e7b00dd7400000,
+    0x03e7b40a83a00000, 0x03e7b80e3a000000, 0x03e7bc0e93000000, 0x03e7c010bf400000,
+    0x03e7c412d4600000, 0x03e7c8138ae00000, 0x03e7cc13d3e00000, 0x03e7d00cf2e00000,
+    0x03e7d40db9600000, 0x03e7d8103d000000, 0x03e7dc0f59600000, 0x03e7e00f64000000,
+    0x03e7e40f92400000, 0x03e7e80e58000000, 0x03e7ec0e13200000, 0x03e7f0116b000000,
+    0x03e7f409d8000000, 0x03e7f81066c00000, 0x03e7fc0a47400000, 0x03e8000a40e00000,
+    0x03e8040bd4c00000, 0x03e8080c5a600000, 0x03e80c0f9ac00000, 0x03e8100b70a00000,
+    0x03e8140da3c00000, 0x03e8180cd6800000, 0x03e81c11e7600000, 0x03e8201109800000,
+    0x03e82412c9a00000, 0x03e8281131600000, 0x03e82c0bda600000, 0x03e8300a28000000,
+    0x03e8340ab8000000, 0x03e8400b0b400000, 0x03e8480cce800000, 0x03e8540a3bc00000,
+    0x03e8580e65400000, 0x03e85c0ed9400000, 0x03e8600f27800000, 0x03e8640f2bc00000,
+    0x03e8680f2ca00000, 0x03e86c0f31e00000, 0x03e87012eac00000, 0x03e8740f97c00000,
+    0x03e8780ff7a00000, 0x03e88010c2400000, 0x03e888115f000000, 0x03e8941207000000,
+    0x03e898121fa00000, 0x03e8a8131de00000, 0x03e8ac131f800000, 0x03e8b01325000000,
+    0x03e8b413b6800000, 0x03e8b8121bc00000, 0x03e8bc12d6e00000, 0x03e8c009f5c00000,
+    0x03e8c40a1ce00000, 0x03e8c80a29a00000, 0x03e8cc0a59200000, 0x03e8d00a5c800000,
+    0x03e8d40a6a200000, 0x03e8d80ab3a00000, 0x03e8dc0ac0c00000, 0x03e8e00acd000000,
+    0x03e8e40b08000000, 0x03e8e80b15000000, 0x03e8ec0b8c800000, 0x03e8f00b8dc00000,
+    0x03e8f40c12800000, 0x03e8f80c2d000000, 0x03e8fc0c31c00000, 0x03e9000c3e400000,
+    0x03e9040ca9e00000, 0x03e9080cbc400000, 0x03e90c0cd2200000, 0x03e9100d10a00000,
+    0x03e9140daee00000, 0x03e9180dc3400000, 0x03e91c0de4400000, 0x03e9200e2dc00000,
+    0x03e9240e45600000, 0x03e9280e84400000, 0x03e92c0f12200000, 0x03e9300f27c00000,
+    0x03e9340f29200000, 0x03e9380f29000000, 0x03e93c0f2a000000, 0x03e9400f2ac00000,
+    0x03e9440f2ba00000, 0x03e9480f31a00000, 0x03e94c0f31c00000, 0x03e9500f48000000,
+    0x03e9540f50200000, 0x03e9580f78000000, 0x03e95c0fbe800000, 0x03e9600fc1200000,
+    0x03e9640fc8200000, 0x03e9680fee400000, 0x03e96c1000a00000, 0x03e970103da00000,
+    0x03e974104f200000, 0x03e978104f200000, 0x03e97c108ae00000, 0x03e9801122000000,
+    0x03e9841132c00000, 0x03e9881160200000, 0x03e98c1167200000, 0x03e990119a600000,
+    0x03e99411a1000000, 0x03e99811f6c00000, 0x03e99c1207000000, 0x03e9a012dc600000,
+    0x03e9a412ffe00000, 0x03e9a81307600000, 0x03e9ac0c0ea00000, 0x03e9b0485dc00000,
+    0x03e9b41043000000, 0x03e9c009c4c00000, 0x03e9c40a36a00000, 0x03e9c80a2d000000,
+    0x03e9cc09f0000000, 0x03e9d00a28a00000, 0x03e9d40a30000000, 0x03e9d80a58e00000,
+    0x03e9dc0a5f400000, 0x03e9e00ab3a00000, 0x03e9e40aaaa00000, 0x03e9e80ab3200000,
+    0x03e9ec0abc400000, 0x03e9f00b0b400000, 0x03e9f40b16600000, 0x03e9f80b28800000,
+    0x03e9fc0b2a800000, 0x03ea000b4c400000, 0x03ea040b65000000, 0x03ea080bda400000,
+    0x03ea0c0bdb200000, 0x03ea100bed200000, 0x03ea140bf5a00000, 0x03ea180c1b000000,
+    0x03ea1c0c29c00000, 0x03ea200c21000000, 0x03ea240c31c00000, 0x03ea280c2c000000,
+    0x03ea2c0c3e400000, 0x03ea300c46800000, 0x03ea340c78800000, 0x03ea380c83800000,
+    0x03ea3c0c8a400000, 0x03ea400caac00000, 0x03ea440cce800000, 0x03ea480ce2e00000,
+    0x03ea4c0ce3600000, 0x03ea500ceac00000, 0x03ea540d6f200000, 0x03ea580d77400000,
+    0x03ea5c0da8200000, 0x03ea600ddb600000, 0x03ea640dd9600000, 0x03ea680de4400000,
+    0x03ea6c0e03c00000, 0x03ea700e2dc00000, 0x03ea740ef4e00000, 0x03ea780e46a00000,
+    0x03ea7c0e55e00000, 0x03ea800e65400000, 0x03ea840e8e200000, 0x03ea880ea0c00000,
+    0x03ea8c0ea7600000, 0x03ea900ec3a00000, 0x03ea940ec3e00000, 0x03ea980ed9400000,
+    0x03ea9c0edb600000, 0x03eaa00ede800000, 0x03eaa40ee9400000, 0x03eaa80ee8000000,
+    0x03eaac0f19800000, 0x03eab00f56200000, 0x03eab40f78000000, 0x03eab80f8f600000,
+    0x03eabc0fab600000, 0x03eac00fbe800000, 0x03eac40fe7c00000, 0x03eac81000a00000,
+    0x03eacc106a400000, 0x03ead0107de00000, 0x03ead410ef200000, 0x03ead81128200000,
+    0x03eadc1130c00000, 0x03eae01132c00000, 0x03eae41157e00000, 0x03eae8115f000000,
+    0x03eaec1159600000, 0x03eaf01160200000, 0x03eaf4115fc00000, 0x03eaf8115da00000,
+    0x03eafc1167200000, 0x03eb001171400000, 0x03eb0411a1000000, 0x03eb0811e7000000,
+    0x03eb0c120e400000, 0x03eb101233200000, 0x03eb14124ec00000, 0x03eb1812cf800000,
+    0x03eb1c12dc600000, 0x03eb2012eac00000, 0x03eb2412fb600000, 0x03eb2812ffe00000,
+    0x03eb2c1301600000, 0x03eb301307600000, 0x03eb341362400000, 0x03eb3813f3800000,
+    0x03eb3c4509400000, 0x03eb404508800000, 0x03eb44467aa00000, 0x03eb480773a00000,
+    0x03eb4c0803000000, 0x03eb500807200000, 0x03eb544a49200000, 0x03eb584b9a000000,
+    0x03eb5c4fda600000, 0x03eb6013e8600000, 0x03eb6413f1c00000, 0x03ec7400bb2005b4,
+    0x03ec7c00be4005b7, 0x03eca800bd2005c1, 0x03ecac00bd2005c2, 0x03ecb01f692005c1,
+    0x03ecb41f692005c2, 0x03ecb800ba0005b7, 0x03ecbc00ba0005b8, 0x03ecc000ba0005bc,
+    0x03ecc400ba2005bc, 0x03ecc800ba4005bc, 0x03eccc00ba6005bc, 0x03ecd000ba8005bc,
+    0x03ecd400baa005bc, 0x03ecd800bac005bc, 0x03ece000bb0005bc, 0x03ece400bb2005bc,
+    0x03ece800bb4005bc, 0x03ecec00bb6005bc, 0x03ecf000bb8005bc, 0x03ecf800bbc005bc,
+    0x03ed0000bc0005bc, 0x03ed0400bc2005bc, 0x03ed0c00bc6005bc, 0x03ed1000bc8005bc,
+    0x03ed1800bcc005bc, 0x03ed1c00bce005bc, 0x03ed2000bd0005bc, 0x03ed2400bd2005bc,
+    0x03ed2800bd4005bc, 0x03ed2c00baa005b9, 0x03ed3000ba2005bf, 0x03ed3400bb6005bf,
+    0x03ed3800bc8005bf, 0x04426822132110ba, 0x04427022136110ba, 0x0442ac2214a110ba,
+    0x0444b82226211127, 0x0444bc2226411127, 0x044d2c2268e1133e, 0x044d302268e11357,
+    0x0452ec22972114ba, 0x0452f022972114b0, 0x0452f822972114bd, 0x0456e822b70115af,
+    0x0456ec22b72115af, 0x0464e02326a11930, 0x0745783a2ae1d165, 0x07457c3a2b01d165,
+    0x0745803a2be1d16e, 0x0745843a2be1d16f, 0x0745883a2be1d170, 0x07458c3a2be1d171,
+    0x0745903a2be1d172, 0x0746ec3a3721d165, 0x0746f03a3741d165, 0x0746f43a3761d16e,
+    0x0746f83a3781d16e, 0x0746fc3a3761d16f, 0x0747003a3781d16f, 0x0be00009c7a00000,
+    0x0be00409c7000000, 0x0be00809c8200000, 0x0be00c4024400000, 0x0be01009ec000000,
+    0x0be01409f5c00000, 0x0be01809f7600000, 0x0be01c0a00400000, 0x0be0200a0f400000,
+    0x0be0240a13200000, 0x0be0280a1ce00000, 0x0be02c0a19e00000, 0x0be0300693c00000,
+    0x0be03440c7400000, 0x0be0380a29a00000, 0x0be03c0a2a800000, 0x0be0400a2c800000,
+    0x0be0440a2ee00000, 0x0be04840a3800000, 0x0be04c0697200000, 0x0be0500a2ce00000,
+    0x0be0540a31a00000, 0x0be05840a9600000, 0x0be05c0a32e00000, 0x0be0600a34800000,
+    0x0be06409d9800000, 0x0be0680a35800000, 0x0be06c0a36a00000, 0x0be070523be00000,
+    0x0be0740a3ea00000, 0x0be0780a40600000, 0x0be07c069be00000, 0x0be0800a47600000,
+    0x0be0840a48c00000, 0x0be0880a4e400000, 0x0be08c0a4ee00000, 0x0be09006a2a00000,
+    0x0be0940a58e00000, 0x0be0980a59200000, 0x0be09c0a5c800000, 0x0be0a00a5f400000,
+    0x0be0a40a60a00000, 0x0be0a80a60c00000, 0x0be0ac0a62e00000, 0x0be0b00a69200000,
+    0x0be0b40a6a200000, 0x0be0b80a6b400000, 0x0be0bc0a6e600000, 0x0be0c00a6fa00000,
+    0x0be0c40a6fe00000, 0x0be0c80a6fe00000, 0x0be0cc0a6fe00000, 0x0be0d04145800000,
+    0x0be0d40e0e000000, 0x0be0d80a79400000, 0x0be0dc0a7be00000, 0x0be0e0416c600000,
+    0x0be0e40a7d600000, 0x0be0e80a7e200000, 0x0be0ec0a80c00000, 0x0be0f00a93c00000,
+    0x0be0f40a87000000, 0x0be0f80a89000000, 0x0be0fc0a8d000000, 0x0be1000a94400000,
+    0x0be1040a9ec00000, 0x0be1080aa2000000, 0x0be10c0aaa600000, 0x0be1100aac600000,
+    0x0be1140ab0800000, 0x0be1180ab0800000, 0x0be11c0ab3200000, 0x0be1200ab5600000,
+    0x0be1240ab6600000, 0x0be1280ab8400000, 0x0be12c0ae2c00000, 0x0be1300ac0c00000,
+    0x0be1340ae2e00000, 0x0be1380aca200000, 0x0be13c0ace800000, 0x0be1400a40e00000,
+    0x0be1440b1dc00000, 0x0be1480af9c00000, 0x0be14c0afe800000, 0x0be1500b01a00000,
+    0x0be1540af1600000, 0x0be1580b06400000, 0x0be15c0b06200000, 0x0be1600b15800000,
+    0x0be164429c800000, 0x0be1680b1e400000, 0x0be16c0b1ee00000, 0x0be1700b20c00000,
+    0x0be1740b23400000, 0x0be1780b24400000, 0x0be17c0b2c400000, 0x0be18042d5000000,
+    0x0be18442dd400000, 0x0be1880b3d800000, 0x0be18c0b43600000, 0x0be1900b44e00000,
+    0x0be1940b3b000000, 0x0be1980b4cc00000, 0x0be19c06ddc00000, 0x0be1a006df800000,
+    0x0be1a40b61000000, 0x0be1a80b67c00000, 0x0be1ac0b67c00000, 0x0be1b04339000000,
+    0x0be1b40b78600000, 0x0be1b80b7b000000, 0x0be1bc0b7ce00000, 0x0be1c00b7e600000,
+    0x0be1c44363000000, 0x0be1c80b7fe00000, 0x0be1cc0b80c00000, 0x0be1d00bea600000,
+    0x0be1d40b84400000, 0x0be1d806f0200000, 0x0be1dc0b8c000000, 0x0be1e00b8dc00000,
+    0x0be1e40b98000000, 0x0be1e80b91a00000, 0x0be1ec43bc800000, 0x0be1f00ba8600000,
+    0x0be1f443bcc00000, 0x0be1f80badc00000, 0x0be1fc0bad600000, 0x0be2000baf800000,
+    0x0be2040bbc200000, 0x0be2080bbc400000, 0x0be20c0705e00000, 0x0be2100bbfa00000,
+    0x0be2140bc5000000, 0x0be2180bc7a00000, 0x0be21c0bcd200000, 0x0be220070c400000,
+    0x0be2244430600000, 0x0be228070f800000, 0x0be22c0bd6000000, 0x0be2300bd6600000,
+    0x0be2340bd6c00000, 0x0be2380bd9400000, 0x0be23c5472400000, 0x0be2400bdfc00000,
+    0x0be2444466200000, 0x0be2484466200000, 0x0be24c1040200000, 0x0be2500be4400000,
+    0x0be2540be4400000, 0x0be2580718e00000, 0x0be25c4657000000, 0x0be2604c3b400000,
+    0x0be2640bec400000, 0x0be2680bed600000, 0x0be26c071c600000, 0x0be2700bf3400000,
+    0x0be2740bf9a00000, 0x0be2780bfae00000, 0x0be27c0bff200000, 0x0be2800c10200000,
+    0x0be2840727400000, 0x0be2880723800000, 0x0be28c0c12800000, 0x0be29044da800000,
+    0x0be2940c18e00000, 0x0be2980c29000000, 0x0be29c0c29800000, 0x0be2a00c29c00000,
+    0x0be2a40c29800000, 0x0be2a80c2f400000, 0x0be2ac0c31c00000, 0x0be2b00c36400000,
+    0x0be2b40c34800000, 0x0be2b80c35e00000, 0x0be2bc0c3bc00000, 0x0be2c00c3e400000,
+    0x0be2c40c3ec00000, 0x0be2c80c42000000, 0x0be2cc0c43600000, 0x0be2d00c4ba00000,
+    0x0be2d40c56200000, 0x0be2d80c5a800000, 0x0be2dc0c6a000000, 0x0be2e04561800000,
+    0x0be2e40c67a00000, 0x0be2e80c5f800000, 0x0be2ec0c6d000000, 0x0be2f00c70600000,
+    0x0be2f40c7c800000, 0x0be2f8457e200000, 0x0be2fc0c84400000, 0x0be3000c78a00000,
+    0x0be3040c75200000, 0x0be3080745c00000, 0x0be30c0c8d200000, 0x0be3100c8fc00000,
+    0x0be3140c93a00000, 0x0be3180c8ee00000, 0x0be31c074d800000, 0x0be3200ca9e00000,
+    0x0be3240cad800000, 0x0be3284601400000, 0x0be32c0cbc600000, 0x0be3300cdf000000,
+    0x0be3340cc9200000, 0x0be3380763200000, 0x0be33c0cd2200000, 0x0be3400761000000,
+    0x0be344075c800000, 0x0be3480a32400000, 0x0be34c0a32a00000, 0x0be3500ce0000000,
+    0x0be3540cd3800000, 0x0be3581015a00000, 0x0be35c087b200000, 0x0be3600ce2e00000,
+    0x0be3640ce3600000, 0x0be3680ce4200000, 0x0be36c0cebc00000, 0x0be3700cea600000,
+    0x0be3744678600000, 0x0be3780769200000, 0x0be37c0cff400000, 0x0be3800cf0a00000,
+    0x0be3840d0a400000, 0x0be3880d10a00000, 0x0be38c468da00000, 0x0be3900d11c00000,
+    0x0be3940d03e00000, 0x0be3980d22800000, 0x0be39c0773a00000, 0x0be3a00d28400000,
+    0x0be3a40d34600000, 0x0be3a80d3d400000, 0x0be3ac0d55000000, 0x0be3b046d4600000,
+    0x0be3b40d5b600000, 0x0be3b80783000000, 0x0be3bc0d64200000, 0x0be3c04714e00000,
+    0x0be3c40d6a800000, 0x0be3c80789c00000, 0x0be3cc0d6e400000, 0x0be3d00d73e00000,
+    0x0be3d40d77400000, 0x0be3d80d77600000, 0x0be3dc4751a00000, 0x0be3e043a1600000,
+    0x0be3e4475f400000, 0x0be3e80d89c00000, 0x0be3ec4797800000, 0x0be3f00d97e00000,
+    0x0be3f40d99a00000, 0x0be3f80d8ce00000, 0x0be3fc0da2c00000, 0x0be4000da7c00000,
+    0x0be4040daee00000, 0x0be4080da8200000, 0x0be40c0dad200000, 0x0be4100daf000000,
+    0x0be4140db0a00000, 0x0be41847a3c00000, 0x0be41c0da6800000, 0x0be4200dc5e00000,
+    0x0be4240dcdc00000, 0x0be42807a6600000, 0x0be42c0dd9600000, 0x0be4300dd8e00000,
+    0x0be43447da200000, 0x0be4380dbf200000, 0x0be43c0dedc00000, 0x0be44047ebc00000,
+    0x0be44447f1c00000, 0x0be4480df8c00000, 0x0be44c0e07200000, 0x0be4500e03c00000,
+    0x0be4540e03600000, 0x0be45807b2c00000, 0x0be45c0e09400000, 0x0be4600e0fa00000,
+    0x0be4640e0ee00000, 0x0be4680e15a00000, 0x0be46c40a4a00000, 0x0be4700e28a00000,
+    0x0be474484c600000, 0x0be4780e33800000, 0x0be47c4875600000, 0x0be4800e45000000,
+    0x0be4840e46a00000, 0x0be4880e4a000000, 0x0be48c48c1000000, 0x0be4900e50000000,
+    0x0be4940e52a00000, 0x0be49848e6a00000, 0x0be49c4902800000, 0x0be4a00e6f400000,
+    0x0be4a40e71600000, 0x0be4a807d5800000, 0x0be4ac0e74a00000, 0x0be4b007d7000000,
+    0x0be4b407d7000000, 0x0be4b80e88e00000, 0x0be4bc0e8b800000, 0x0be4c00e8e200000,
+    0x0be4c40e90a00000, 0x0be4c80e99400000, 0x0be4cc07e3600000, 0x0be4d00ea4800000,
+    0x0be4d44986c00000, 0x0be4d80ea7c00000, 0x0be4dc4992400000, 0x0be4e00eae000000,
+    0x0be4e44433e00000, 0x0be4e80ec2000000, 0x0be4ec49f4200000, 0x0be4f049f7000000,
+    0x0be4f44a08800000, 0x0be4f807ff800000, 0x0be4fc0801000000, 0x0be5000ede800000,
+    0x0be5044a1e600000, 0x0be5084a1e400000, 0x0be50c4a23200000, 0x0be5104a26600000,
+    0x0be5140ee3c00000, 0x0be5180ee3e00000, 0x0be51c0ee3e00000, 0x0be5200ee9400000,
+    0x0be5240807200000, 0x0be5280ef1600000, 0x0be52c0808c00000, 0x0be5300812c00000,
+    0x0be5344a83a00000, 0x0be5380f09c00000, 0x0be53c0f11800000, 0x0be5400f19800000,
+    0x0be544081c600000, 0x0be5484ac4c00000, 0x0be54c0f2ac00000, 0x0be5504ad3400000,
+    0x0be5544ad8a00000, 0x0be5580f31e00000, 0x0be55c0f3d600000, 0x0be5600825e00000,
+    0x0be5640f48000000, 0x0be5680f49400000, 0x0be56c0f49e00000, 0x0be5704b2f800000,
+    0x0be5744b54e00000, 0x0be5784b54e00000, 0x0be57c0f5dc00000, 0x0be5800840400000,
+    0x0be5844b75600000, 0x0be5880f78c00000, 0x0be58c0f79200000, 0x0be5900844e00000,
+    0x0be5944b90000000, 0x0be5980f9a400000, 0x0be59c0854000000, 0x0be5a00f9d000000,
+    0x0be5a40f9c600000, 0x0be5a80fa0000000, 0x0be5ac4bf0c00000, 0x0be5b00fac600000,
+    0x0be5b40860200000, 0x0be5b80fb8e00000, 0x0be5bc0fc0400000, 0x0be5c00fc8a00000,
+    0x0be5c40866800000, 0x0be5c84c45000000, 0x0be5cc4c48e00000, 0x0be5d0086b200000,
+    0x0be5d44c5b200000, 0x0be5d80fef400000, 0x0be5dc4c67c00000, 0x0be5e00ff2a00000,
+    0x0be5e40fff400000, 0x0be5e81000a00000, 0x0be5ec4c9b400000, 0x0be5f04ca4600000,
+    0x0be5f4100c000000, 0x0be5f84cb5000000, 0x0be5fc100e000000, 0x0be600466be00000,
+    0x0be604087aa00000, 0x0be6081016400000, 0x0be60c1020600000, 0x0be6100881600000,
+    0x0be6141027c00000, 0x0be6180b56a00000, 0x0be61c4cf4e00000, 0x0be6204cf6a00000,
+    0x0be6244672600000, 0x0be6284673800000, 0x0be62c1040200000, 0x0be6301040800000,
+    0x0be63411f3c00000, 0x0be638088d600000, 0x0be63c1052200000, 0x0be6401051600000,
+    0x0be6441053a00000, 0x0be6480a56600000, 0x0be64c1056200000, 0x0be6501056600000,
+    0x0be6541057a00000, 0x0be658105cc00000, 0x0be65c4d67800000, 0x0be660105ca00000,
+    0x0be6641063a00000, 0x0be668106c600000, 0x0be66c1075a00000, 0x0be6701064600000,
+    0x0be6741077a00000, 0x0be678107ce00000, 0x0be67c108ae00000, 0x0be680106a600000,
+    0x0be6841079400000, 0x0be6881079800000, 0x0be68c107b800000, 0x0be6904d86c00000,
+    0x0be6944dad600000, 0x0be6984d9aa00000, 0x0be69c08a5600000, 0x0be6a0109e200000,
+    0x0be6a4109e600000, 0x0be6a810a2c00000, 0x0be6ac4e79400000, 0x0be6b010ac800000,
+    0x0be6b44de5800000, 0x0be6b808aba00000, 0x0be6bc08ac200000, 0x0be6c04df6200000,
+    0x0be6c44e1a400000, 0x0be6c808ad600000, 0x0be6cc10ca000000, 0x0be6d010cb800000,
+    0x0be6d410cce00000, 0x0be6d810cd200000, 0x0be6dc10d5200000, 0x0be6e010d1000000,
+    0x0be6e410e1c00000, 0x0be6e810dc400000, 0x0be6ec10ef200000, 0x0be6f010e5000000,
+    0x0be6f410ed600000, 0x0be6f810f0c00000, 0x0be6fc08bae00000, 0x0be70010fc200000,
+    0x0be7041100200000, 0x0be70808bf200000, 0x0be70c110c000000, 0x0be710110c600000,
+    0x0be7144ecce00000, 0x0be718111ae00000, 0x0be71c111bc00000, 0x0be72008c6a00000,
+    0x0be724111f400000, 0x0be7280697600000, 0x0be72c4f15c00000, 0x0be7304f2cc00000,
+    0x0be73408d7c00000, 0x0be73808d8e00000, 0x0be73c1154000000, 0x0be740115da00000,
+    0x0be7441171400000, 0x0be748118aa00000, 0x0be74c4f95000000, 0x0be7501195600000,
+    0x0be7541198200000, 0x0be75811a3600000, 0x0be75c11aee00000, 0x0be7604fe5e00000,
+    0x0be7644100800000, 0x0be76811b9600000, 0x0be76c11b7800000, 0x0be77011be000000,
+    0x0be774411bc00000, 0x0be77811da800000, 0x0be77c11e7000000, 0x0be78050ba400000,
+    0x0be78450bda00000, 0x0be7881212800000, 0x0be78c121e200000, 0x0be7901222200000,
+    0x0be79450e5c00000, 0x0be7981223600000, 0x0be79c1247000000, 0x0be7a0125ae00000,
+    0x0be7a4125b000000, 0x0be7a8124f800000, 0x0be7ac127f200000, 0x0be7b01282a00000,
+    0x0be7b4517f400000, 0x0be7b812b1600000, 0x0be7bc0932a00000, 0x0be7c012b6e00000,
+    0x0be7c451aee00000, 0x0be7c8093cc00000, 0x0be7cc12d8600000, 0x0be7d00bb6400000,
+    0x0be7d412e4600000, 0x0be7d85228a00000, 0x0be7dc5243400000, 0x0be7e0094dc00000,
+    0x0be7e4094ec00000, 0x0be7e812fc000000, 0x0be7ec5281400000, 0x0be7f00956400000,
+    0x0be7f45292c00000, 0x0be7f81301600000, 0x0be7fc1301600000, 0x0be8001305200000,
+    0x0be80452b6c00000, 0x0be808131c400000, 0x0be80c0966600000, 0x0be8101325200000,
+    0x0be8141334e00000, 0x0be8181338400000, 0x0be81c133fc00000, 0x0be8200979c00000,
+    0x0be8245366000000, 0x0be8281362400000, 0x0be82c1388000000, 0x0be830139fa00000,
+    0x0be8340999c00000, 0x0be838099da00000, 0x0be83c13ace00000, 0x0be8405419c00000,
+    0x0be844099f000000, 0x0be8485420a00000, 0x0be84c5441c00000, 0x0be8505452200000,
+    0x0be85413d7600000, 0x0be85809aac00000, 0x0be85c13df200000, 0x0be86013dfc00000,
+    0x0be86413e0a00000, 0x0be86813e1e00000, 0x0be86c13e2c00000, 0x0be87013e7600000,
+    0x0be87454c0000000,
+};
+
+// first << 42 | second << 21 | composite (primary composites)
+inline constexpr std::uint64_t compositions[] = {
+    0x0000f0006700226e, 0x0000f40067002260, 0x0000f8006700226f, 0x00010400600000c0,
+    0x00010400602000c1, 0x00010400604000c2, 0x00010400606000c3, 0x0001040060800100,
+    0x0001040060c00102, 0x0001040060e00226, 0x00010400610000c4, 0x0001040061201ea2,
+    0x00010400614000c5, 0x00010400618001cd, 0x0001040061e00200, 0x0001040062200202,
+    0x0001040064601ea0, 0x0001040064a01e00, 0x0001040065000104, 0x0001080060e01e02,
+    0x0001080064601e04, 0x0001080066201e06, 0x00010c0060200106, 0x00010c0060400108,
+    0x00010c0060e0010a, 0x00010c006180010c, 0x00010c0064e000c7, 0x0001100060e01e0a,
+    0x000110006180010e, 0x0001100064601e0c, 0x0001100064e01e10, 0x0001100065a01e12,
+    0x0001100066201e0e, 0x00011400600000c8, 0x00011400602000c9, 0x00011400604000ca,
+    0x0001140060601ebc, 0x0001140060800112, 0x0001140060c00114, 0x0001140060e00116,
+    0x00011400610000cb, 0x0001140061201eba, 0x000114006180011a, 0x0001140061e00204,
+    0x0001140062200206, 0x0001140064601eb8, 0x0001140064e00228, 0x0001140065000118,
+    0x0001140065a01e18, 0x0001140066001e1a, 0x0001180060e01e1e, 0x00011c00602001f4,
+    0x00011c006040011c, 0x00011c0060801e20, 0x00011c0060c0011e, 0x00011c0060e00120,
+    0x00011c00618001e6, 0x00011c0064e00122, 0x0001200060400124, 0x0001200060e01e22,
+    0x0001200061001e26, 0x000120006180021e, 0x0001200064601e24, 0x0001200064e01e28,
+    0x0001200065c01e2a, 0x00012400600000cc, 0x00012400602000cd, 0x00012400604000ce,
+    0x0001240060600128, 0x000124006080012a, 0x0001240060c0012c, 0x0001240060e00130,
+    0x00012400610000cf, 0x0001240061201ec8, 0x00012400618001cf, 0x0001240061e00208,
+    0x000124006220020a, 0x0001240064601eca, 0x000124006500012e, 0x0001240066001e2c,
+    0x0001280060400134, 0x00012c0060201e30, 0x00012c00618001e8, 0x00012c0064601e32,
+    0x00012c0064e00136, 0x00012c0066201e34, 0x0001300060200139, 0x000130006180013d,
+    0x0001300064601e36, 0x0001300064e0013b, 0x0001300065a01e3c, 0x0001300066201e3a,
+    0x0001340060201e3e, 0x0001340060e01e40, 0x0001340064601e42, 0x00013800600001f8,
+    0x0001380060200143, 0x00013800606000d1, 0x0001380060e01e44, 0x0001380061800147,
+    0x0001380064601e46, 0x0001380064e00145, 0x0001380065a01e4a, 0x0001380066201e48,
+    0x00013c00600000d2, 0x00013c00602000d3, 0x00013c00604000d4, 0x00013c00606000d5,
+    0x00013c006080014c, 0x00013c0060c0014e, 0x00013c0060e0022e, 0x00013c00610000d6,
+    0x00013c0061201ece, 0x00013c0061600150, 0x00013c00618001d1, 0x00013c0061e0020c,
+    0x00013c006220020e, 0x00013c00636001a0, 0x00013c0064601ecc, 0x00013c00650001ea,
+    0x0001400060201e54, 0x0001400060e01e56, 0x0001480060200154, 0x0001480060e01e58,
+    0x0001480061800158, 0x0001480061e00210, 0x0001480062200212, 0x0001480064601e5a,
+    0x0001480064e00156, 0x0001480066201e5e, 0x00014c006020015a, 0x00014c006040015c,
+    0x00014c0060e01e60, 0x00014c0061800160, 0x00014c0064601e62, 0x00014c0064c00218,
+    0x00014c0064e0015e, 0x0001500060e01e6a, 0x0001500061800164, 0x0001500064601e6c,
+    0x0001500064c0021a, 0x0001500064e00162, 0x0001500065a01e70, 0x0001500066201e6e,
+    0x00015400600000d9, 0x00015400602000da, 0x00015400604000db, 0x0001540060600168,
+    0x000154006080016a, 0x0001540060c0016c, 0x00015400610000dc, 0x0001540061201ee6,
+    0x000154006140016e, 0x0001540061600170, 0x00015400618001d3, 0x0001540061e00214,
+    0x0001540062200216, 0x00015400636001af, 0x0001540064601ee4, 0x0001540064801e72,
+    0x0001540065000172, 0x0001540065a01e76, 0x0001540066001e74, 0x0001580060601e7c,
+    0x0001580064601e7e, 0x00015c0060001e80, 0x00015c0060201e82, 0x00015c0060400174,
+    0x00015c0060e01e86, 0x00015c0061001e84, 0x00015c0064601e88, 0x0001600060e01e8a,
+    0x0001600061001e8c, 0x0001640060001ef2, 0x00016400602000dd, 0x0001640060400176,
+    0x0001640060601ef8, 0x0001640060800232, 0x0001640060e01e8e, 0x0001640061000178,
+    0x0001640061201ef6, 0x0001640064601ef4, 0x0001680060200179, 0x0001680060401e90,
+    0x0001680060e0017b, 0x000168006180017d, 0x0001680064601e92, 0x0001680066201e94,
+    0x00018400600000e0, 0x00018400602000e1, 0x00018400604000e2, 0x00018400606000e3,
+    0x0001840060800101, 0x0001840060c00103, 0x0001840060e00227, 0x00018400610000e4,
+    0x0001840061201ea3, 0x00018400614000e5, 0x00018400618001ce, 0x0001840061e00201,
+    0x0001840062200203, 0x0001840064601ea1, 0x0001840064a01e01, 0x0001840065000105,
+    0x0001880060e01e03, 0x0001880064601e05, 0x0001880066201e07, 0x00018c0060200107,
+    0x00018c0060400109, 0x00018c0060e0010b, 0x00018c006180010d, 0x00018c0064e000e7,
+    0x0001900060e01e0b, 0x000190006180010f, 0x0001900064601e0d, 0x0001900064e01e11,
+    0x0001900065a01e13, 0x0001900066201e0f, 0x00019400600000e8, 0x00019400602000e9,
+    0x00019400604000ea, 0x0001940060601ebd, 0x0001940060800113, 0x0001940060c00115,
+    0x0001940060e00117, 0x00019400610000eb, 0x0001940061201ebb, 0x000194006180011b,
+    0x0001940061e00205, 0x0001940062200207, 0x0001940064601eb9, 0x0001940064e00229,
+    0x0001940065000119, 0x0001940065a01e19, 0x0001940066001e1b, 0x0001980060e01e1f,
+    0x00019c00602001f5, 0x00019c006040011d, 0x00019c0060801e21, 0x00019c0060c0011f,
+    0x00019c0060e00121, 0x00019c00618001e7, 0x00019c0064e00123, 0x0001a00060400125,
+    0x0001a00060e01e23, 0x0001a00061001e27, 0x0001a0006180021f, 0x0001a00064601e25,
+    0x0001a00064e01e29, 0x0001a00065c01e2b, 0x0001a00066201e96, 0x0001a400600000ec,
+    0x0001a400602000ed, 0x0001a400604000ee, 0x0001a40060600129, 0x0001a4006080012b,
+    0x0001a40060c0012d, 0x0001a400610000ef, 0x0001a40061201ec9, 0x0001a400618001d0,
+    0x0001a40061e00209, 0x0001a4006220020b, 0x0001a40064601ecb, 0x0001a4006500012f,
+    0x0001a40066001e2d, 0x0001a80060400135, 0x0001a800618001f0, 0x0001ac0060201e31,
+    0x0001ac00618001e9, 0x0001ac0064601e33, 0x0001ac0064e00137, 0x0001ac0066201e35,
+    0x0001b0006020013a, 0x0001b0006180013e, 0x0001b00064601e37, 0x0001b00064e0013c,
+    0x0001b00065a01e3d, 0x0001b00066201e3b, 0x0001b40060201e3f, 0x0001b40060e01e41,
+    0x0001b40064601e43, 0x0001b800600001f9, 0x0001b80060200144, 0x0001b800606000f1,
+    0x0001b80060e01e45, 0x0001b80061800148, 0x0001b80064601e47, 0x0001b80064e00146,
+    0x0001b80065a01e4b, 0x0001b80066201e49, 0x0001bc00600000f2, 0x0001bc00602000f3,
+    0x0001bc00604000f4, 0x0001bc00606000f5, 0x0001bc006080014d, 0x0001bc0060c0014f,
+    0x0001bc0060e0022f, 0x0001bc00610000f6, 0x0001bc0061201ecf, 0x0001bc0061600151,
+    0x0001bc00618001d2, 0x0001bc0061e0020d, 0x0001bc006220020f, 0x0001bc00636001a1,
+    0x0001bc0064601ecd, 0x0001bc00650001eb, 0x0001c00060201e55, 0x0001c00060e01e57,
+    0x0001c80060200155, 0x0001c80060e01e59, 0x0001c80061800159, 0x0001c80061e00211,
+    0x0001c80062200213, 0x0001c80064601e5b, 0x0001c80064e00157, 0x0001c80066201e5f,
+    0x0001cc006020015b, 0x0001cc006040015d, 0x0001cc0060e01e61, 0x0001cc0061800161,
+    0x0001cc0064601e63, 0x0001cc0064c00219, 0x0001cc0064e0015f, 0x0001d00060e01e6b,
+    0x0001d00061001e97, 0x0001d00061800165, 0x0001d00064601e6d, 0x0001d00064c0021b,
+    0x0001d00064e00163, 0x0001d00065a01e71, 0x0001d00066201e6f, 0x0001d400600000f9,
+    0x0001d400602000fa, 0x0001d400604000fb, 0x0001d40060600169, 0x0001d4006080016b,
+    0x0001d40060c0016d, 0x0001d400610000fc, 0x0001d40061201ee7, 0x0001d4006140016f,
+    0x0001d40061600171, 0x0001d400618001d4, 0x0001d40061e00215, 0x0001d40062200217,
+    0x0001d400636001b0, 0x0001d40064601ee5, 0x0001d40064801e73, 0x0001d40065000173,
+    0x0001d40065a01e77, 0x0001d40066001e75, 0x0001d80060601e7d, 0x0001d80064601e7f,
+    0x0001dc0060001e81, 0x0001dc0060201e83, 0x0001dc0060400175, 0x0001dc0060e01e87,
+    0x0001dc0061001e85, 0x0001dc0061401e98, 0x0001dc0064601e89, 0x0001e00060e01e8b,
+    0x0001e00061001e8d, 0x0001e40060001ef3, 0x0001e400602000fd, 0x0001e40060400177,
+    0x0001e40060601ef9, 0x0001e40060800233, 0x0001e40060e01e8f, 0x0001e400610000ff,
+    0x0001e40061201ef7, 0x0001e40061401e99, 0x0001e40064601ef5, 0x0001e8006020017a,
+    0x0001e80060401e91, 0x0001e80060e0017c, 0x0001e8006180017e, 0x0001e80064601e93,
+    0x0001e80066201e95, 0x0002a00060001fed, 0x0002a00060200385, 0x0002a00068401fc1,
+    0x0003080060001ea6, 0x0003080060201ea4, 0x0003080060601eaa, 0x0003080061201ea8,
+    0x00031000608001de, 0x00031400602001fa, 0x00031800602001fc, 0x00031800608001e2,
+    0x00031c0060201e08, 0x0003280060001ec0, 0x0003280060201ebe, 0x0003280060601ec4,
+    0x0003280061201ec2, 0x00033c0060201e2e, 0x0003500060001ed2, 0x0003500060201ed0,
+    0x0003500060601ed6, 0x0003500061201ed4, 0x0003540060201e4c, 0x000354006080022c,
+    0x0003540061001e4e, 0x000358006080022a, 0x00036000602001fe, 0x00037000600001db,
+    0x00037000602001d7, 0x00037000608001d5, 0x00037000618001d9, 0x0003880060001ea7,
+    0x0003880060201ea5, 0x0003880060601eab, 0x0003880061201ea9, 0x00039000608001df,
+    0x00039400602001fb, 0x00039800602001fd, 0x00039800608001e3, 0x00039c0060201e09,
+    0x0003a80060001ec1, 0x0003a80060201ebf, 0x0003a80060601ec5, 0x0003a80061201ec3,
+    0x0003bc0060201e2f, 0x0003d00060001ed3, 0x0003d00060201ed1, 0x0003d00060601ed7,
+    0x0003d00061201ed5, 0x0003d40060201e4d, 0x0003d4006080022d, 0x0003d40061001e4f,
+    0x0003d8006080022b, 0x0003e000602001ff, 0x0003f000600001dc, 0x0003f000602001d8,
+    0x0003f000608001d6, 0x0003f000618001da, 0x0004080060001eb0, 0x0004080060201eae,
+    0x0004080060601eb4, 0x0004080061201eb2, 0x00040c0060001eb1, 0x00040c0060201eaf,
+    0x00040c0060601eb5, 0x00040c0061201eb3, 0x0004480060001e14, 0x0004480060201e16,
+    0x00044c0060001e15, 0x00044c0060201e17, 0x0005300060001e50, 0x0005300060201e52,
+    0x0005340060001e51, 0x0005340060201e53, 0x0005680060e01e64, 0x00056c0060e01e65,
+    0x0005800060e01e66, 0x0005840060e01e67, 0x0005a00060201e78, 0x0005a40060201e79,
+    0x0005a80061001e7a, 0x0005ac0061001e7b, 0x0005fc0060e01e9b, 0x0006800060001edc,
+    0x0006800060201eda, 0x0006800060601ee0, 0x0006800061201ede, 0x0006800064601ee2,
+    0x0006840060001edd, 0x0006840060201edb, 0x0006840060601ee1, 0x0006840061201edf,
+    0x0006840064601ee3, 0x0006bc0060001eea, 0x0006bc0060201ee8, 0x0006bc0060601eee,
+    0x0006bc0061201eec, 0x0006bc0064601ef0, 0x0006c00060001eeb, 0x0006c00060201ee9,
+    0x0006c00060601eef, 0x0006c00061201eed, 0x0006c00064601ef1, 0x0006dc00618001ee,
+    0x0007a800608001ec, 0x0007ac00608001ed, 0x00089800608001e0, 0x00089c00608001e1,
+    0x0008a00060c01e1c, 0x0008a40060c01e1d, 0x0008b80060800230, 0x0008bc0060800231,
+    0x000a4800618001ef, 0x000e440060001fba, 0x000e440060200386, 0x000e440060801fb9,
+    0x000e440060c01fb8, 0x000e440062601f08, 0x000e440062801f09, 0x000e440068a01fbc,
+    0x000e540060001fc8, 0x000e540060200388, 0x000e540062601f18, 0x000e540062801f19,
+    0x000e5c0060001fca, 0x000e5c0060200389, 0x000e5c0062601f28, 0x000e5c0062801f29,
+    0x000e5c0068a01fcc, 0x000e640060001fda, 0x000e64006020038a, 0x000e640060801fd9,
+    0x000e640060c01fd8, 0x000e6400610003aa, 0x000e640062601f38, 0x000e640062801f39,
+    0x000e7c0060001ff8, 0x000e7c006020038c, 0x000e7c0062601f48, 0x000e7c0062801f49,
+    0x000e840062801fec, 0x000e940060001fea, 0x000e94006020038e, 0x000e940060801fe9,
+    0x000e940060c01fe8, 0x000e9400610003ab, 0x000e940062801f59, 0x000ea40060001ffa,
+    0x000ea4006020038f, 0x000ea40062601f68, 0x000ea40062801f69, 0x000ea40068a01ffc,
+    0x000eb00068a01fb4, 0x000eb80068a01fc4, 0x000ec40060001f70, 0x000ec400602003ac,
+    0x000ec40060801fb1, 0x000ec40060c01fb0, 0x000ec40062601f00, 0x000ec40062801f01,
+    0x000ec40068401fb6, 0x000ec40068a01fb3, 0x000ed40060001f72, 0x000ed400602003ad,
+    0x000ed40062601f10, 0x000ed40062801f11, 0x000edc0060001f74, 0x000edc00602003ae,
+    0x000edc0062601f20, 0x000edc0062801f21, 0x000edc0068401fc6, 0x000edc0068a01fc3,
+    0x000ee40060001f76, 0x000ee400602003af, 0x000ee40060801fd1, 0x000ee40060c01fd0,
+    0x000ee400610003ca, 0x000ee40062601f30, 0x000ee40062801f31, 0x000ee40068401fd6,
+    0x000efc0060001f78, 0x000efc00602003cc, 0x000efc0062601f40, 0x000efc0062801f41,
+    0x000f040062601fe4, 0x000f040062801fe5, 0x000f140060001f7a, 0x000f1400602003cd,
+    0x000f140060801fe1, 0x000f140060c01fe0, 0x000f1400610003cb, 0x000f140062601f50,
+    0x000f140062801f51, 0x000f140068401fe6, 0x000f240060001f7c, 0x000f2400602003ce,
+    0x000f240062601f60, 0x000f240062801f61, 0x000f240068401ff6, 0x000f240068a01ff3,
+    0x000f280060001fd2, 0x000f280060200390, 0x000f280068401fd7, 0x000f2c0060001fe2,
+    0x000f2c00602003b0, 0x000f2c0068401fe7, 0x000f380068a01ff4, 0x000f4800602003d3,
+    0x000f4800610003d4, 0x0010180061000407, 0x0010400060c004d0, 0x00104000610004d2,
+    0x00104c0060200403, 0x0010540060000400, 0x0010540060c004d6, 0x0010540061000401,
+    0x0010580060c004c1, 0x00105800610004dc, 0x00105c00610004de, 0x001060006000040d,
+    0x00106000608004e2, 0x0010600060c00419, 0x00106000610004e4, 0x001068006020040c,
+    0x00107800610004e6, 0x00108c00608004ee, 0x00108c0060c0040e, 0x00108c00610004f0,
+    0x00108c00616004f2, 0x00109c00610004f4, 0x0010ac00610004f8, 0x0010b400610004ec,
+    0x0010c00060c004d1, 0x0010c000610004d3, 0x0010cc0060200453, 0x0010d40060000450,
+    0x0010d40060c004d7, 0x0010d40061000451, 0x0010d80060c004c2, 0x0010d800610004dd,
+    0x0010dc00610004df, 0x0010e0006000045d, 0x0010e000608004e3, 0x0010e00060c00439,
+    0x0010e000610004e5, 0x0010e8006020045c, 0x0010f800610004e7, 0x00110c00608004ef,
+    0x00110c0060c0045e, 0x00110c00610004f1, 0x00110c00616004f3, 0x00111c00610004f5,
+    0x00112c00610004f9, 0x00113400610004ed, 0x0011580061000457, 0x0011d00061e00476,
+    0x0011d40061e00477, 0x00136000610004da, 0x00136400610004db, 0x0013a000610004ea,
+    0x0013a400610004eb, 0x00189c00ca600622, 0x00189c00ca800623, 0x00189c00caa00625,
+    0x00192000ca800624, 0x00192800ca800626, 0x001b0400ca8006c2, 0x001b4800ca8006d3,
+    0x001b5400ca8006c0, 0x0024a00127800929, 0x0024c00127800931, 0x0024cc0127800934,
+    0x00271c0137c009cb, 0x00271c013ae009cc, 0x002d1c0167c00b4b, 0x002d1c016ac00b48,
+    0x002d1c016ae00b4c, 0x002e48017ae00b94, 0x002f180177c00bca, 0x002f18017ae00bcc,
+    0x002f1c0177c00bcb, 0x003118018ac00c48, 0x0032fc019aa00cc0, 0x0033180198400cca,
+    0x003318019aa00cc7, 0x003318019ac00cc8, 0x003328019aa00ccb, 0x00351801a7c00d4a,
+    0x00351801aae00d4c, 0x00351c01a7c00d4b, 0x00376401b9400dda, 0x00376401b9e00ddc,
+    0x00376401bbe00dde, 0x00377001b9400ddd, 0x0040940205c01026, 0x006c140366a01b06,
+    0x006c1c0366a01b08, 0x006c240366a01b0a, 0x006c2c0366a01b0c, 0x006c340366a01b0e,
+    0x006c440366a01b12, 0x006ce80366a01b3b, 0x006cf00366a01b3d, 0x006cf80366a01b40,
+    0x006cfc0366a01b41, 0x006d080366a01b43, 0x0078d80060801e38, 0x0078dc0060801e39,
+    0x0079680060801e5c, 0x00796c0060801e5d, 0x0079880060e01e68, 0x00798c0060e01e69,
+    0x007a800060401eac, 0x007a800060c01eb6, 0x007a840060401ead, 0x007a840060c01eb7,
+    0x007ae00060401ec6, 0x007ae40060401ec7, 0x007b300060401ed8, 0x007b340060401ed9,
+    0x007c000060001f02, 0x007c000060201f04, 0x007c000068401f06, 0x007c000068a01f80,
+    0x007c040060001f03, 0x007c040060201f05, 0x007c040068401f07, 0x007c040068a01f81,
+    0x007c080068a01f82, 0x007c0c0068a01f83, 0x007c100068a01f84, 0x007c140068a01f85,
+    0x007c180068a01f86, 0x007c1c0068a01f87, 0x007c200060001f0a, 0x007c200060201f0c,
+    0x007c200068401f0e, 0x007c200068a01f88, 0x007c240060001f0b, 0x007c240060201f0d,
+    0x007c240068401f0f, 0x007c240068a01f89, 0x007c280068a01f8a, 0x007c2c0068a01f8b,
+    0x007c300068a01f8c, 0x007c340068a01f8d, 0x007c380068a01f8e, 0x007c3c0068a01f8f,
+    0x007c400060001f12, 0x007c400060201f14, 0x007c440060001f13, 0x007c440060201f15,
+    0x007c600060001f1a, 0x007c600060201f1c, 0x007c640060001f1b, 0x007c640060201f1d,
+    0x007c800060001f22, 0x007c800060201f24, 0x007c800068401f26, 0x007c800068a01f90,
+    0x007c840060001f23, 0x007c840060201f25, 0x007c840068401f27, 0x007c840068a01f91,
+    0x007c880068a01f92, 0x007c8c0068a01f93, 0x007c900068a01f94, 0x007c940068a01f95,
+    0x007c980068a01f96, 0x007c9c0068a01f97, 0x007ca00060001f2a, 0x007ca00060201f2c,
+    0x007ca00068401f2e, 0x007ca00068a01f98, 0x007ca40060001f2b, 0x007ca40060201f2d,
+    0x007ca40068401f2f, 0x007ca40068a01f99, 0x007ca80068a01f9a, 0x007cac0068a01f9b,
+    0x007cb00068a01f9c, 0x007cb40068a01f9d, 0x007cb80068a01f9e, 0x007cbc0068a01f9f,
+    0x007cc00060001f32, 0x007cc00060201f34, 0x007cc00068401f36, 0x007cc40060001f33,
+    0x007cc40060201f35, 0x007cc40068401f37, 0x007ce00060001f3a, 0x007ce00060201f3c,
+    0x007ce00068401f3e, 0x007ce40060001f3b, 0x007ce40060201f3d, 0x007ce40068401f3f,
+    0x007d000060001f42, 0x007d000060201f44, 0x007d040060001f43, 0x007d040060201f45,
+    0x007d200060001f4a, 0x007d200060201f4c, 0x007d240060001f4b, 0x007d240060201f4d,
+    0x007d400060001f52, 0x007d400060201f54, 0x007d400068401f56, 0x007d440060001f53,
+    0x007d440060201f55, 0x007d440068401f57, 0x007d640060001f5b, 0x007d640060201f5d,
+    0x007d640068401f5f, 0x007d800060001f62, 0x007d800060201f64, 0x007d800068401f66,
+    0x007d800068a01fa0, 0x007d840060001f63, 0x007d840060201f65, 0x007d840068401f67,
+    0x007d840068a01fa1, 0x007d880068a01fa2, 0x007d8c0068a01fa3, 0x007d900068a01fa4,
+    0x007d940068a01fa5, 0x007d980068a01fa6, 0x007d9c0068a01fa7, 0x007da00060001f6a,
+    0x007da00060201f6c, 0x007da00068401f6e, 0x007da00068a01fa8, 0x007da40060001f6b,
+    0x007da40060201f6d, 0x007da40068401f6f, 0x007da40068a01fa9, 0x007da80068a01faa,
+    0x007dac0068a01fab, 0x007db00068a01fac, 0x007db40068a01fad, 0x007db80068a01fae,
+    0x007dbc0068a01faf, 0x007dc00068a01fb2, 0x007dd00068a01fc2, 0x007df00068a01ff2,
+    0x007ed80068a01fb7, 0x007efc0060001fcd, 0x007efc0060201fce, 0x007efc0068401fcf,
+    0x007f180068a01fc7, 0x007fd80068a01ff7, 0x007ff80060001fdd, 0x007ff80060201fde,
+    0x007ff80068401fdf, 0x008640006700219a, 0x008648006700219b, 0x00865000670021ae,
+    0x00874000670021cd, 0x00874800670021cf, 0x00875000670021ce, 0x00880c0067002204,
+    0x0088200067002209, 0x00882c006700220c, 0x00888c0067002224, 0x0088940067002226,
+    0x0088f00067002241, 0x00890c0067002244, 0x0089140067002247, 0x0089200067002249,
+    0x008934006700226d, 0x0089840067002262, 0x0089900067002270, 0x0089940067002271,
+    0x0089c80067002274, 0x0089cc0067002275, 0x0089d80067002278, 0x0089dc0067002279,
+    0x0089e80067002280, 0x0089ec0067002281, 0x0089f000670022e0, 0x0089f400670022e1,
+    0x008a080067002284, 0x008a0c0067002285, 0x008a180067002288, 0x008a1c0067002289,
+    0x008a4400670022e2, 0x008a4800670022e3, 0x008a8800670022ac, 0x008aa000670022ad,
+    0x008aa400670022ae, 0x008aac00670022af, 0x008ac800670022ea, 0x008acc00670022eb,
+    0x008ad000670022ec, 0x008ad400670022ed, 0x00c1180613203094, 0x00c12c061320304c,
+    0x00c134061320304e, 0x00c13c0613203050, 0x00c1440613203052, 0x00c14c0613203054,
+    0x00c1540613203056, 0x00c15c0613203058, 0x00c164061320305a, 0x00c16c061320305c,
+    0x00c174061320305e, 0x00c17c0613203060, 0x00c1840613203062, 0x00c1900613203065,
+    0x00c1980613203067, 0x00c1a00613203069, 0x00c1bc0613203070, 0x00c1bc0613403071,
+    0x00c1c80613203073, 0x00c1c80613403074, 0x00c1d40613203076, 0x00c1d40613403077,
+    0x00c1e00613203079, 0x00c1e0061340307a, 0x00c1ec061320307c, 0x00c1ec061340307d,
+    0x00c274061320309e, 0x00c29806132030f4, 0x00c2ac06132030ac, 0x00c2b406132030ae,
+    0x00c2bc06132030b0, 0x00c2c406132030b2, 0x00c2cc06132030b4, 0x00c2d406132030b6,
+    0x00c2dc06132030b8, 0x00c2e406132030ba, 0x00c2ec06132030bc, 0x00c2f406132030be,
+    0x00c2fc06132030c0, 0x00c30406132030c2, 0x00c31006132030c5, 0x00c31806132030c7,
+    0x00c32006132030c9, 0x00c33c06132030d0, 0x00c33c06134030d1, 0x00c34806132030d3,
+    0x00c34806134030d4, 0x00c35406132030d6, 0x00c35406134030d7, 0x00c36006132030d9,
+    0x00c36006134030da, 0x00c36c06132030dc, 0x00c36c06134030dd, 0x00c3bc06132030f7,
+    0x00c3c006132030f8, 0x00c3c406132030f9, 0x00c3c806132030fa, 0x00c3f406132030fe,
+    0x044264221741109a, 0x04426c221741109c, 0x04429422174110ab, 0x0444c42224e1112e,
+    0x0444c82224e1112f, 0x044d1c2267c1134b, 0x044d1c226ae1134c, 0x0452e422960114bc,
+    0x0452e422974114bb, 0x0452e42297a114be, 0x0456e022b5e115ba, 0x0456e422b5e115bb,
+    0x0464d42326011938,
+};
+
+// first << 32 | last: code points that are not NFC quick-check safe
+// (combining, decomposing, or composing with the code point before)
+inline constexpr std::uint64_t nfc_unsafe[] = {
+    0x000003000000034e, 0x000003500000036f, 0x0000037400000374, 0x0000037e0000037e,
+    0x0000038700000387, 0x0000048300000487, 0x00000591000005bd, 0x000005bf000005bf,
+    0x000005c1000005c2, 0x000005c4000005c5, 0x000005c7000005c7, 0x000006100000061a,
+    0x0000064b0000065f, 0x0000067000000670, 0x000006d6000006dc, 0x000006df000006e4,
+    0x000006e7000006e8, 0x000006ea000006ed, 0x0000071100000711, 0x000007300000074a,
+    0x000007eb000007f3, 0x000007fd000007fd, 0x0000081600000819, 0x0000081b00000823,
+    0x0000082500000827, 0x000008290000082d, 0x000008590000085b, 0x000008980000089f,
+    0x000008ca000008e1, 0x000008e3000008ff, 0x0000093c0000093c, 0x0000094d0000094d,
+    0x0000095100000954, 0x000009580000095f, 0x000009bc000009bc, 0x000009be000009be,
+    0x000009cd000009cd, 0x000009d7000009d7, 0x000009dc000009dd, 0x000009df000009df,
+    0x000009fe000009fe, 0x00000a3300000a33, 0x00000a3600000a36, 0x00000a3c00000a3c,
+    0x00000a4d00000a4d, 0x00000a5900000a5b, 0x00000a5e00000a5e, 0x00000abc00000abc,
+    0x00000acd00000acd, 0x00000b3c00000b3c, 0x00000b3e00000b3e, 0x00000b4d00000b4d,
+    0x00000b5600000b57, 0x00000b5c00000b5d, 0x00000bbe00000bbe, 0x00000bcd00000bcd,
+    0x00000bd700000bd7, 0x00000c3c00000c3c, 0x00000c4d00000c4d, 0x00000c5500000c56,
+    0x00000cbc00000cbc, 0x00000cc200000cc2, 0x00000ccd00000ccd, 0x00000cd500000cd6,
+    0x00000d3b00000d3c, 0x00000d3e00000d3e, 0x00000d4d00000d4d, 0x00000d5700000d57,
+    0x00000dca00000dca, 0x00000dcf00000dcf, 0x00000ddf00000ddf, 0x00000e3800000e3a,
+    0x00000e4800000e4b, 0x00000eb800000eba, 0x00000ec800000ecb, 0x00000f1800000f19,
+    0x00000f3500000f35, 0x00000f3700000f37, 0x00000f3900000f39, 0x00000f4300000f43,
+    0x00000f4d00000f4d, 0x00000f5200000f52, 0x00000f5700000f57, 0x00000f5c00000f5c,
+    0x00000f6900000f69, 0x00000f7100000f76, 0x00000f7800000f78, 0x00000f7a00000f7d,
+    0x00000f8000000f84, 0x00000f8600000f87, 0x00000f9300000f93, 0x00000f9d00000f9d,
+    0x00000fa200000fa2, 0x00000fa700000fa7, 0x00000fac00000fac, 0x00000fb900000fb9,
+    0x00000fc600000fc6, 0x0000102e0000102e, 0x0000103700001037, 0x000010390000103a,
+    0x0000108d0000108d, 0x0000116100001175, 0x000011a8000011c2, 0x0000135d0000135f,
+    0x0000171400001715, 0x0000173400001734, 0x000017d2000017d2, 0x000017dd000017dd,
+    0x000018a9000018a9, 0x000019390000193b, 0x00001a1700001a18, 0x00001a6000001a60,
+    0x00001a7500001a7c, 0x00001a7f00001a7f, 0x00001ab000001abd, 0x00001abf00001ace,
+    0x00001b3400001b35, 0x00001b4400001b44, 0x00001b6b00001b73, 0x00001baa00001bab,
+    0x00001be600001be6, 0x00001bf200001bf3, 0x00001c3700001c37, 0x00001cd000001cd2,
+    0x00001cd400001ce0, 0x00001ce200001ce8, 0x00001ced00001ced, 0x00001cf400001cf4,
+    0x00001cf800001cf9, 0x00001dc000001dff, 0x00001f7100001f71, 0x00001f7300001f73,
+    0x00001f7500001f75, 0x00001f7700001f77, 0x00001f7900001f79, 0x00001f7b00001f7b,
+    0x00001f7d00001f7d, 0x00001fbb00001fbb, 0x00001fbe00001fbe, 0x00001fc900001fc9,
+    0x00001fcb00001fcb, 0x00001fd300001fd3, 0x00001fdb00001fdb, 0x00001fe300001fe3,
+    0x00001feb00001feb, 0x00001fee00001fef, 0x00001ff900001ff9, 0x00001ffb00001ffb,
+    0x00001ffd00001ffd, 0x0000200000002001, 0x000020d0000020dc, 0x000020e1000020e1,
+    0x000020e5000020f0, 0x0000212600002126, 0x0000212a0000212b, 0x000023290000232a,
+    0x00002adc00002adc, 0x00002cef00002cf1, 0x00002d7f00002d7f, 0x00002de000002dff,
+    0x0000302a0000302f, 0x000030990000309a, 0x0000a66f0000a66f, 0x0000a6740000a67d,
+    0x0000a69e0000a69f, 0x0000a6f00000a6f1, 0x0000a8060000a806, 0x0000a82c0000a82c,
+    0x0000a8c40000a8c4, 0x0000a8e00000a8f1, 0x0000a92b0000a92d, 0x0000a9530000a953,
+    0x0000a9b30000a9b3, 0x0000a9c00000a9c0, 0x0000aab00000aab0, 0x0000aab20000aab4,
+    0x0000aab70000aab8, 0x0000aabe0000aabf, 0x0000aac10000aac1, 0x0000aaf60000aaf6,
+    0x0000abed0000abed, 0x0000f9000000fa0d, 0x0000fa100000fa10, 0x0000fa120000fa12,
+    0x0000fa150000fa1e, 0x0000fa200000fa20, 0x0000fa220000fa22, 0x0000fa250000fa26,
+    0x0000fa2a0000fa6d, 0x0000fa700000fad9, 0x0000fb1d0000fb1f, 0x0000fb2a0000fb36,
+    0x0000fb380000fb3c, 0x0000fb3e0000fb3e, 0x0000fb400000fb41, 0x0000fb430000fb44,
+    0x0000fb460000fb4e, 0x0000fe200000fe2f, 0x000101fd000101fd, 0x000102e0000102e0,
+    0x000103760001037a, 0x00010a0d00010a0d, 0x00010a0f00010a0f, 0x00010a3800010a3a,
+    0x00010a3f00010a3f, 0x00010ae500010ae6, 0x00010d2400010d27, 0x00010eab00010eac,
+    0x00010f4600010f50, 0x00010f8200010f85, 0x0001104600011046, 0x0001107000011070,
+    0x0001107f0001107f, 0x000110b9000110ba, 0x0001110000011102, 0x0001112700011127,
+    0x0001113300011134, 0x0001117300011173, 0x000111c0000111c0, 0x000111ca000111ca,
+    0x0001123500011236, 0x000112e9000112ea, 0x0001133b0001133c, 0x0001133e0001133e,
+    0x0001134d0001134d, 0x0001135700011357, 0x000113660001136c, 0x0001137000011374,
+    0x0001144200011442, 0x0001144600011446, 0x0001145e0001145e, 0x000114b0000114b0,
+    0x000114ba000114ba, 0x000114bd000114bd, 0x000114c2000114c3, 0x000115af000115af,
+    0x000115bf000115c0, 0x0001163f0001163f, 0x000116b6000116b7, 0x0001172b0001172b,
+    0x000118390001183a, 0x0001193000011930, 0x0001193d0001193e, 0x0001194300011943,
+    0x000119e0000119e0, 0x00011a3400011a34, 0x00011a4700011a47, 0x00011a9900011a99,
+    0x00011c3f00011c3f, 0x00011d4200011d42, 0x00011d4400011d45, 0x00011d9700011d97,
+    0x00016af000016af4, 0x00016b3000016b36, 0x00016ff000016ff1, 0x0001bc9e0001bc9e,
+    0x0001d15e0001d169, 0x0001d16d0001d172, 0x0001d17b0001d182, 0x0001d1850001d18b,
+    0x0001d1aa0001d1ad, 0x0001d1bb0001d1c0, 0x0001d2420001d244, 0x0001e0000001e006,
+    0x0001e0080001e018, 0x0001e01b0001e021, 0x0001e0230001e024, 0x0001e0260001e02a,
+    0x0001e1300001e136, 0x0001e2ae0001e2ae, 0x0001e2ec0001e2ef, 0x0001e8d00001e8d6,
+    0x0001e9440001e94a, 0x0002f8000002fa1d,
+};
+
+// first << 32 | last: code points that are combining or decompose
+inline constexpr std::uint64_t nfd_unsafe[] = {
+    0x000000c0000000c5, 0x000000c7000000cf, 0x000000d1000000d6, 0x000000d9000000dd,
+    0x000000e0000000e5, 0x000000e7000000ef, 0x000000f1000000f6, 0x000000f9000000fd,
+    0x000000ff0000010f, 0x0000011200000125, 0x0000012800000130, 0x0000013400000137,
+    0x000001390000013e, 0x0000014300000148, 0x0000014c00000151, 0x0000015400000165,
+    0x000001680000017e, 0x000001a0000001a1, 0x000001af000001b0, 0x000001cd000001dc,
+    0x000001de000001e3, 0x000001e6000001f0, 0x000001f4000001f5, 0x000001f80000021b,
+    0x0000021e0000021f, 0x0000022600000233, 0x000003000000034e, 0x000003500000036f,
+    0x0000037400000374, 0x0000037e0000037e, 0x000003850000038a, 0x0000038c0000038c,
+    0x0000038e00000390, 0x000003aa000003b0, 0x000003ca000003ce, 0x000003d3000003d4,
+    0x0000040000000401, 0x0000040300000403, 0x0000040700000407, 0x0000040c0000040e,
+    0x0000041900000419, 0x0000043900000439, 0x0000045000000451, 0x0000045300000453,
+    0x0000045700000457, 0x0000045c0000045e, 0x0000047600000477, 0x0000048300000487,
+    0x000004c1000004c2, 0x000004d0000004d3, 0x000004d6000004d7, 0x000004da000004df,
+    0x000004e2000004e7, 0x000004ea000004f5, 0x000004f8000004f9, 0x00000591000005bd,
+    0x000005bf000005bf, 0x000005c1000005c2, 0x000005c4000005c5, 0x000005c7000005c7,
+    0x000006100000061a, 0x0000062200000626, 0x0000064b0000065f, 0x0000067000000670,
+    0x000006c0000006c0, 0x000006c2000006c2, 0x000006d3000006d3, 0x000006d6000006dc,
+    0x000006df000006e4, 0x000006e7000006e8, 0x000006ea000006ed, 0x0000071100000711,
+    0x000007300000074a, 0x000007eb000007f3, 0x000007fd000007fd, 0x0000081600000819,
+    0x0000081b00000823, 0x0000082500000827, 0x000008290000082d, 0x000008590000085b,
+    0x000008980000089f, 0x000008ca000008e1, 0x000008e3000008ff, 0x0000092900000929,
+    0x0000093100000931, 0x0000093400000934, 0x0000093c0000093c, 0x0000094d0000094d,
+    0x0000095100000954, 0x000009580000095f, 0x000009bc000009bc, 0x000009cb000009cd,
+    0x000009dc000009dd, 0x000009df000009df, 0x000009fe000009fe, 0x00000a3300000a33,
+    0x00000a3600000a36, 0x00000a3c00000a3c, 0x00000a4d00000a4d, 0x00000a5900000a5b,
+    0x00000a5e00000a5e, 0x00000abc00000abc, 0x00000acd00000acd, 0x00000b3c00000b3c,
+    0x00000b4800000b48, 0x00000b4b00000b4d, 0x00000b5c00000b5d, 0x00000b9400000b94,
+    0x00000bca00000bcd, 0x00000c3c00000c3c, 0x00000c4800000c48, 0x00000c4d00000c4d,
+    0x00000c5500000c56, 0x00000cbc00000cbc, 0x00000cc000000cc0, 0x00000cc700000cc8,
+    0x00000cca00000ccb, 0x00000ccd00000ccd, 0x00000d3b00000d3c, 0x00000d4a00000d4d,
+    0x00000dca00000dca, 0x00000dda00000dda, 0x00000ddc00000dde, 0x00000e3800000e3a,
+    0x00000e4800000e4b, 0x00000eb800000eba, 0x00000ec800000ecb, 0x00000f1800000f19,
+    0x00000f3500000f35, 0x00000f3700000f37, 0x00000f3900000f39, 0x00000f4300000f43,
+    0x00000f4d00000f4d, 0x00000f5200000f52, 0x00000f5700000f57, 0x00000f5c00000f5c,
+    0x00000f6900000f69, 0x00000f7100000f76, 0x00000f7800000f78, 0x00000f7a00000f7d,
+    0x00000f8000000f84, 0x00000f8600000f87, 0x00000f9300000f93, 0x00000f9d00000f9d,
+    0x00000fa200000fa2, 0x00000fa700000fa7, 0x00000fac00000fac, 0x00000fb900000fb9,
+    0x00000fc600000fc6, 0x0000102600001026, 0x0000103700001037, 0x000010390000103a,
+    0x0000108d0000108d, 0x0000135d0000135f, 0x0000171400001715, 0x0000173400001734,
+    0x000017d2000017d2, 0x000017dd000017dd, 0x000018a9000018a9, 0x000019390000193b,
+    0x00001a1700001a18, 0x00001a6000001a60, 0x00001a7500001a7c, 0x00001a7f00001a7f,
+    0x00001ab000001abd, 0x00001abf00001ace, 0x00001b0600001b06, 0x00001b0800001b08,
+    0x00001b0a00001b0a, 0x00001b0c00001b0c, 0x00001b0e00001b0e, 0x00001b1200001b12,
+    0x00001b3400001b34, 0x00001b3b00001b3b, 0x00001b3d00001b3d, 0x00001b4000001b41,
+    0x00001b4300001b44, 0x00001b6b00001b73, 0x00001baa00001bab, 0x00001be600001be6,
+    0x00001bf200001bf3, 0x00001c3700001c37, 0x00001cd000001cd2, 0x00001cd400001ce0,
+    0x00001ce200001ce8, 0x00001ced00001ced, 0x00001cf400001cf4, 0x00001cf800001cf9,
+    0x00001dc000001e99, 0x00001e9b00001e9b, 0x00001ea000001ef9, 0x00001f0000001f15,
+    0x00001f1800001f1d, 0x00001f2000001f45, 0x00001f4800001f4d, 0x00001f5000001f57,
+    0x00001f5900001f59, 0x00001f5b00001f5b, 0x00001f5d00001f5d, 0x00001f5f00001f7d,
+    0x00001f8000001fb4, 0x00001fb600001fbc, 0x00001fbe00001fbe, 0x00001fc100001fc4,
+    0x00001fc600001fd3, 0x00001fd600001fdb, 0x00001fdd00001fef, 0x00001ff200001ff4,
+    0x00001ff600001ffd, 0x0000200000002001, 0x000020d0000020dc, 0x000020e1000020e1,
+    0x000020e5000020f0, 0x0000212600002126, 0x0000212a0000212b, 0x0000219a0000219b,
+    0x000021ae000021ae, 0x000021cd000021cf, 0x0000220400002204, 0x0000220900002209,
+    0x0000220c0000220c, 0x0000222400002224, 0x0000222600002226, 0x0000224100002241,
+    0x0000224400002244, 0x0000224700002247, 0x0000224900002249, 0x0000226000002260,
+    0x0000226200002262, 0x0000226d00002271, 0x0000227400002275, 0x0000227800002279,
+    0x0000228000002281, 0x0000228400002285, 0x0000228800002289, 0x000022ac000022af,
+    0x000022e0000022e3, 0x000022ea000022ed, 0x000023290000232a, 0x00002adc00002adc,
+    0x00002cef00002cf1, 0x00002d7f00002d7f, 0x00002de000002dff, 0x0000302a0000302f,
+    0x0000304c0000304c, 0x0000304e0000304e, 0x0000305000003050, 0x0000305200003052,
+    0x0000305400003054, 0x0000305600003056, 0x0000305800003058, 0x0000305a0000305a,
+    0x0000305c0000305c, 0x0000305e0000305e, 0x0000306000003060, 0x0000306200003062,
+    0x0000306500003065, 0x0000306700003067, 0x0000306900003069, 0x0000307000003071,
+    0x0000307300003074, 0x0000307600003077, 0x000030790000307a, 0x0000307c0000307d,
+    0x0000309400003094, 0x000030990000309a, 0x0000309e0000309e, 0x000030ac000030ac,
+    0x000030ae000030ae, 0x000030b0000030b0, 0x000030b2000030b2, 0x000030b4000030b4,
+    0x000030b6000030b6, 0x000030b8000030b8, 0x000030ba000030ba, 0x000030bc000030bc,
+    0x000030be000030be, 0x000030c0000030c0, 0x000030c2000030c2, 0x000030c5000030c5,
+    0x000030c7000030c7, 0x000030c9000030c9, 0x000030d0000030d1, 0x000030d3000030d4,
+    0x000030d6000030d7, 0x000030d9000030da, 0x000030dc000030dd, 0x000030f4000030f4,
+    0x000030f7000030fa, 0x000030fe000030fe, 0x0000a66f0000a66f, 0x0000a6740000a67d,
+    0x0000a69e0000a69f, 0x0000a6f00000a6f1, 0x0000a8060000a806, 0x0000a82c0000a82c,
+    0x0000a8c40000a8c4, 0x0000a8e00000a8f1, 0x0000a92b0000a92d, 0x0000a9530000a953,
+    0x0000a9b30000a9b3, 0x0000a9c00000a9c0, 0x0000aab00000aab0, 0x0000aab20000aab4,
+    0x0000aab70000aab8, 0x0000aabe0000aabf, 0x0000aac10000aac1, 0x0000aaf60000aaf6,
+    0x0000abed0000abed, 0x0000ac000000d7a3, 0x0000f9000000fa0d, 0x0000fa100000fa10,
+    0x0000fa120000fa12, 0x0000fa150000fa1e, 0x0000fa200000fa20, 0x0000fa220000fa22,
+    0x0000fa250000fa26, 0x0000fa2a0000fa6d, 0x0000fa700000fad9, 0x0000fb1d0000fb1f,
+    0x0000fb2a0000fb36, 0x0000fb380000fb3c, 0x0000fb3e0000fb3e, 0x0000fb400000fb41,
+    0x0000fb430000fb44, 0x0000fb460000fb4e, 0x0000fe200000fe2f, 0x000101fd000101fd,
+    0x000102e0000102e0, 0x000103760001037a, 0x00010a0d00010a0d, 0x00010a0f00010a0f,
+    0x00010a3800010a3a, 0x00010a3f00010a3f, 0x00010ae500010ae6, 0x00010d2400010d27,
+    0x00010eab00010eac, 0x00010f4600010f50, 0x00010f8200010f85, 0x0001104600011046,
+    0x0001107000011070, 0x0001107f0001107f, 0x0001109a0001109a, 0x0001109c0001109c,
+    0x000110ab000110ab, 0x000110b9000110ba, 0x0001110000011102, 0x0001112e0001112f,
+    0x0001113300011134, 0x0001117300011173, 0x000111c0000111c0, 0x000111ca000111ca,
+    0x0001123500011236, 0x000112e9000112ea, 0x0001133b0001133c, 0x0001134b0001134d,
+    0x000113660001136c, 0x0001137000011374, 0x0001144200011442, 0x0001144600011446,
+    0x0001145e0001145e, 0x000114bb000114bc, 0x000114be000114be, 0x000114c2000114c3,
+    0x000115ba000115bb, 0x000115bf000115c0, 0x0001163f0001163f, 0x000116b6000116b7,
+    0x0001172b0001172b, 0x000118390001183a, 0x0001193800011938, 0x0001193d0001193e,
+    0x0001194300011943, 0x000119e0000119e0, 0x00011a3400011a34, 0x00011a4700011a47,
+    0x00011a9900011a99, 0x00011c3f00011c3f, 0x00011d4200011d42, 0x00011d4400011d45,
+    0x00011d9700011d97, 0x00016af000016af4, 0x00016b3000016b36, 0x00016ff000016ff1,
+    0x0001bc9e0001bc9e, 0x0001d15e0001d169, 0x0001d16d0001d172, 0x0001d17b0001d182,
+    0x0001d1850001d18b, 0x0001d1aa0001d1ad, 0x0001d1bb0001d1c0, 0x0001d2420001d244,
+    0x0001e0000001e006, 0x0001e0080001e018, 0x0001e01b0001e021, 0x0001e0230001e024,
+    0x0001e0260001e02a, 0x0001e1300001e136, 0x0001e2ae0001e2ae, 0x0001e2ec0001e2ef,
+    0x0001e8d00001e8d6, 0x0001e9440001e94a, 0x0002f8000002fa1d,
+};
+
+// UTF-8 lead bytes (bit b of word b / 64) whose code points are all safe
+inline constexpr std::uint64_t nfc_safe_leads[4] = {0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xfffe7bf0443b8fff};
+inline constexpr std::uint64_t nfd_safe_leads[4] = {0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xfffe43f044300e07};
+
+} // namespace zuu::unicode::detail
@@ -6,8 +6,27 @@
  */
 
 #include <zuu/fstring.hpp>
+#include <zuu/stream.hpp>
+#include <zuu/fuzzy.hpp>
+#include <zuu/dedup.hpp>
+#include <zuu/rolling.hpp>
+#include <zuu/suffix.hpp>
+#include <zuu/unicode.hpp>
+
+#define ZUU_ALLOC_AUDIT_MAIN
+#include <zuu/testing/alloc_audit.hpp>
+
 #include <iostream>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdio>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 using namespace zuu;
 using namespace zuu::str;
@@ -32,9 +51,17 @@ int tests_failed = 0;
     } \
     void test_##name()
 
+// A TEST whose body must not allocate: the "no heap" guarantee
+#define NOALLOC_TEST(name) \
+    void test_##name##_body(); \
+    TEST(name) { \
+        ZUU_EXPECT_NO_ALLOC { test_##name##_body(); } \
+    } \
+    void test_##name##_body()
+
 // ==================== Core Tests ====================
 
-TEST(basic_construction) {
+NOALLOC_TEST(basic_construction) {
     fstring<32> s1;
     assert(s1.empty());
     
@@ -46,7 +73,7 @@ TEST(basic_construction) {
     assert(s3 == "world");
 }
 
-TEST(concatenation) {
+NOALLOC_TEST(concatenation) {
     fstring<32> s1 = "hello";
     fstring<32> s2 = "world";
     
@@ -57,7 +84,87 @@ TEST(concatenation) {
     assert(s1 == "hello!");
 }
 
-TEST(element_access) {
+NOALLOC_TEST(result_capacity_policy) {
+    fstring<10> a = "hello";
+    fstring<10> b = "world";
+    
+    // Rounded to a size class, literal terminators are not counted
+    auto ab = a + b;
+    static_assert(decltype(ab)::capacity == 24);
+    auto a_lit = a + "!";
+    static_assert(decltype(a_lit)::capacity == 16);
+    assert(a_lit == "hello!");
+    
+    // Growth is capped by the ceiling (global default or per call)
+    auto big = fstring<4096>{} + fstring<4096>{};
+    static_assert(decltype(big)::capacity == meta::default_capacity_ceiling::value);
+    auto capped = fstring<100>{}.concat(fstring<100>{}, meta::capacity_ceiling<128>{});
+    static_assert(decltype(capped)::capacity == 128);
+    
+    auto joined = join(split("a,b,c"_fs, ','), '-', meta::capacity_ceiling<512>{});
+    static_assert(decltype(joined)::capacity == 512);
+    assert(joined == "a-b-c");
+}
+
+NOALLOC_TEST(storage_layout) {
+    using policy = storage_policy<char, 32>;
+    static_assert(alignof(fstring<32>) >= policy::alignment);
+    static_assert(policy::length * sizeof(char) % policy::alignment == 0);
+    
+    // Stale bytes past size() never take part in comparison or search
+    fstring<32> a = "abcdefghijklmnopqrstuvwxyz";
+    fstring<32> b = "abcdefghijklmnop";
+    a.resize(16);
+    assert(a == b);
+    assert(!(a < b) && !(b < a));
+    assert(a.find('q') == fstring<32>::npos);
+    assert(a.find('p') == 15);
+    assert(a.find('p', 15) == 15);
+    assert(a.find('a', 1) == fstring<32>::npos);
+    
+    b.pop_back();
+    assert(a != b);
+    assert(b < a);
+}
+
+NOALLOC_TEST(cstring_ingestion) {
+    // Every start offset and length around the 16-byte block boundaries
+    char buffer[80];
+    for (std::size_t offset = 0; offset < 16; ++offset) {
+        for (std::size_t len = 0; len < 40; ++len) {
+            std::fill(std::begin(buffer), std::end(buffer), 'x');
+            buffer[offset + len] = '\0';
+            const char* src = buffer + offset;
+            
+            assert(simd::strnlen(src) == len);
+            assert(simd::strnlen(src, 7) == std::min<std::size_t>(len, 7));
+            
+            fstring<24> s(src);
+            assert(s.size() == std::min<std::size_t>(len, 24));
+            assert(s.c_str()[s.size()] == '\0');
+        }
+    }
+    
+    const char* none = nullptr;
+    assert(fstring<8>(none).empty());
+    assert(simd::strnlen(none) == 0);
+    
+    // Needles longer than the haystack are rejected without a full scan
+    fstring<16> path = "/usr/local/bin";
+    const char* prefix = "/usr/";
+    const char* suffix = "/bin";
+    const char* longer = "/usr/local/bin/and/more";
+    assert(path.starts_with(prefix) && path.ends_with(suffix));
+    assert(!path.starts_with(longer) && !path.ends_with(longer));
+    assert(path.find("local") == 5);
+    assert(path.find(longer) == fstring<16>::npos);
+    assert(count(path, "/") == 3);
+    
+    static_assert(fstring<8>(static_cast<const char*>("constexpr")).size() == 8);
+    static_assert(simd::strnlen("abc") == 3);
+}
+
+NOALLOC_TEST(element_access) {
     fstring<32> s = "test";
     assert(s[0] == 't');
     assert(s.front() == 't');
@@ -67,7 +174,7 @@ TEST(element_access) {
 
 // ==================== Trim Tests ====================
 
-TEST(trim_operations) {
+NOALLOC_TEST(trim_operations) {
     auto s1 = "  hello  "_sfs | trim;
     assert(s1 == "hello");
     
@@ -78,14 +185,14 @@ TEST(trim_operations) {
     assert(s3 == "  hello");
 }
 
-TEST(trim_piping) {
+NOALLOC_TEST(trim_piping) {
     auto result = "  TEST  "_sfs | trim | to_lower;
     assert(result == "test");
 }
 
 // ==================== Case Tests ====================
 
-TEST(case_conversion) {
+NOALLOC_TEST(case_conversion) {
     auto lower = to_lower("HELLO"_sfs);
     assert(lower == "hello");
     
@@ -96,95 +203,603 @@ TEST(case_conversion) {
     assert(title == "Hello World");
 }
 
-TEST(case_piping) {
+NOALLOC_TEST(case_piping) {
     auto result = "  hello  "_sfs | trim | to_upper;
     assert(result == "HELLO");
 }
 
-TEST(case_insensitive_compare) {
+NOALLOC_TEST(case_insensitive_compare) {
     fstring<32> s1 = "Hello";
     fstring<32> s2 = "HELLO";
     assert(equals_ignore_case(s1, s2));
 }
 
+// ==================== Reverse Tests ====================
+
+template <typename CharT>
+void check_reverse_for() {
+    for (std::size_t len = 0; len < 100; ++len) {
+        basic_fstring<CharT, 128> s;
+        for (std::size_t i = 0; i < len; ++i) s.push_back(CharT('!' + i));
+        
+        std::basic_string<CharT> expected(s.data(), s.size());
+        std::reverse(expected.begin(), expected.end());
+        
+        const std::size_t k = len / 3 + 1;
+        std::basic_string<CharT> rotated = expected;
+        if (len != 0) std::rotate(rotated.begin(), rotated.begin() + k % len, rotated.end());
+        
+        ZUU_EXPECT_NO_ALLOC {
+            auto reversed = s | str::reverse;
+            assert(reversed == std::basic_string_view<CharT>(expected));
+            str::reverse_in_place(s);
+            assert(s == reversed);
+            
+            assert((reversed | str::rotate(k)) == std::basic_string_view<CharT>(rotated));
+            str::rotate_in_place(reversed, k);
+            assert(reversed == std::basic_string_view<CharT>(rotated));
+        }
+    }
+}
+
+TEST(reverse_and_rotate) {
+    check_reverse_for<char>();
+    check_reverse_for<char16_t>();
+    check_reverse_for<char32_t>();
+    
+    assert(("a  big cat"_sfs | reverse_words) == "cat big  a");
+    assert((std::string_view{" one two "} | reverse_words) == " two one ");
+    
+    std::string words = "first second third";
+    ZUU_EXPECT_NO_ALLOC { reverse_words_in_place(words); }
+    assert(words == "third second first");
+    
+    // A shorter result keeps the start of the reversed string
+    assert(str::reverse.into<fstring<3>>("abcdef"_sfs) == "fed");
+    assert(str::rotate.into<fstring<3>>("abcdef"_sfs, 4) == "efa");
+    
+    static_assert(("abc"_fs | str::reverse) == "cba");
+    
+    // rsplit finds delimiters right to left without reversing anything
+    auto tail = rsplit.operator()<fstring<32>, 2>("a,b,,c,d"_sfs, ',');
+    assert(tail.size() == 2 && tail[0] == "c" && tail[1] == "d");
+    assert("a/b/c"_sfs .rfind('/') == 3);
+    assert("a/b/c"_sfs .rfind('/', 2) == 1);
+}
+
+// ==================== Statistics Tests ====================
+
+template <typename CharT>
+void check_stats_for() {
+    // Every code unit value below 256 plus some wide ones (including units
+    // with the top bit set), at lengths around the block and fold sizes
+    auto check = [](std::size_t len) {
+        std::basic_string<CharT> text;
+        for (std::size_t i = 0; i < len; ++i) text.push_back(static_cast<CharT>((i * 37) % 256));
+        if constexpr (sizeof(CharT) > 1) {
+            text.push_back(static_cast<CharT>(0x3042));
+            text.push_back(static_cast<CharT>(~CharT{}));
+            text.push_back(static_cast<CharT>(~CharT{} - 'a'));
+        }
+        
+        char_class_counts expected;
+        expected.total = text.size();
+        for (const CharT ch : text) {
+            const auto u = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<CharT>>(ch));
+            if (u >= 0x80) { ++expected.non_ascii; continue; }
+            ++expected.ascii;
+            if (u >= '0' && u <= '9') ++expected.digit;
+            if ((u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z')) ++expected.alpha;
+            if (u == ' ' || (u >= 9 && u <= 13)) ++expected.space;
+            if (u < 32 || u == 127) ++expected.control;
+        }
+        
+        ZUU_EXPECT_NO_ALLOC {
+            assert((text | char_classes) == expected);
+            
+            const auto full = text | stats;
+            assert(full.classes == expected);
+            std::size_t tabulated = 0;
+            for (const auto n : full.histogram) tabulated += n;
+            assert(tabulated == len);
+        }
+    };
+    
+    for (std::size_t len = 0; len < 300; len += 7) check(len);
+    check(255 * 16 + 5);
+    check(10000);
+}
+
+TEST(text_statistics) {
+    check_stats_for<char>();
+    check_stats_for<char16_t>();
+    check_stats_for<char32_t>();
+    
+    auto s = "id=42, name=\"x\"\n"_sfs | stats;
+    assert(s.histogram['='] == 2);
+    assert(s.classes.digit == 2);
+    assert(s.has_control() && s.is_ascii());
+    assert(s.classes.total == 16 && s.classes.ratio(s.classes.digit) == 2.0 / 16);
+    
+    assert(!(std::string_view{"caf\xc3\xa9"} | char_classes).is_ascii());
+    static_assert(("abc123"_fs | char_classes).digit == 3);
+}
+
+// ==================== Streaming Tests ====================
+
+TEST(stream_pipeline) {
+    const std::string_view text = "  alpha,beta \n# comment\r\n\n gamma \rdelta,epsilon,zeta";
+    
+    auto upper = stream::memory_lines<32>(text)
+        | stream::transform(trim | to_upper)
+        | stream::filter([](const auto& line) { return !line.starts_with("#"); })
+        | stream::flat_map(split(','))
+        | stream::collect;
+    assert(upper.size() == 6);
+    assert(upper[0] == "ALPHA" && upper[1] == "BETA" && upper[2] == "GAMMA" && upper[5] == "ZETA");
+    
+    assert((stream::memory_lines<32>(text) | stream::take(2) | stream::count) == 2);
+    
+    // File source with a chunk smaller than a line: lines span chunk reads
+    std::FILE* file = std::tmpfile();
+    assert(file);
+    const std::size_t written = stream::memory_lines<64>(text) | stream::write_to(file, 8);
+    assert(written == 4);
+    std::rewind(file);
+    
+    std::size_t n = 0;
+    auto expected = stream::memory_lines<64>(text) | stream::collect;
+    for (const auto& line : stream::file_lines<64>(file, 5)) {
+        assert(n < expected.size() && line == expected[n]);
+        ++n;
+    }
+    assert(n == expected.size());
+    
+    // Long lines are truncated to the record capacity
+    std::rewind(file);
+    auto short_lines = stream::file_lines<4>(file, 3) | stream::collect;
+    assert(short_lines.size() == 4 && short_lines[0] == "  al" && short_lines[3] == "delt");
+    std::fclose(file);
+    
+    assert((stream::file_lines("/nonexistent/zuu-stream-test") | stream::count) == 0);
+    
+    // A rebuilt pipeline reuses the frames of the previous one, so it
+    // does not touch the heap
+    const std::size_t reused = stream::frame_pool::local().reused();
+    ZUU_EXPECT_NO_ALLOC {
+        assert((stream::memory_lines<32>(text) | stream::transform(trim) | stream::count) == 4);
+    }
+    assert(stream::frame_pool::local().reused() > reused);
+}
+
+TEST(stream_parallel_pipeline) {
+    using record = fstring<32>;
+    
+    for (const auto mode : {stream::stage_mode::serial_in_order, stream::stage_mode::parallel}) {
+        std::size_t produced = 0;
+        std::size_t expected_next = 0;
+        bool in_order = true;
+        std::size_t unordered = 0;
+        
+        auto chain =
+            stream::make_stage<void, record>(stream::stage_mode::serial_in_order, [&](stream::flow_control& fc) {
+                if (produced == 10000) fc.stop();
+                record r = "id-";
+                r += to_fstring(produced++);
+                return r;
+            })
+            & stream::make_stage<record, record>(mode, [](record r) { return r | to_upper; })
+            & stream::make_stage<record, record>(stream::stage_mode::serial_out_of_order, [&](record r) {
+                ++unordered;
+                return r;
+            })
+            & stream::make_stage<record, void>(stream::stage_mode::serial_in_order, [&](const record& r) {
+                record expected = "ID-";
+                expected += to_fstring(expected_next++);
+                in_order = in_order && r == expected;
+            });
+        
+        const std::size_t n = stream::run_pipeline(chain, {.threads = 4, .tokens = 3, .batch = 7});
+        assert(n == 10000 && expected_next == 10000 && unordered == 10000);
+        assert(in_order);
+    }
+    
+    // A throwing stage stops the input; the exception reaches the caller
+    std::atomic<std::size_t> seen{0};
+    bool thrown = false;
+    try {
+        std::size_t i = 0;
+        stream::run_pipeline(
+            stream::make_stage<void, std::size_t>(stream::stage_mode::serial_in_order,
+                                                  [&](stream::flow_control&) { return i++; })
+            & stream::make_stage<std::size_t, void>(stream::stage_mode::parallel, [&](std::size_t v) {
+                ++seen;
+                if (v == 500) throw std::runtime_error("bad record");
+            }),
+            {.threads = 3, .batch = 16});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown && seen < 100000);
+}
+
+TEST(stream_parallel_split) {
+    // Quoted fields hold delimiters and newlines, so naive cuts land inside records
+    std::string csv;
+    for (int i = 0; i < 2000; ++i) {
+        csv += std::to_string(i);
+        csv += i % 3 == 0 ? ",\"multi\nline, \"\"quoted\"\"\"\n" : ",plain\n";
+        if (i % 7 == 0) csv += "\n";
+    }
+    
+    // Byte-at-a-time reference split
+    auto sequential = [&](const stream::split_options& options) {
+        std::vector<std::string_view> out;
+        std::size_t start = 0;
+        bool in_quotes = false;
+        for (std::size_t i = 0; i <= csv.size(); ++i) {
+            if (i < csv.size() && options.quote_aware && csv[i] == '"') in_quotes = !in_quotes;
+            if (i == csv.size() || (csv[i] == '\n' && !in_quotes)) {
+                if (i != start || (options.keep_empty && i < csv.size())) {
+                    out.push_back(std::string_view(csv).substr(start, i - start));
+                }
+                start = i + 1;
+            }
+        }
+        return out;
+    };
+    
+    for (const bool quoted : {false, true}) {
+        for (const std::size_t threads : {1, 3, 8, 64}) {
+            const stream::split_options options{
+                .quote_aware = quoted, .keep_empty = quoted, .threads = threads, .min_region = 1};
+            const auto expected = sequential(options);
+            
+            std::vector<std::string_view> ordered;
+            for (const auto& region : stream::split_records(csv, options)) {
+                ordered.insert(ordered.end(), region.begin(), region.end());
+            }
+            assert(ordered == expected);
+            
+            std::atomic<std::size_t> unordered{0};
+            stream::for_each_record(csv, [&](std::size_t, std::string_view) { ++unordered; }, options);
+            assert(unordered == expected.size());
+        }
+    }
+    
+    const auto rows = stream::split_records(csv, {.quote_aware = true, .threads = 4, .min_region = 1});
+    assert(rows.size() == 4 && rows[0][0] == "0,\"multi\nline, \"\"quoted\"\"\"");
+    assert(stream::split_records("", {}).size() == 1);
+}
+
+TEST(stream_mapped_file) {
+    const char* path = "zuu_mapped_file_test.txt";
+    std::FILE* out = std::fopen(path, "wb");
+    assert(out);
+    std::string text;
+    for (int i = 0; i < 5000; ++i) text += "line " + std::to_string(i) + (i % 2 ? "\r\n" : "\n");
+    text += "no newline";
+    std::fwrite(text.data(), 1, text.size(), out);
+    std::fclose(out);
+    
+    {
+        stream::mapped_file file(path);
+        assert(file && file.size() == text.size() && file.view() == text);
+        
+        std::size_t n = 0;
+        std::string_view last;
+        for (const std::string_view line : stream::mapped_lines(file)) {
+            last = line;
+            ++n;
+        }
+        assert(n == 5001 && last == "no newline");
+        
+        stream::mapped_file moved = std::move(file);
+        assert(!file && moved.view() == text);
+    }
+    std::remove(path);
+    
+    stream::mapped_file missing("/nonexistent/zuu-mapped-file");
+    assert(!missing && missing.size() == 0 && missing.view().empty());
+    
+    // Non-regular input is read to its end instead of mapped
+    std::FILE* tmp = std::tmpfile();
+    assert(tmp);
+    std::fputs("a\nb\n", tmp);
+    std::fflush(tmp);
+    std::rewind(tmp);
+    stream::mapped_file piped(fileno(tmp));
+    assert(piped && piped.view() == "a\nb\n");
+    std::fclose(tmp);
+}
+
+TEST(pipe_profiler) {
+    auto clean = profiled("csv_clean", trim | to_lower | split(','));
+    fstring<64> line = "  Alpha,BETA,Gamma  ";
+    
+    auto parts = line | clean;
+    assert(parts.size() == 3 && parts[0] == "alpha" && parts[2] == "gamma");
+    for (int i = 0; i < 9; ++i) assert((line | clean).size() == 3);
+    
+    // Disabled: the pipe itself comes back and nothing is recorded
+    static_assert(std::is_same_v<decltype(profiled("x", trim)), std::remove_cvref_t<decltype(trim)>> ==
+                  !profile::enabled);
+    if constexpr (!profile::enabled) {
+        assert(profile::snapshot().empty());
+        return;
+    }
+    
+    auto find_stage = [](std::string_view name) {
+        for (const auto& s : profile::snapshot()) {
+            if (s.name == name) return s;
+        }
+        return profile::stage_stats{};
+    };
+    
+    const auto whole = find_stage("csv_clean");
+    const auto first = find_stage("csv_clean/trim");
+    const auto last = find_stage("csv_clean/split_char");
+    assert(whole.calls == 10 && first.calls == 10 && last.calls == 10);
+    assert(first.bytes_in == 10 * line.size() && first.bytes_out == 10 * 16);
+    assert(last.bytes_out == 10 * 14);  // separators are dropped
+    assert(whole.cycles >= first.cycles);
+    
+    // Repeated stages are told apart
+    auto twice = profiled("twice", trim | to_upper | trim);
+    assert(("  x  "_sfs | twice) == "X");
+    assert(find_stage("twice/trim").calls == 1 && find_stage("twice/trim#2").calls == 1);
+    
+    profile::set_tracing(true);
+    (void)(line | clean);
+    profile::set_tracing(false);
+    
+    std::FILE* out = std::tmpfile();
+    assert(out);
+    assert(profile::write_chrome_trace(out) == 4);  // the chain and its three stages
+    std::rewind(out);
+    char head[16] = {};
+    assert(std::fread(head, 1, 15, out) == 15 && std::string_view(head) == "{\"traceEvents\":");
+    std::fclose(out);
+    
+    profile::reset();
+    assert(find_stage("csv_clean").calls == 0);
+}
+
+TEST(allocation_audit) {
+    assert(testing::active());
+    
+    testing::alloc_scope scope;
+    std::string owned(64, 'x');
+    assert(scope.count() == 1 && scope.bytes() >= 64);
+    
+    // The checked block fails as soon as it touches the heap...
+    bool caught = false;
+    try {
+        ZUU_EXPECT_NO_ALLOC { owned += owned; }
+    } catch (const testing::alloc_violation&) {
+        caught = true;
+    }
+    assert(caught);
+    
+    // An exception thrown inside the block passes through unchanged
+    caught = false;
+    try {
+        ZUU_EXPECT_NO_ALLOC {
+            fstring<4> s = "abc";
+            (void)s.at(3);
+        }
+    } catch (const std::out_of_range&) {
+        caught = true;
+    }
+    assert(caught);
+    
+    // Counters are per thread: only the spawning thread's own state counts
+    testing::alloc_scope here;
+    std::size_t elsewhere = 0;
+    std::thread([&elsewhere] {
+        testing::alloc_scope there;
+        std::vector<std::string> lines(8, std::string(64, 'y'));
+        elsewhere = there.count();
+    }).join();
+    assert(elsewhere >= 8 && here.count() < elsewhere);
+}
+
 // ==================== Split Tests ====================
 
-TEST(split_char) {
+NOALLOC_TEST(split_char) {
     auto parts = split("a,b,c"_sfs, ',');
-    assert(parts.count == 3);
+    assert(parts.size() == 3);
     assert(parts[0] == "a");
     assert(parts[1] == "b");
     assert(parts[2] == "c");
 }
 
-TEST(split_string) {
+NOALLOC_TEST(split_string) {
     auto parts = split_by("a::b::c"_sfs, "::"_sfs);
-    assert(parts.count == 3);
+    assert(parts.size() == 3);
     assert(parts[0] == "a");
     assert(parts[1] == "b");
     assert(parts[2] == "c");
 }
 
-TEST(split_lines) {
+NOALLOC_TEST(split_lines) {
     auto parts = "line1\nline2\nline3"_fs | split_lines;
-    assert(parts.count == 3);
+    assert(parts.size() == 3);
     assert(parts[0] == "line1");
     assert(parts[1] == "line2");
     assert(parts[2] == "line3");
 }
 
-TEST(split_whitespace) {
+NOALLOC_TEST(split_whitespace) {
     auto parts = "a  b\tc\nd"_fs | split_whitespace;
-    assert(parts.count == 4);
+    assert(parts.size() == 4);
     assert(parts[0] == "a");
     assert(parts[1] == "b");
     assert(parts[2] == "c");
     assert(parts[3] == "d");
 }
 
-TEST(split_piping) {
+NOALLOC_TEST(split_piping) {
     auto parts = "  a , b , c  "_fs | trim | split(',');
-    assert(parts.count == 3);
+    assert(parts.size() == 3);
 }
 
-TEST(partition) {
+NOALLOC_TEST(partition) {
     auto result = partition("key=value"_sfs, '=');
     assert(result.found);
     assert(result.first == "key");
     assert(result.second == "value");
 }
 
-TEST(rsplit) {
+NOALLOC_TEST(rsplit) {
     auto parts = rsplit("a.b.c.d"_sfs, '.');
-    assert(parts.count == 4);
+    assert(parts.size() == 4);
     assert(parts[0] == "a");
     assert(parts[3] == "d");
 }
 
+NOALLOC_TEST(split_result_storage) {
+    inline_vector<fstring<16>, 4> parts;
+    assert(parts.empty());
+    
+    parts.emplace_back("ab", 2);
+    parts.push_back("cd"_sfs.substr<16>());
+    assert(parts.size() == 2);
+    assert(parts[1] == "cd");
+    
+    parts.pop_back();
+    assert(parts.size() == 1);
+    
+    // Only the rightmost MaxParts parts are kept
+    auto tail = rsplit_fn{}.operator()<fstring<32>, 2>("a.b.c.d"_sfs, '.');
+    assert(tail.size() == 2);
+    assert(tail[0] == "c");
+    assert(tail[1] == "d");
+}
+
+// Element copies that throw leave no leaks and a valid vector
+struct throwing_copy {
+    static inline int live = 0;
+    static inline int copies_left = 0;
+    int value;
+
+    explicit throwing_copy(int v) : value{v} { ++live; }
+    throwing_copy(const throwing_copy& other) : value{other.value} {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+        ++live;
+    }
+    ~throwing_copy() { --live; }
+};
+
+TEST(inline_vector_exception_safety) {
+    {
+        inline_vector<throwing_copy, 8> source;
+        for (int i = 0; i < 5; ++i) source.emplace_back(i);
+
+        throwing_copy::copies_left = 2;
+        bool threw = false;
+        try {
+            inline_vector<throwing_copy, 8> copy(source);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && throwing_copy::live == 5);
+
+        inline_vector<throwing_copy, 8> target;
+        target.emplace_back(42);
+        throwing_copy::copies_left = 3;
+        threw = false;
+        try {
+            target = source;
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+        assert(threw && target.size() == 3 && target[2].value == 2 && throwing_copy::live == 8);
+
+        throwing_copy::copies_left = 100;
+        target = source;
+        assert(target.size() == 5 && throwing_copy::live == 10);
+    }
+    assert(throwing_copy::live == 0);
+}
+
+NOALLOC_TEST(split_with_limit) {
+    const auto addr = "host:8080:extra"_sfs;
+    auto hp = split_n(addr, ':', 1);
+    assert(hp.size() == 2);
+    assert(hp[0] == "host");
+    assert(hp[1] == "8080:extra");
+    
+    const auto bin = "/usr/local/bin"_sfs;
+    auto path = rsplit_n(bin, '/', 1);
+    assert(path.size() == 2);
+    assert(path[0] == "/usr/local");
+    assert(path[1] == "bin");
+    
+    const auto csv = "a::b"_sfs;
+    auto fields = split_n(csv, ':');
+    assert(fields.size() == 3);
+    assert(fields[1].empty());
+
+    // Temporaries give owning parts; views give views into the source
+    auto owned = split_n("host:8080"_sfs, ':', 1);
+    static_assert(std::is_same_v<decltype(owned)::value_type, fstring<32>>);
+    assert(owned[0] == "host" && owned[1] == "8080");
+    auto base = "a/b/c"_sfs | rsplit_n('/', 1);
+    assert(base.size() == 2 && base[0] == "a/b" && base[1] == "c");
+    const std::string_view line = "k=v=w";
+    auto kv = split_n(line, '=', 1);
+    assert(kv[1].data() == line.data() + 2 && kv[1] == "v=w");
+}
+
 // ==================== Join Tests ====================
 
-TEST(join_char) {
-    fstring<16> arr[] = {"a"_sfs, "b"_sfs, "c"_sfs};
+NOALLOC_TEST(join_char) {
+    fstring<32> arr[] = {"a"_sfs, "b"_sfs, "c"_sfs};
     auto result = join(arr, ',');
     assert(result == "a,b,c");
 }
 
-TEST(join_string) {
+NOALLOC_TEST(join_string) {
     auto parts = split("a,b,c"_sfs, ',');
     auto rejoined = join(parts, ", "_sfs);
     assert(rejoined == "a, b, c");
 }
 
-TEST(join_split_roundtrip) {
+NOALLOC_TEST(join_split_roundtrip) {
     fstring<64> original = "apple,banana,cherry";
     auto parts = split(original, ',');
     auto rejoined = join(parts, ',');
     assert(original == rejoined);
 }
 
+TEST(join_into_range) {
+    std::vector<std::string> names = {"alpha", "beta", "gamma"};
+    
+    ZUU_EXPECT_NO_ALLOC {
+        fstring<32> out;
+        auto status = join_into(out, names, ", ");
+        assert(status);
+        assert(status.written == 18);
+        assert(out == "alpha, beta, gamma");
+        
+        // Overflow is reported and nothing is written
+        fstring<8> small = "x";
+        status = join_into(small, names, ',');
+        assert(!status);
+        assert(status.required == 16);
+        assert(small == "x");
+        
+        char buffer[16];
+        status = join_into(std::span<char>(buffer), names, '|');
+        assert(status);
+        assert(std::string_view(buffer, status.written) == "alpha|beta|gamma");
+    }
+}
+
 // ==================== Find Tests ====================
 
-TEST(contains_operations) {
+NOALLOC_TEST(contains_operations) {
     fstring<32> s = "hello world";
     
     assert(contains(s, 'o'));
@@ -194,7 +809,7 @@ TEST(contains_operations) {
     assert(!contains(s, "xyz"));
 }
 
-TEST(starts_ends_with) {
+NOALLOC_TEST(starts_ends_with) {
     fstring<32> s = "hello world";
     
     assert(starts_with(s, "hello"));
@@ -207,7 +822,7 @@ TEST(starts_ends_with) {
     assert(ends_with(s, 'd'));
 }
 
-TEST(find_operations) {
+NOALLOC_TEST(find_operations) {
     fstring<32> s = "hello world";
     
     auto pos1 = find(s, 'o');
@@ -220,7 +835,7 @@ TEST(find_operations) {
     assert(pos3 == 6);
 }
 
-TEST(count_operations) {
+NOALLOC_TEST(count_operations) {
     fstring<32> s = "hello world";
     
     assert(count(s, 'l') == 3);
@@ -231,7 +846,7 @@ TEST(count_operations) {
     assert(count(s, "ll") == 1);
 }
 
-TEST(find_first_of) {
+NOALLOC_TEST(find_first_of) {
     fstring<32> s = "hello world";
     
     auto pos = find_first_of(s, "aeiou");
@@ -241,39 +856,745 @@ TEST(find_first_of) {
     assert(pos2 == 7); // 'o'
 }
 
-TEST(contains_any) {
+NOALLOC_TEST(contains_any) {
     fstring<32> s = "hello";
     
     assert(contains_any(s, "aeiou"));
     assert(!contains_any(s, "xyz"));
 }
 
+TEST(generic_string_inputs) {
+    std::string owned = "  Hello, World  ";
+    std::string_view view = owned;
+    std::string_view trimmed;
+    
+    ZUU_EXPECT_NO_ALLOC {
+        assert(find(owned, "World") == 9);
+        assert(count(view, 'l') == 3);
+        assert(contains(view, "lo,"));
+        assert(find_first_of(owned, "aeiou") == 3);
+        
+        // Views stay views, owning strings keep their type
+        trimmed = view | trim;
+        assert(trimmed == "Hello, World");
+    }
+    std::string lowered = owned | trim | to_lower;
+    assert(lowered == "hello, world");
+    
+    auto parts = split(trimmed, ',');
+    assert(parts.size() == 2);
+    assert(parts[1] == " World");
+    
+    ZUU_EXPECT_NO_ALLOC {
+        auto small = to_upper.into<fstring<5>>(trimmed);
+        assert(small == "HELLO");
+    }
+}
+
+template <typename CharT>
+void check_search_for() {
+    using view = std::basic_string_view<CharT>;
+    auto fold = [](CharT ch) { return (ch >= 'A' && ch <= 'Z') ? static_cast<CharT>(ch | 0x20) : ch; };
+    
+    // Needles planted at every offset around one and two blocks, with
+    // near-misses (same first and last unit) before them
+    for (std::size_t n : {2, 3, 7, 16, 33}) {
+        std::basic_string<CharT> needle;
+        for (std::size_t i = 0; i < n; ++i) needle.push_back(static_cast<CharT>('a' + i % 26));
+        std::basic_string<CharT> miss = needle;
+        if (n > 2) miss[n / 2] = CharT('#');
+        
+        for (std::size_t at = 0; at < 70; at += 3) {
+            std::basic_string<CharT> hay(at, CharT('-'));
+            hay += miss;
+            hay += needle;
+            hay.append(5, CharT('-'));
+            const CharT* first = hay.data();
+            const CharT* last = first + hay.size();
+            
+            const auto pos = view(hay).find(view(needle));
+            const auto cut = view(hay).substr(0, hay.size() - 6).find(view(needle));  // one unit short
+            std::basic_string<CharT> upper = needle;
+            for (auto& ch : upper) ch = (ch >= 'a' && ch <= 'z') ? static_cast<CharT>(ch - 0x20) : ch;
+            
+            ZUU_EXPECT_NO_ALLOC {
+                assert(simd::search(first, last, needle.data(), n) == first + pos);
+                assert(simd::search(first, last - 6, needle.data(), n) == (cut == view::npos ? last - 6 : first + cut));
+                
+                // -i: the upper-cased needle finds the same place
+                assert(simd::search_ignore_case(first, last, upper.data(), n) == first + pos);
+                assert(simd::search(first, last, upper.data(), n) == last);
+            }
+        }
+    }
+    
+    // Only ASCII letters fold: '@' (0x40) and '`' (0x60) differ by 0x20 too
+    const CharT at_sign[] = {'x', '@'};
+    const CharT backtick[] = {'x', '`', 'y'};
+    assert(simd::search_ignore_case(backtick, backtick + 3, at_sign, 2) == backtick + 3);
+    
+    // Mixed-case haystack against a reference fold
+    std::basic_string<CharT> text;
+    for (std::size_t i = 0; i < 500; ++i) text.push_back(static_cast<CharT>("aBcDeFgXyZ@`[{"[i * 7 % 14]));
+    const CharT needle[] = {'X', 'y', 'z', '@'};
+    std::size_t expected = text.size();
+    for (std::size_t i = 0; i + 4 <= text.size() && expected == text.size(); ++i) {
+        bool same = true;
+        for (std::size_t j = 0; j < 4; ++j) same = same && fold(text[i + j]) == fold(needle[j]);
+        if (same) expected = i;
+    }
+    ZUU_EXPECT_NO_ALLOC {
+        const simd::literal_searcher<CharT> searcher(view(needle, 4), true);
+        assert(searcher(text.data(), text.data() + text.size()) == text.data() + expected);
+    }
+}
+
+TEST(substring_search) {
+    check_search_for<char>();
+    check_search_for<char16_t>();
+    check_search_for<char32_t>();
+    
+    const char* hay = "find the Needle here";
+    assert(simd::search(hay, hay + 20, "Needle", 6) == hay + 9);
+    assert(simd::search_ignore_case(hay, hay + 20, "NEEDLE", 6) == hay + 9);
+    assert(simd::search_ignore_case(hay, hay + 20, "n", 1) == hay + 2);
+    assert(simd::search(hay, hay + 20, "", 0) == hay);
+    
+    fstring<64> s = "one two three two";
+    assert(s.find("two") == 4 && s.find("two", 5) == 14 && s.find("four") == fstring<64>::npos);
+    assert(find(s, "three") == 8 && contains(s, "e t") && !contains(s, "xyz"));
+    assert(find(s, "", 17) == 17 && find(s, "", 18) == fstring<64>::npos);
+    static_assert("abcabd"_fs.find("abd") == 3);
+    static_assert(contains("hello world"_fs, "o w"));
+}
+
+NOALLOC_TEST(glob_matching) {
+    assert(matches_glob("report-2025.csv"_fs, "report-*.csv"));
+    assert(!matches_glob("report-2025.tsv"_fs, "report-*.csv"));
+    assert(matches_glob(std::string("a.b"), "?.?") && !matches_glob(std::string("ab"), "?.?"));
+    assert(matches_glob("GET /api/users/42"_fs, "GET /api/*/[0-9]*"));
+    assert(!matches_glob("GET /api/users/x"_fs, "GET /api/*/[0-9]*"));
+    assert(matches_glob("x9"_fs, "x[!a-z]") && !matches_glob("xq"_fs, "x[^a-z]"));
+    assert(matches_glob("a]"_fs, "a[]]") && matches_glob("*?"_fs, "\\*\\?"));
+    assert(matches_glob("a[b"_fs, "a[b"));          // unterminated class is literal
+    assert(matches_glob(""_fs, "*") && !matches_glob(""_fs, "?"));
+    assert(matches_glob("aaaaaaaaab"_fs, "*a*a*a*b") && !matches_glob("aaaaaaaaaa"_fs, "*a*a*a*b"));
+    
+    assert("Error: Disk Full"_fs | matches_glob_icase("*error*disk*"));
+    assert(!("Error: Disk Full"_fs | matches_glob("*error*")));
+    assert(matches_glob(std::u16string_view(u"fée.txt"), u"f?e.*"));
+    static_assert(matches_glob("main.cpp"_fs, "*.[ch]pp"));
+    
+    assert(glob_required_literal("*[0-9] GET *") == " GET ");
+    assert(glob_required_literal("ab*cdef?g") == "cdef");
+    assert(glob_required_literal("x\\*yz[abc]") == "yz");
+    assert(glob_required_literal("*?[a-z]").empty());
+    assert(glob_required_literal("[!]x]foo") == "foo" && glob_required_literal("[^]]ab") == "ab");
+
+    // Every string a pattern matches contains its literal, whatever the
+    // brackets, negations and escapes
+    std::uint64_t state = 5;
+    auto random_text = [&state](std::span<const std::string_view> pieces, std::size_t max) {
+        std::string out;
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        for (std::size_t n = (state >> 33) % (max + 1); n > 0; --n) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            out += pieces[(state >> 33) % pieces.size()];
+        }
+        return out;
+    };
+    constexpr std::string_view pattern_pieces[] = {"[", "[!", "[^", "]", "a", "b", "x", "-", "*", "?", "\\"};
+    constexpr std::string_view text_pieces[] = {"a", "b", "x", "]", "-", "!"};
+    for (int round = 0; round < 20000; ++round) {
+        const std::string pattern = random_text(pattern_pieces, 7);
+        const std::string text = random_text(text_pieces, 6);
+        if (matches_glob(text, pattern)) {
+            assert(text.find(glob_required_literal(std::string_view(pattern))) != std::string::npos);
+        }
+    }
+}
+
+TEST(natural_order) {
+    assert(natural_compare("file9"_fs, "file10") < 0 && natural_compare("file10"_fs, "file9") > 0);
+    assert(natural_compare("v1.2.10"_fs, "v1.2.9") > 0 && natural_compare("v01"_fs, "v1") == 0);
+    assert(natural_compare("img12b"_fs, "img12a") > 0 && natural_compare("x"_fs, "x0") < 0);
+    assert(natural_compare("File2"_fs, "file10") < 0 && natural_compare("file2"_fs, "File10") > 0);
+    assert(natural_compare_icase("File2"_fs, "file10") < 0 && natural_compare_icase("ABC"_fs, "abc") == 0);
+    assert(natural_compare("a-1"_fs, "a1") < 0 && natural_compare("a~"_fs, "a1") > 0);
+    assert(natural_compare(std::u16string_view(u"été 2"), std::u16string_view(u"été 11")) < 0);
+    static_assert(natural_compare("track 7"_fs, "track 07") == 0);
+
+    // Long shared prefixes take the vectorized skip, digit runs span it
+    const std::string prefix(100, 'p');
+    assert(natural_compare(prefix + "123456789012345678", prefix + "99") > 0);
+    assert(natural_compare_icase(prefix + "X5", std::string(100, 'P') + "x40") < 0);
+
+    std::vector<std::string_view> names = {"z10.txt", "z2.txt", "Z1.txt", "z1.txt", "a100", "a20", "a3b", "a3a"};
+    std::sort(names.begin(), names.end(), natural_less_icase);
+    const std::vector<std::string_view> expected = {"a3a", "a3b", "a20", "a100", "Z1.txt", "z1.txt", "z2.txt", "z10.txt"};
+    for (std::size_t i = 0; i < names.size(); ++i) assert(equals_ignore_case(names[i], expected[i]));
+
+    // Keys order like the comparison: exactly when complete, and never
+    // the other way round when cut short
+    std::uint64_t state = 11;
+    auto random_name = [&state] {
+        constexpr std::string_view alphabet = "aAbB00129._-";
+        std::string name;
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        for (std::size_t n = (state >> 61) + 1; n > 0; --n) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            name.push_back(alphabet[(state >> 33) % alphabet.size()]);
+        }
+        return name;
+    };
+    auto sign = [](int c) { return (c > 0) - (c < 0); };
+    for (int round = 0; round < 3000; ++round) {
+        const std::string a = random_name(), b = random_name();
+        const int expected_order = sign(natural_compare_icase(a, b));
+        const auto ka = natural_sort_key_icase<64>(a), kb = natural_sort_key_icase<64>(b);
+        assert(ka.complete && kb.complete);
+        assert(sign(std::memcmp(ka.bytes.data(), kb.bytes.data(), 64)) == expected_order);
+        assert(sign(std::memcmp(natural_sort_key<64>(a).bytes.data(), natural_sort_key<64>(b).bytes.data(), 64)) ==
+               sign(natural_compare(a, b)));
+
+        const auto sa = natural_sort_key_icase<6>(a), sb = natural_sort_key_icase<6>(b);
+        if (sa < sb) assert(expected_order < 0);
+        if (sb < sa) assert(expected_order > 0);
+        if (sa == sb && sa.complete && sb.complete) assert(expected_order == 0);
+    }
+
+    std::vector<fstring<16>> files;
+    for (int i = 0; i < 500; ++i) files.push_back(fstring<16>(random_name() + "v" + std::to_string(i % 37)));
+    auto by_sort = files;
+    natural_sort_icase(std::span(files));
+    assert(std::is_sorted(files.begin(), files.end(), natural_less_icase));
+    std::sort(by_sort.begin(), by_sort.end(), natural_less_icase);
+    for (std::size_t i = 0; i < files.size(); ++i) assert(natural_compare_icase(files[i], by_sort[i]) == 0);
+    natural_sort(std::span(files));
+    assert(std::is_sorted(files.begin(), files.end(), natural_less));
+}
+
+TEST(unicode_normalization) {
+    using unicode::normal_form;
+
+    // Composition and decomposition, Hangul included
+    u8fstring<32> cafe = u8"cafe\u0301 \u1100\u1161\u11A8";
+    assert(!unicode::is_nfc(cafe) && unicode::is_nfd(cafe));
+    auto status = unicode::normalize(cafe, normal_form::nfc);
+    assert(status && status.written == 9 && cafe == u8"caf\u00E9 \uAC01");
+    assert(unicode::is_nfc(cafe) && !unicode::is_nfd(cafe));
+    assert((cafe | unicode::to_nfd) == u8"cafe\u0301 \u1100\u1161\u11A8");
+
+    // Marks reorder by combining class; singletons and exclusions never compose
+    assert(unicode::to_nfd.into<std::u8string>(std::u8string_view(u8"q\u0307\u0323")) == u8"q\u0323\u0307");
+    assert(unicode::to_nfc.into<std::u8string>(std::u8string_view(u8"s\u0307\u0323")) == u8"\u1E69");
+    assert(unicode::to_nfc.into<std::u8string>(std::u8string_view(u8"\u212B \u0958")) == u8"\u00C5 \u0915\u093C");
+    assert(unicode::to_nfc.into<std::u8string>(std::u8string_view(u8"\u1100\u1161\u0301\u11A8")) ==
+           u8"\uAC00\u0301\u11A8");
+
+    // Plain char text, ASCII fast path, invalid bytes passed through
+    const std::string ascii(200, 'a');
+    assert(unicode::is_nfc(ascii) && unicode::is_nfd(ascii));
+    assert(unicode::to_nfc.into<std::string>(ascii) == ascii);
+    const std::string broken = "a\xFF" "e\xCC\x81\xC3";
+    assert(unicode::to_nfc.into<std::string>(broken) == "a\xFF\xC3\xA9\xC3");
+    assert(unicode::to_nfd.into<std::string>(std::string_view("\xC3\xA9\xE0\x80")) == "e\xCC\x81\xE0\x80");
+
+    // Truncation at a code point boundary, with the size that was needed
+    u8fstring<8> small;
+    status = unicode::normalize_into(small, std::u8string_view(u8"\uAC01\uAC01"), normal_form::nfd);
+    assert(!status && status.truncated && status.required == 18 && status.written == 6);
+    assert(small == u8"\u1100\u1161");
+    u8fstring<16> prefixed = u8"x:";
+    status = unicode::normalize_into(prefixed, std::u8string_view(u8"A\u030A"), normal_form::nfc);
+    assert(status && prefixed == u8"x:\u00C5");
+
+    // Normalizing is idempotent and the forms round-trip, over long mixed input
+    std::u8string mixed;
+    for (int i = 0; i < 40; ++i) mixed += u8"Stra\u00DFe \u00C5ngstr\u00F6m e\u0301\u0323 \uD55C\uAE00 ";
+    const auto nfd = unicode::to_nfd.into<std::u8string>(mixed);
+    const auto nfc = unicode::to_nfc.into<std::u8string>(nfd);
+    assert(unicode::is_nfd(nfd) && !unicode::is_nfc(nfd) && unicode::is_nfc(nfc));
+    assert(unicode::to_nfc.into<std::u8string>(nfc) == nfc && unicode::to_nfd.into<std::u8string>(nfc) == nfd);
+    assert(nfc.size() < nfd.size() && nfc.find(u8"\u1EB9\u0301") != std::u8string::npos);
+}
+
+// ==================== Fuzzy Tests ====================
+
+template <typename CharT>
+std::size_t reference_levenshtein(std::basic_string_view<CharT> a, std::basic_string_view<CharT> b) {
+    std::vector<std::size_t> row(b.size() + 1);
+    for (std::size_t j = 0; j <= b.size(); ++j) row[j] = j;
+    for (std::size_t i = 1; i <= a.size(); ++i) {
+        std::size_t diagonal = row[0];
+        row[0] = i;
+        for (std::size_t j = 1; j <= b.size(); ++j) {
+            const std::size_t up = row[j];
+            row[j] = std::min({up + 1, row[j - 1] + 1, diagonal + (a[i - 1] != b[j - 1])});
+            diagonal = up;
+        }
+    }
+    return row[b.size()];
+}
+
+template <typename CharT>
+void check_levenshtein_for() {
+    using view = std::basic_string_view<CharT>;
+    // Small alphabets (including units above 255 for wide types) make
+    // near matches common; some lengths cross the 64-unit word
+    std::uint64_t state = 7;
+    auto next = [&state] { return (state = state * 6364136223846793005ull + 1442695040888963407ull) >> 33; };
+    auto unit = [&next](std::size_t i) {
+        const auto base = sizeof(CharT) > 1 && (i & 1) ? 0x3041 : 'a';
+        return static_cast<CharT>(base + next() % 4);
+    };
+    
+    for (std::size_t round = 0; round < 400; ++round) {
+        const std::size_t cap = round % 8 == 0 ? 150 : 40;
+        std::basic_string<CharT> a, b;
+        for (std::size_t i = next() % cap; i > 0; --i) a.push_back(unit(i));
+        for (std::size_t i = next() % cap; i > 0; --i) b.push_back(unit(i));
+        const std::size_t expected = reference_levenshtein<CharT>(a, b);
+        const std::size_t max = next() % 12;
+        
+        ZUU_EXPECT_NO_ALLOC {
+            if (a.size() > 64 && b.size() > 64) break;  // the row fallback allocates
+            assert(fuzzy::levenshtein(view(a), view(b)) == expected);
+            assert(fuzzy::levenshtein(view(b), view(a), max) == (expected > max ? max + 1 : expected));
+            const fuzzy::basic_levenshtein_pattern<CharT> pattern{view(a)};
+            assert(pattern.distance(view(b), max) == (expected > max ? max + 1 : expected));
+        }
+        assert(fuzzy::levenshtein(view(a), view(b)) == expected);
+    }
+}
+
+TEST(fuzzy_distance) {
+    check_levenshtein_for<char>();
+    check_levenshtein_for<char16_t>();
+    check_levenshtein_for<char32_t>();
+    
+    assert(fuzzy::levenshtein("kitten", "sitting") == 3);
+    assert(fuzzy::levenshtein("kitten"_sfs, "sitting", 1) == 2);
+    assert(fuzzy::levenshtein("", "abc") == 3 && fuzzy::levenshtein("same"_sfs, "same"_sfs) == 0);
+    
+    // Arena views stay valid as chunks fill, and oversized text fits too
+    fuzzy::string_arena arena(8);
+    const std::string_view first = arena.store("abcdef");
+    const std::string_view big = arena.store("0123456789abcdef");
+    const std::string_view second = arena.store("ghij");
+    assert(first == "abcdef" && big == "0123456789abcdef" && second == "ghij");
+    assert(arena.size() == 26 && arena.chunk_count() == 3);
+}
+
+TEST(fuzzy_index) {
+    fuzzy::symspell_index symspell({.max_distance = 2});
+    fuzzy::bk_tree tree;
+    const std::pair<const char*, std::uint64_t> words[] = {
+        {"receive", 50}, {"recipe", 20}, {"relieve", 10}, {"believe", 30}, {"deceive", 5}, {"receiver", 2},
+    };
+    for (const auto& [word, frequency] : words) {
+        symspell.add(types::name_str(word), frequency);
+        tree.add(word, frequency);
+    }
+    symspell.add("receive", 1);  // duplicates merge
+    tree.add("receive"_sfs, 1);
+    symspell.build();
+    
+    for (const auto& best : {symspell.lookup("recieve", 2, 3), tree.lookup("recieve", 2, 3)}) {
+        assert(best.size() == 3);
+        assert(best[0].term == "relieve" && best[0].distance == 1);
+        assert(best[1].term == "receive" && best[1].distance == 2 && best[1].frequency == 51);
+        assert(best[2].term == "believe" && best[2].distance == 2);  // ties: more frequent first
+    }
+    assert(symspell.lookup("receive", 0).front().term == "receive");
+    assert(symspell.lookup("xyz", 2).empty() && tree.lookup("xyz", 2).empty());
+    assert(symspell.size() == 6 && tree.size() == 6);
+    
+    // Both indexes agree with a scan over a dense random vocabulary
+    std::uint64_t state = 3;
+    auto next = [&state] { return (state = state * 6364136223846793005ull + 1442695040888963407ull) >> 33; };
+    auto word = [&next](std::size_t max_len) {
+        fstring<16> w;
+        for (std::size_t n = next() % max_len; n > 0; --n) w.push_back(static_cast<char>('a' + next() % 5));
+        return w;
+    };
+    
+    std::vector<fstring<16>> vocabulary;
+    fuzzy::symspell_index dense({.max_distance = 2, .prefix_length = 5});
+    fuzzy::bk_tree dense_tree;
+    for (int i = 0; i < 600; ++i) {
+        vocabulary.push_back(word(12));
+        dense.add(vocabulary.back());
+        dense_tree.add(vocabulary.back());
+    }
+    dense.build();
+    std::sort(vocabulary.begin(), vocabulary.end());
+    vocabulary.erase(std::unique(vocabulary.begin(), vocabulary.end()), vocabulary.end());
+    
+    for (int i = 0; i < 200; ++i) {
+        const auto query = word(14);
+        for (std::size_t d = 0; d <= 2; ++d) {
+            std::size_t expected = 0;
+            for (const auto& term : vocabulary) expected += fuzzy::levenshtein(query, term, d) <= d;
+            assert(dense.lookup(query, d, 1000).size() == expected);
+            assert(dense_tree.lookup(query, d, 1000).size() == expected);
+        }
+    }
+}
+
+// Textbook Jaro-Winkler (flags, window max/2 - 1, prefix <= 4, boost above 0.7)
+double reference_jaro_winkler(std::string_view a, std::string_view b) {
+    if (a.empty() || b.empty()) return a.empty() && b.empty() ? 1.0 : 0.0;
+    const std::size_t window = std::max(a.size(), b.size()) / 2 > 0 ? std::max(a.size(), b.size()) / 2 - 1 : 0;
+    std::vector<bool> a_flag(a.size()), b_flag(b.size());
+    std::size_t m = 0;
+    for (std::size_t j = 0; j < b.size(); ++j) {
+        for (std::size_t i = j > window ? j - window : 0; i < std::min(a.size(), j + window + 1); ++i) {
+            if (!a_flag[i] && a[i] == b[j]) {
+                a_flag[i] = b_flag[j] = true;
+                ++m;
+                break;
+            }
+        }
+    }
+    if (m == 0) return 0.0;
+    std::size_t half = 0;
+    for (std::size_t i = 0, j = 0; i < a.size(); ++i) {
+        if (!a_flag[i]) continue;
+        while (!b_flag[j]) ++j;
+        half += a[i] != b[j++];
+    }
+    const double md = static_cast<double>(m);
+    const double jaro = (md / a.size() + md / b.size() + (md - half / 2) / md) / 3.0;
+    std::size_t prefix = 0;
+    while (prefix < 4 && prefix < a.size() && prefix < b.size() && a[prefix] == b[prefix]) ++prefix;
+    return jaro < 0.7 ? jaro : jaro + prefix * 0.1 * (1.0 - jaro);
+}
+
+TEST(fuzzy_similarity) {
+    auto near = [](double a, double b) { return std::abs(a - b) < 1e-3; };
+
+    ZUU_EXPECT_NO_ALLOC {
+        assert(near(fuzzy::jaro_winkler("martha", "marhta"), 0.961));
+        assert(near(fuzzy::jaro_winkler("dwayne", "duane"), 0.840));
+        assert(near(fuzzy::jaro_winkler("dixon", "dicksonx"), 0.813));
+        assert(near(fuzzy::jaro_winkler("martha"_sfs, "marhta", 0.0), 0.961));
+        assert(fuzzy::jaro_winkler("", "") == 1.0 && fuzzy::jaro_winkler("a", "") == 0.0);
+        assert(fuzzy::jaro_winkler("abc", "xyz") == 0.0);
+        assert(fuzzy::jaro_winkler("martha", "marhta", 0.97) == 0.0);  // below the cutoff
+
+        const fuzzy::jaro_winkler_scorer plain("martha", {.prefix_scale = 0.0});
+        assert(near(plain("marhta"), 0.944));  // Jaro alone
+
+        assert(near(fuzzy::ratio("kitten", "sitting"), 2.0 * 4 / 13));
+        assert(fuzzy::token_sort_ratio("new york mets", "mets new  york") == 1.0);
+        assert(fuzzy::token_set_ratio("mariners vs angels", "los angeles angels vs seattle mariners") == 1.0);
+        assert(near(fuzzy::token_set_ratio("smith john a", "john smith b"), 22.0 / 24));  // "john smith a" vs "john smith b"
+        assert(fuzzy::token_sort_ratio("a b c", "x y z w v u t s r q", 0.9) == 0.0);  // rejected by length
+    };
+
+    // Bit-parallel (<= 64 units) and scalar (longer) paths against the reference
+    std::uint64_t state = 5;
+    auto next = [&state] { return (state = state * 6364136223846793005ull + 1442695040888963407ull) >> 33; };
+    auto word = [&next](std::size_t max_len) {
+        std::string w;
+        for (std::size_t n = next() % max_len; n > 0; --n) w.push_back(static_cast<char>('a' + next() % 4));
+        return w;
+    };
+    for (int i = 0; i < 2000; ++i) {
+        const std::size_t max_len = i % 4 == 0 ? 100 : 20;
+        const std::string a = word(max_len);
+        const std::string b = word(max_len);
+        const double expected = reference_jaro_winkler(a, b);
+        assert(near(fuzzy::jaro_winkler(a, b), expected));
+        assert(fuzzy::jaro_winkler(a, b, expected - 1e-9) > 0.0 || expected == 0.0);
+        assert(fuzzy::jaro_winkler(a, b, expected + 1e-3) == 0.0);
+    }
+
+    // Batch scoring and best match
+    const std::vector<types::name_str> candidates = {"jon smith", "john smyth", "smith john", "jane doe", "j smith"};
+    double scores[5];
+    const fuzzy::token_sort_scorer by_sort("john smith");
+    assert(fuzzy::score_batch(by_sort, candidates, scores, 0.9) == 3);
+    assert(scores[2] == 1.0 && scores[3] == 0.0);
+    assert(near(scores[0], 2.0 * 9 / 19));
+
+    const fuzzy::jaro_winkler_scorer by_jw("john smith");
+    assert(fuzzy::score_batch(by_jw, candidates, scores) == 5);
+    const auto [index, score] = fuzzy::best_match(by_jw, candidates, 0.8);
+    assert(index == 0 && near(score, reference_jaro_winkler("john smith", "jon smith")));
+    assert(fuzzy::best_match(by_jw, candidates, 0.999).first == str::npos);
+}
+
+// ==================== Near-Duplicate Tests ====================
+
+TEST(near_duplicates) {
+    const types::msg_str a = "disk /dev/sda1 on host web-17 is 91% full, 3.2 GB left; rotating logs now";
+    const types::msg_str b = "disk /dev/sda1 on host web-17 is 92% full, 3.1 GB left; rotating logs now";
+    const fstring<1024> c = "user alice signed in from 10.0.0.4 using a hardware key after two failed attempts";
+
+    ZUU_EXPECT_NO_ALLOC {
+        // Rolling the window equals hashing it afresh
+        const rolling::rabin_karp rk(7);
+        std::size_t windows = 0;
+        rk.for_each(a.data(), a.size(), [&](std::size_t pos, std::uint64_t h) {
+            assert(h == rk.hash(a.data() + pos, 7));
+            ++windows;
+        });
+        assert(windows == a.size() - 6);
+        assert(rk.hash("ab", 2) != rk.hash("ba", 2));
+        assert(rolling::rabin_karp(3).hash(u"xyz", 3) == rolling::rabin_karp(3).hash(U"xyz", 3));
+
+        const dedup::minhasher<128> minhash;
+        const auto sig_a = minhash(a);
+        assert(sig_a == minhash(std::string_view(a.data(), a.size())));
+        assert(dedup::estimate_jaccard(sig_a, sig_a) == 1.0);
+        assert(dedup::estimate_jaccard(sig_a, minhash(b)) > 0.5);
+        assert(dedup::estimate_jaccard(sig_a, minhash(c)) < 0.1);
+
+        const dedup::simhasher simhash;
+        assert(dedup::hamming_distance(simhash(a), simhash(b)) < dedup::hamming_distance(simhash(a), simhash(c)));
+        assert(simhash(""_sfs) == 0);
+    };
+
+    // The estimate tracks the exact Jaccard similarity of the shingle sets
+    const dedup::shingler shingles;
+    auto exact = [&](const auto& x, const auto& y) {
+        std::set<std::uint64_t> sx, sy;
+        shingles(x, [&](std::uint64_t h) { sx.insert(h); });
+        shingles(y, [&](std::uint64_t h) { sy.insert(h); });
+        std::size_t shared = 0;
+        for (const auto h : sx) shared += sy.count(h);
+        return static_cast<double>(shared) / static_cast<double>(sx.size() + sy.size() - shared);
+    };
+    const dedup::minhasher<256> fine;
+    assert(std::abs(dedup::estimate_jaccard(fine(a), fine(b)) - exact(a, b)) < 0.1);
+
+    // LSH finds the near-duplicate, not the unrelated message
+    dedup::minhash_lsh<128> lsh(32);
+    const dedup::minhasher<128> minhash;
+    assert(lsh.bands() == 32 && lsh.rows() == 4);
+    assert(lsh.insert(minhash(a)) == 0 && lsh.insert(minhash(c)) == 1);
+    assert(lsh.query(minhash(b), 0.5) == std::vector<std::uint32_t>{0});
+    assert(lsh.query(minhash(a), 1.0) == std::vector<std::uint32_t>{0});
+
+    // The SimHash index returns exactly the fingerprints within range
+    std::uint64_t state = 9;
+    auto next = [&state] { return state = state * 6364136223846793005ull + 1442695040888963407ull; };
+    dedup::simhash_index index(3);
+    std::vector<std::uint64_t> fingerprints;
+    for (int i = 0; i < 500; ++i) {
+        std::uint64_t fp = i % 2 == 0 || fingerprints.empty() ? next() : fingerprints.back();
+        for (std::uint64_t flips = next() % 6; flips > 0; --flips) fp ^= std::uint64_t{1} << (next() % 64);
+        fingerprints.push_back(fp);
+        index.insert(fp);
+    }
+    std::vector<std::uint32_t> found;
+    for (const auto fp : fingerprints) {
+        index.query(fp, found);
+        std::vector<std::uint32_t> expected;
+        for (std::uint32_t id = 0; id < fingerprints.size(); ++id) {
+            if (dedup::hamming_distance(fp, fingerprints[id]) <= 3) expected.push_back(id);
+        }
+        assert(found == expected);
+    }
+}
+
+TEST(rolling_search) {
+    const std::string_view text = "GET /a7f3 200; GET /b2c9 404; POST /a7f3 201; GET /zzzz 500; /a7f3/b2c9";
+    rolling::multi_search needles(4);
+    assert(needles.add("a7f3"_sfs) == 0 && needles.add(std::string_view("b2c9")) == 1);
+    assert(needles.add(std::string_view("zzzz")) == 2 && needles.add(std::string_view("a7f3")) == 0);
+    assert(needles.add(std::string_view("abc")) == str::npos && needles.size() == 3);
+    assert(needles.needle(1) == "b2c9");
+
+    // Every occurrence, in order, as a per-needle scan finds them
+    std::vector<std::pair<std::size_t, std::size_t>> found, expected;
+    needles.for_each_match(text, [&](std::size_t pos, std::size_t id) { found.push_back({pos, id}); });
+    for (std::size_t pos = 0; pos + 4 <= text.size(); ++pos) {
+        for (std::size_t id = 0; id < needles.size(); ++id) {
+            if (text.substr(pos, 4) == needles.needle(id)) expected.push_back({pos, id});
+        }
+    }
+    assert(found == expected && found.size() == 6);
+    assert(needles.count(text) == 6);
+    assert(needles.find(text) == std::make_pair(std::size_t{5}, std::size_t{0}));
+    assert(needles.find(text, 6) == std::make_pair(std::size_t{20}, std::size_t{1}));
+    assert(needles.find(std::string_view("no match here")).first == str::npos);
+    assert(needles.find(text, text.size() + 1).first == str::npos);
+
+    const rolling::rabin_karp64 rk(5);
+    rk.for_each(text.data(), text.size(), [&](std::size_t pos, std::uint64_t h) {
+        assert(h == rk.hash(text.data() + pos, 5));
+    });
+
+    rolling::u16multi_search wide(2);
+    wide.add(std::u16string_view(u"\u00e9t"));
+    assert(wide.count(std::u16string_view(u"\u00e9t\u00e9 \u00e9t")) == 2);
+
+    // Chunks tile the buffer within the size limits, and an insertion
+    // near the front leaves most chunks unchanged
+    std::string data;
+    std::uint64_t state = 17;
+    while (data.size() < 400000) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        data.push_back(static_cast<char>(state >> 56));
+    }
+    const rolling::fastcdc chunker({.min_size = 1024, .avg_size = 4096, .max_size = 16384});
+    const auto cuts = chunker.boundaries(data);
+    assert(!cuts.empty() && cuts.back() == data.size());
+    for (std::size_t i = 0, start = 0; i < cuts.size(); start = cuts[i++]) {
+        assert(cuts[i] - start <= 16384);
+        assert(cuts[i] - start >= 1024 || i + 1 == cuts.size());
+    }
+    assert(cuts.size() > 40 && cuts.size() < 200);
+
+    auto chunk_set = [&chunker](const std::string& buffer) {
+        std::set<std::string_view> chunks;
+        chunker.for_each_chunk(buffer, [&](std::size_t offset, std::size_t size) {
+            chunks.insert(std::string_view(buffer).substr(offset, size));
+        });
+        return chunks;
+    };
+    std::string edited = data;
+    edited.insert(5000, "inserted bytes");
+    const auto before = chunk_set(data);
+    const auto after = chunk_set(edited);
+    std::size_t shared = 0;
+    for (const auto& chunk : after) shared += before.count(chunk);
+    assert(shared + 3 >= before.size());
+    assert(chunker.boundaries(std::string_view()).empty());
+}
+
+TEST(suffix_index) {
+    // SA-IS and Kasai against sorting and direct comparison, on small
+    // alphabets where equal LMS substrings force recursion
+    std::uint64_t state = 5;
+    auto next = [&state] {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return static_cast<std::size_t>(state >> 33);
+    };
+    for (int round = 0; round < 200; ++round) {
+        std::string text;
+        const std::size_t length = next() % 300;
+        const std::size_t alphabet = 1 + next() % 4;
+        for (std::size_t i = 0; i < length; ++i) text.push_back(static_cast<char>(next() % alphabet == 0 ? '\xff' : 'a' + next() % alphabet));
+        const std::string_view view = text;
+
+        const auto sa = suffix::suffix_array(view);
+        std::vector<std::int32_t> expected(text.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) expected[i] = static_cast<std::int32_t>(i);
+        std::sort(expected.begin(), expected.end(), [view](std::int32_t a, std::int32_t b) { return view.substr(a) < view.substr(b); });
+        assert(sa == expected);
+
+        const auto lcp = suffix::lcp_array(view, sa);
+        for (std::size_t i = 1; i < sa.size(); ++i) {
+            const auto a = view.substr(sa[i - 1]), b = view.substr(sa[i]);
+            const auto mismatch = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+            assert(lcp[i] == mismatch.first - a.begin());
+        }
+    }
+
+    const std::vector<std::string_view> lines = {
+        "GET /index.html 200", "POST /login 302", "GET /login 200", "", "GET /index.html 404", "banana bandana",
+    };
+    auto naive = [&lines](std::string_view pattern) {
+        std::vector<suffix::hit> hits;
+        for (std::size_t r = 0; r < lines.size(); ++r) {
+            for (std::size_t pos = lines[r].find(pattern); pos != std::string_view::npos; pos = lines[r].find(pattern, pos + 1)) {
+                hits.push_back({static_cast<std::uint32_t>(r), static_cast<std::uint32_t>(pos)});
+            }
+        }
+        return hits;
+    };
+    const std::string_view patterns[] = {"GET", "login", "an", "ana", "html 40", "/", "zzz", "200", "banana bandana", "a"};
+
+    for (const std::size_t shards : {1, 3, 10}) {
+        suffix::suffix_index index;
+        for (const auto line : lines) index.add(line);
+        assert(!index.built());
+        index.build({.shards = shards, .threads = 2});
+        assert(index.built() && index.size() == lines.size() && index.record(4) == "GET /index.html 404");
+        assert(index.shard_count() == std::min<std::size_t>(shards, lines.size()));
+        for (const auto pattern : patterns) {
+            assert(index.find_all(pattern) == naive(pattern));
+            assert(index.count(pattern) == naive(pattern).size());
+        }
+        assert(index.count("") == 0 && index.count(std::string_view("200\0POST", 8)) == 0);
+    }
+
+    suffix::suffix_index index;
+    index.add("abracadabra"_sfs);
+    index.add(std::string_view("cadabra"));
+    index.build();
+    const auto shard = index.shard(0);
+    assert(shard.text.size() == 20 && shard.sa.size() == 20 && shard.lcp.size() == 20);
+    assert(*std::max_element(shard.lcp.begin(), shard.lcp.end()) == 8);  // "cadabra\0"
+
+    // A saved index loads by mapping and answers the same queries
+    const std::string path = "/tmp/zuu_suffix_index_test.sa";
+    assert(index.save(path.c_str()));
+    suffix::suffix_index loaded;
+    assert(loaded.load(path.c_str()) && loaded.is_loaded());
+    assert(loaded.size() == 2 && loaded.record(1) == "cadabra");
+    const std::vector<suffix::hit> abra = {{0, 0}, {0, 7}, {1, 3}};
+    assert(loaded.find_all("abra") == abra && loaded.count("a") == 8);
+
+    loaded.add(std::string_view("abra"));
+    assert(!loaded.is_loaded() && !loaded.built() && loaded.record(0) == "abracadabra");
+    loaded.build();
+    assert(loaded.count("abra") == 4);
+    assert(!loaded.load("/tmp/zuu_suffix_index_missing.sa") && loaded.count("abra") == 4);
+
+    // A suffix array entry pointing past the text is rejected, not searched
+    {
+        std::FILE* file = std::fopen(path.c_str(), "r+b");
+        suffix::detail::file_shard table;
+        std::fseek(file, sizeof(suffix::detail::file_header), SEEK_SET);
+        const std::size_t read = std::fread(&table, sizeof table, 1, file);
+        assert(read == 1);
+        const std::int32_t past_end = 1 << 20;
+        std::fseek(file, static_cast<long>(table.sa_at + 4), SEEK_SET);
+        std::fwrite(&past_end, sizeof past_end, 1, file);
+        std::fclose(file);
+    }
+    assert(!loaded.load(path.c_str()) && loaded.count("abra") == 4);
+
+    {
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        std::fputs("ZUUSAIX1 not an index", file);
+        std::fclose(file);
+    }
+    assert(!loaded.load(path.c_str()) && loaded.size() == 3);
+    std::remove(path.c_str());
+}
+
 // ==================== Formatting Tests ====================
 
-TEST(integer_formatting) {
+NOALLOC_TEST(integer_formatting) {
     assert(to_fstring(42) == "42");
     assert(to_fstring(-123) == "-123");
     assert(to_fstring(0) == "0");
 }
 
-TEST(hex_formatting) {
+NOALLOC_TEST(hex_formatting) {
     assert(to_fstring(hex(255)) == "0xff");
     assert(to_fstring(hex(255, true)) == "0xFF");
     assert(to_fstring(hex(0)) == "0x0");
 }
 
-TEST(binary_formatting) {
+NOALLOC_TEST(binary_formatting) {
     assert(to_fstring(bin(5)) == "0b101");
     assert(to_fstring(bin(0)) == "0b0");
     assert(to_fstring(bin(255)) == "0b11111111");
 }
 
-TEST(padding_formatting) {
+NOALLOC_TEST(padding_formatting) {
     assert(to_fstring(pad_left(7, 3, '0')) == "007");
     assert(to_fstring(pad_left(42, 5, ' ')) == "   42");
 }
 
-TEST(float_formatting) {
+NOALLOC_TEST(float_formatting) {
     auto f1 = to_fstring(3.14, 2);
     assert(f1 == "3.14");
     
@@ -281,20 +1602,20 @@ TEST(float_formatting) {
     assert(f2 == "2.718");
 }
 
-TEST(bool_formatting) {
+NOALLOC_TEST(bool_formatting) {
     assert(to_fstring(true) == "true");
     assert(to_fstring(false) == "false");
 }
 
 // ==================== Parsing Tests ====================
 
-TEST(parse_int) {
+NOALLOC_TEST(parse_int) {
     assert(parse_int<int>("42"_sfs) == 42);
     assert(parse_int<int>("-123"_sfs) == -123);
     assert(parse_int<int>("0"_sfs) == 0);
 }
 
-TEST(parse_float) {
+NOALLOC_TEST(parse_float) {
     float f1 = parse_float<float>("3.14"_sfs);
     assert(f1 > 3.13 && f1 < 3.15);
     
@@ -304,7 +1625,7 @@ TEST(parse_float) {
 
 // ==================== Complex Pipeline Tests ====================
 
-TEST(complex_pipeline_1) {
+NOALLOC_TEST(complex_pipeline_1) {
     auto result = "  HELLO, WORLD!  "_fs 
         | trim 
         | to_lower 
@@ -318,9 +1639,9 @@ TEST(complex_pipeline_1) {
     assert(result == "[hello, world!]");
 }
 
-TEST(complex_pipeline_2) {
+NOALLOC_TEST(complex_pipeline_2) {
     auto parts = "a,b,c"_sfs | split(',');
-    assert(parts.count == 3);
+    assert(parts.size() == 3);
     
     // Transform each part
     for (auto& part : parts) {
@@ -331,12 +1652,12 @@ TEST(complex_pipeline_2) {
     assert(rejoined == "A-B-C");
 }
 
-TEST(complex_pipeline_3) {
+NOALLOC_TEST(complex_pipeline_3) {
     // CSV-like processing
     auto line = "  John , 30 , Developer  "_fs;
     auto fields = line | trim | split(',');
     
-    assert(fields.count == 3);
+    assert(fields.size() == 3);
     
     for (auto& field : fields) {
         field = field | trim;
@@ -354,7 +1675,7 @@ constexpr auto compile_time_test() {
     return s.size() == 4;
 }
 
-TEST(constexpr_operations) {
+NOALLOC_TEST(constexpr_operations) {
     static_assert(compile_time_test());
     
     constexpr fstring<16> ct = "compile";
@@ -364,7 +1685,7 @@ TEST(constexpr_operations) {
 
 // ==================== Type Aliases Tests ====================
 
-TEST(type_aliases) {
+NOALLOC_TEST(type_aliases) {
     using namespace types;
     
     name_str name = "Alice";
@@ -380,9 +1701,65 @@ TEST(type_aliases) {
     assert(ip.max_size() == 45);
 }
 
+// Every kernel against its scalar meaning, at lengths around the block sizes
+template <typename CharT>
+void check_kernels_for() {
+    using string = basic_fstring<CharT, 80>;
+    using view = std::basic_string_view<CharT>;
+    
+    for (std::size_t len = 0; len < 70; ++len) {
+        string s;
+        for (std::size_t i = 0; i < len; ++i) s.push_back(CharT('a' + i % 7));
+        s.push_back(CharT('Z'));
+        s.push_back(CharT(0x7F));
+        
+        const view sv = s;
+        const CharT set[] = {CharT('Z'), CharT(0x7F), CharT('g')};
+        const view set_view{set, 3};
+        
+        assert(s.find(CharT('g')) == sv.find(CharT('g')));
+        assert(str::rfind(s, CharT('b')) == sv.rfind(CharT('b')));
+        assert(str::find_first_of(s, set_view) == sv.find_first_of(set_view));
+        assert(str::find_first_not_of(s, set_view) == sv.find_first_not_of(set_view));
+        
+        auto upper = s | to_upper;
+        auto lower = upper | to_lower;
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            assert(upper[i] == str::char_to_upper(s[i]));
+            assert(lower[i] == str::char_to_lower(s[i]));
+        }
+        
+        string other = s;
+        assert(other == s && std::hash<string>{}(other) == std::hash<string>{}(s));
+        if (!other.empty()) {
+            other[other.size() / 2] = CharT(0xC0);  // high code unit sorts last
+            assert(other != s);
+            assert((other <=> s) == (view{other} <=> sv));
+        }
+        
+        assert(simd::strnlen(s.c_str()) == s.size());
+    }
+    
+    // Code units with the top bit set are left alone by case mapping
+    string high;
+    high.push_back(static_cast<CharT>(~CharT{} ^ CharT(0x20)));
+    assert((high | to_lower) == high);
+}
+
+NOALLOC_TEST(wide_char_kernels) {
+    check_kernels_for<char>();
+    check_kernels_for<wchar_t>();
+    check_kernels_for<char16_t>();
+    check_kernels_for<char32_t>();
+    
+    // Same hash at compile time and run time
+    constexpr auto compile_time = simd::hash(u"utf-16 text", 11);
+    assert(compile_time == simd::hash(u16fstring<16>(u"utf-16 text").data(), 11));
+}
+
 // ==================== Edge Cases ====================
 
-TEST(empty_string_operations) {
+NOALLOC_TEST(empty_string_operations) {
     fstring<32> empty;
     
     assert(empty.empty());
@@ -395,7 +1772,7 @@ TEST(empty_string_operations) {
     assert(upper.empty());
 }
 
-TEST(full_capacity) {
+NOALLOC_TEST(full_capacity) {
     fstring<5> s = "12345";
     assert(s.full());
     
@@ -404,12 +1781,12 @@ TEST(full_capacity) {
     assert(s == "12345");
 }
 
-TEST(special_characters) {
+NOALLOC_TEST(special_characters) {
     fstring<32> s = "hello\nworld\t!";
     assert(s.size() == 13);
     
     auto lines = s | split_lines;
-    assert(lines.count == 2);
+    assert(lines.size() == 2);
 }
 
 // ==================== Main ====================
@@ -422,6 +1799,9 @@ int main() {
     // Run all tests
     run_test_basic_construction();
     run_test_concatenation();
+    run_test_result_capacity_policy();
+    run_test_storage_layout();
+    run_test_cstring_ingestion();
     run_test_element_access();
     
     run_test_trim_operations();
@@ -430,6 +1810,14 @@ int main() {
     run_test_case_conversion();
     run_test_case_piping();
     run_test_case_insensitive_compare();
+    run_test_reverse_and_rotate();
+    run_test_text_statistics();
+    run_test_stream_pipeline();
+    run_test_stream_parallel_pipeline();
+    run_test_stream_parallel_split();
+    run_test_stream_mapped_file();
+    run_test_pipe_profiler();
+    run_test_allocation_audit();
     
     run_test_split_char();
     run_test_split_string();
@@ -438,10 +1826,14 @@ int main() {
     run_test_split_piping();
     run_test_partition();
     run_test_rsplit();
+    run_test_split_result_storage();
+    run_test_inline_vector_exception_safety();
+    run_test_split_with_limit();
     
     run_test_join_char();
     run_test_join_string();
     run_test_join_split_roundtrip();
+    run_test_join_into_range();
     
     run_test_contains_operations();
     run_test_starts_ends_with();
@@ -449,6 +1841,18 @@ int main() {
     run_test_count_operations();
     run_test_find_first_of();
     run_test_contains_any();
+    run_test_substring_search();
+    run_test_glob_matching();
+    run_test_natural_order();
+    run_test_unicode_normalization();
+    run_test_generic_string_inputs();
+    
+    run_test_fuzzy_distance();
+    run_test_fuzzy_index();
+    run_test_fuzzy_similarity();
+    run_test_near_duplicates();
+    run_test_rolling_search();
+    run_test_suffix_index();
     
     run_test_integer_formatting();
     run_test_hex_formatting();
@@ -467,6 +1871,7 @@ int main() {
     run_test_constexpr_operations();
     
     run_test_type_aliases();
+    run_test_wide_char_kernels();
     
     run_test_empty_string_operations();
     run_test_full_capacity();
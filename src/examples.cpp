@@ -170,13 +170,13 @@ void example_split_join() {
     fstring<50> text = "apple,banana,cherry,date";
     
     auto parts = split(text, ',');
-    std::cout << "Split result (" << parts.count << " parts):\n";
-    for (std::size_t i = 0; i < parts.count; ++i) {
-        std::cout << "  " << i << ": " << parts.parts[i] << "\n";
+    std::cout << "Split result (" << parts.size() << " parts):\n";
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        std::cout << "  " << i << ": " << parts[i] << "\n";
     }
     
     // Join back
-    auto joined = join(parts.parts, ',');
+    auto joined = join(parts, ',');
     std::cout << "Joined: " << joined << "\n";
 }
 
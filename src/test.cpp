@@ -225,12 +225,12 @@ TEST(replace_ops) {
 TEST(split_join) {
     fstring<30> str = "a,b,c";
     auto parts = split(str, ',');
-    assert(parts.count == 3);
-    assert(parts.parts[0] == "a");
-    assert(parts.parts[1] == "b");
-    assert(parts.parts[2] == "c");
+    assert(parts.size() == 3);
+    assert(parts[0] == "a");
+    assert(parts[1] == "b");
+    assert(parts[2] == "c");
     
-    auto joined = join(parts.parts, ',');
+    auto joined = join(parts, ',');
     // Note: join uses full array, need to only join used parts
 }
 
@@ -0,0 +1,109 @@
+#!/bin/sh
+# Compare fstring_grep against GNU grep on generated corpora: same output,
+# and wall time of each.
+#
+# Usage: tools/compare_grep.sh [path/to/fstring_grep] [megabytes]
+#
+# Build the tool first, e.g.
+#   cmake -S . -B build -DFSTRING_BUILD_TOOLS=ON && cmake --build build --target fstring_grep
+#
+# Globs have no grep equivalent, so each glob case names the regular
+# expression (grep -e) that selects the same lines.
+
+set -u
+
+tool=${1:-build/fstring_grep}
+megabytes=${2:-64}
+work=$(mktemp -d "${TMPDIR:-/tmp}/compare_grep.XXXXXX")
+trap 'rm -rf "$work"' EXIT INT TERM
+
+if [ ! -x "$tool" ]; then
+    echo "compare_grep: $tool is not executable" >&2
+    exit 2
+fi
+
+# ==================== Corpora ====================
+
+# Deterministic access log: the same seed gives the same file everywhere
+awk -v bytes=$((megabytes * 1048576)) 'BEGIN {
+    srand(42)
+    split("GET POST PUT DELETE", methods, " ")
+    split("users orders items search health", paths, " ")
+    split("200 200 200 200 201 204 301 404 500 503", codes, " ")
+    split("INFO INFO INFO INFO WARN ERROR", levels, " ")
+    while (total < bytes) {
+        line = sprintf("2025-11-%02d %s %s /api/%s/%d %s %dms", 1 + int(rand() * 28),
+                       levels[1 + int(rand() * 6)], methods[1 + int(rand() * 4)],
+                       paths[1 + int(rand() * 5)], int(rand() * 100000),
+                       codes[1 + int(rand() * 10)], int(rand() * 900))
+        if (rand() < 0.001) line = line " Timeout contacting upstream"
+        print line
+        total += length(line) + 1
+    }
+}' > "$work/access.log"
+
+# Prose-like text: words from a small vocabulary, mixed case
+awk -v bytes=$((megabytes * 1048576)) 'BEGIN {
+    srand(7)
+    n = split("the quick brown fox jumps over lazy dog Lorem ipsum dolor sit amet " \
+              "consectetur adipiscing elit Sed do eiusmod tempor incididunt labore", words, " ")
+    while (total < bytes) {
+        len = 4 + int(rand() * 12)
+        line = words[1 + int(rand() * n)]
+        for (i = 1; i < len; i++) line = line " " words[1 + int(rand() * n)]
+        if (rand() < 0.0005) line = line " NeedleInAHaystack"
+        print line
+        total += length(line) + 1
+    }
+}' > "$work/prose.txt"
+
+# ==================== Cases ====================
+
+now() { date +%s.%N; }
+
+failures=0
+printf '%-44s %10s %11s %8s\n' "case" "grep (s)" "fstring (s)" "speedup"
+
+# compare NAME FILE "GREP ARGS" "FSTRING_GREP ARGS"
+compare() {
+    name=$1 file=$2 grep_args=$3 tool_args=$4
+
+    t0=$(now)
+    eval "LC_ALL=C grep $grep_args \"\$file\"" > "$work/expected"
+    t1=$(now)
+    eval "\"\$tool\" $tool_args \"\$file\"" > "$work/actual"
+    t2=$(now)
+
+    if cmp -s "$work/expected" "$work/actual"; then
+        status=""
+    else
+        status="  MISMATCH"
+        failures=$((failures + 1))
+    fi
+
+    awk -v name="$name" -v a="$t0" -v b="$t1" -v c="$t2" -v status="$status" 'BEGIN {
+        g = b - a; f = c - b
+        printf "%-44s %10.3f %11.3f %7.2fx%s\n", name, g, f, (f > 0 ? g / f : 0), status
+    }'
+}
+
+log=$work/access.log
+prose=$work/prose.txt
+
+compare "literal, rare"               "$log"   "-F Timeout"                "-F Timeout"
+compare "literal, common"             "$log"   "-F ERROR"                  "-F ERROR"
+compare "literal -i, rare"            "$log"   "-Fi timeout"               "-Fi timeout"
+compare "literal -c"                  "$log"   "-Fc /api/orders/"          "-Fc /api/orders/"
+compare "multi-literal (3)"           "$log"   "-F -e ' 503 ' -e Timeout -e DELETE" \
+                                               "-F -e ' 503 ' -e Timeout -e DELETE"
+compare "multi-literal -i -c"         "$prose" "-Fic -e needleinahaystack -e 'LAZY DOG'" \
+                                               "-Fic -e needleinahaystack -e 'LAZY DOG'"
+compare "glob with literal"           "$log"   "-e 'ERROR.*/api/orders/'"  "'ERROR*/api/orders/'"
+compare "glob with class"             "$log"   "-e ' 50[0-9] '"            "' 50[0-9] '"
+compare "glob -i -c"                  "$prose" "-ic -e 'fox.*dog'"         "-ic 'fox*dog'"
+compare "glob without literal"        "$log"   "-c -e 'WARN'"              "-c '[W][A][R][N]'"
+
+if [ "$failures" -ne 0 ]; then
+    echo "$failures case(s) differ from grep" >&2
+    exit 1
+fi
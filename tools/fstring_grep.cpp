@@ -0,0 +1,243 @@
+/**
+ * @file tools/fstring_grep.cpp
+ * @brief grep-like line search built on the library, as an end-to-end workload
+ *
+ * Usage: fstring_grep [-F] [-i] [-c] [-e PATTERN]... [PATTERN] [FILE]...
+ *
+ *   -F  patterns are literal strings (default: shell globs, matched
+ *       anywhere in the line: `*`, `?`, `[a-z]`, `\x`)
+ *   -i  ASCII case-insensitive
+ *   -c  print the number of matching lines instead of the lines
+ *   -e  add a pattern (repeatable); a pattern containing newlines is
+ *       one pattern per line, as in grep
+ *
+ * With no FILE, or FILE "-", standard input is read. Exit status: 0 if a
+ * line was selected, 1 if none was, 2 on error.
+ *
+ * Files are memory-mapped (stream::mapped_file) and searched as a whole:
+ * the literal searcher jumps to the next hit, which is widened to its line,
+ * and the search resumes after that line, so lines without a hit are never
+ * visited one by one. Globs with a literal run use it the same way as a
+ * prefilter; other globs test every line. Output goes through one buffered
+ * stream::line_writer.
+ */
+
+#include <zuu/stream.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unistd.h>
+#include <vector>
+
+using namespace zuu;
+
+namespace {
+
+struct options {
+    bool fixed = false;
+    bool ignore_case = false;
+    bool count = false;
+    std::vector<std::string> patterns;
+    std::vector<const char*> files;
+};
+
+// ==================== Matcher ====================
+
+class matcher {
+public:
+    explicit matcher(const options& opts) : ignore_case_{opts.ignore_case}, fixed_{opts.fixed} {
+        for (const auto& pattern : opts.patterns) {
+            if (fixed_) {
+                literals_.push_back(pattern);
+            } else {
+                globs_.push_back("*" + pattern + "*");
+                literals_.emplace_back(str::glob_required_literal(std::string_view(pattern)));
+            }
+        }
+
+        // An empty literal matches every line; so does a glob without one,
+        // but that line still has to pass the glob
+        scan_all_ = std::any_of(literals_.begin(), literals_.end(), [](const auto& s) { return s.empty(); });
+        if (!scan_all_) {
+            for (const auto& literal : literals_) searchers_.emplace_back(literal, ignore_case_);
+        }
+    }
+
+    // Call emit(line) for every selected line of text, in order
+    template <typename Emit>
+    void for_each_match(std::string_view text, Emit&& emit) const {
+        const char* first = text.data();
+        const char* last = first + text.size();
+
+        if (scan_all_) {
+            const char* start = first;
+            auto on_line = [&](const char* eol) {
+                test_line(std::string_view(start, static_cast<std::size_t>(eol - start)), emit);
+                start = eol + 1;
+            };
+            simd::for_each_delimiter(first, last, '\n', on_line);
+            if (start != last) test_line(std::string_view(start, static_cast<std::size_t>(last - start)), emit);
+            return;
+        }
+
+        // Next hit of each literal at or after `first` (stale ones are refreshed)
+        std::vector<const char*> next(searchers_.size(), nullptr);
+
+        while (first != last) {
+            const char* hit = last;
+            for (std::size_t k = 0; k < searchers_.size(); ++k) {
+                if (next[k] == nullptr || next[k] < first) next[k] = searchers_[k](first, last);
+                hit = std::min(hit, next[k]);
+            }
+            if (hit == last) break;
+
+            const char* start = hit;
+            while (start != first && start[-1] != '\n') --start;
+            const char* eol = simd::find_char(hit, last, '\n');
+
+            const std::string_view line(start, static_cast<std::size_t>(eol - start));
+            if (fixed_) {
+                emit(line);
+            } else {
+                test_line(line, emit);
+            }
+
+            if (eol == last) break;
+            first = eol + 1;
+        }
+    }
+
+private:
+    bool ignore_case_;
+    bool fixed_;
+    bool scan_all_ = false;
+    std::vector<std::string> globs_;
+    std::vector<std::string> literals_;
+    std::vector<simd::literal_searcher<char>> searchers_;
+
+    template <typename Emit>
+    void test_line(std::string_view line, Emit& emit) const {
+        if (fixed_) {
+            emit(line);  // only reached with an empty literal
+            return;
+        }
+        for (const auto& glob : globs_) {
+            const bool hit = ignore_case_ ? str::matches_glob_icase(line, std::string_view(glob))
+                                          : str::matches_glob(line, std::string_view(glob));
+            if (hit) {
+                emit(line);
+                return;
+            }
+        }
+    }
+};
+
+// ==================== Command Line ====================
+
+void add_patterns(options& opts, std::string_view text) {
+    for (;;) {
+        const auto nl = text.find('\n');
+        opts.patterns.emplace_back(text.substr(0, nl));
+        if (nl == std::string_view::npos) break;
+        text.remove_prefix(nl + 1);
+    }
+}
+
+bool parse(int argc, char** argv, options& opts) {
+    bool have_e = false;
+    int i = 1;
+
+    for (; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--") {
+            ++i;
+            break;
+        }
+        if (arg.size() < 2 || arg[0] != '-') break;
+
+        for (std::size_t j = 1; j < arg.size(); ++j) {
+            switch (arg[j]) {
+                case 'F': opts.fixed = true; break;
+                case 'i': opts.ignore_case = true; break;
+                case 'c': opts.count = true; break;
+                case 'e':
+                    // -ePATTERN or -e PATTERN
+                    if (j + 1 < arg.size()) {
+                        add_patterns(opts, arg.substr(j + 1));
+                    } else if (i + 1 < argc) {
+                        add_patterns(opts, argv[++i]);
+                    } else {
+                        return false;
+                    }
+                    have_e = true;
+                    j = arg.size();
+                    break;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    if (!have_e) {
+        if (i == argc) return false;
+        add_patterns(opts, argv[i++]);
+    }
+    for (; i < argc; ++i) opts.files.push_back(argv[i]);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    options opts;
+    if (!parse(argc, argv, opts)) {
+        std::fputs("usage: fstring_grep [-F] [-i] [-c] [-e PATTERN]... [PATTERN] [FILE]...\n", stderr);
+        return 2;
+    }
+    if (opts.files.empty()) opts.files.push_back("-");
+
+    const matcher match(opts);
+    const bool prefix = opts.files.size() > 1;
+    stream::line_writer out(STDOUT_FILENO);
+    bool selected = false;
+    bool failed = false;
+
+    for (const char* path : opts.files) {
+        const bool is_stdin = std::strcmp(path, "-") == 0;
+        const stream::mapped_file file = is_stdin ? stream::mapped_file(STDIN_FILENO) : stream::mapped_file(path);
+        if (!file) {
+            std::fprintf(stderr, "fstring_grep: %s: %s\n", path, std::strerror(errno));
+            failed = true;
+            continue;
+        }
+
+        const std::string_view name = is_stdin ? "(standard input)" : path;
+        std::size_t lines = 0;
+
+        match.for_each_match(file.view(), [&](std::string_view line) {
+            ++lines;
+            if (opts.count) return;
+            if (prefix) {
+                out.write(name);
+                out.write(":");
+            }
+            out.write_line(line);
+        });
+
+        if (opts.count) {
+            if (prefix) {
+                out.write(name);
+                out.write(":");
+            }
+            out.write_line(fmt::to_fstring(lines));
+        }
+        selected = selected || lines != 0;
+    }
+
+    out.flush();
+    if (!out.ok()) failed = true;
+    return failed ? 2 : (selected ? 0 : 1);
+}
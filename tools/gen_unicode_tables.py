@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Generate include/zuu/unicode/tables.hpp from Python's unicodedata.
+
+The tables hold what canonical normalization (NFC/NFD) needs, packed into
+sorted 64-bit words for binary search:
+
+  combining_classes   first << 32 | last << 8 | class, for class != 0
+  decompositions      code << 42 | first << 21 | second (0 for singletons)
+  compositions        first << 42 | second << 21 | composite, primary
+                      composites only (no exclusions or singletons)
+  nfc_unsafe          first << 32 | last: code points that may change, or
+  nfd_unsafe          change a neighbour, under that form (quick check)
+  *_safe_leads        256-bit sets of UTF-8 lead bytes whose every code
+                      point is safe, for the vectorized quick check
+
+Hangul syllables are composed and decomposed algorithmically and are not
+in the tables.
+
+Usage: python3 tools/gen_unicode_tables.py > include/zuu/unicode/tables.hpp
+"""
+
+import sys
+import unicodedata
+
+MAX = 0x110000
+SURROGATES = range(0xD800, 0xE000)
+HANGUL_V = range(0x1161, 0x1176)
+HANGUL_T = range(0x11A8, 0x11C3)
+HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+
+
+def canonical(cp):
+    mapping = unicodedata.decomposition(chr(cp))
+    if not mapping or mapping.startswith("<"):
+        return None
+    return [int(part, 16) for part in mapping.split()]
+
+
+def ranges(flags):
+    """Merge sorted code points into [first, last] runs."""
+    out = []
+    for cp in flags:
+        if out and out[-1][1] == cp - 1:
+            out[-1][1] = cp
+        else:
+            out.append([cp, cp])
+    return out
+
+
+def lead_set(safe):
+    """Lead bytes 0xC0-0xFF whose code points are all safe (invalid leads pass through)."""
+    bits = [0, 0, 0, 0]
+    spans = {}
+    for lead in range(0xC2, 0xE0):
+        spans[lead] = range((lead & 0x1F) << 6, ((lead & 0x1F) << 6) + 0x40)
+    for lead in range(0xE0, 0xF0):
+        spans[lead] = range((lead & 0x0F) << 12, ((lead & 0x0F) << 12) + 0x1000)
+    for lead in range(0xF0, 0xF5):
+        spans[lead] = range((lead & 0x07) << 18, min(((lead & 0x07) << 18) + 0x40000, MAX))
+    for lead in range(0xC0, 0x100):
+        span = spans.get(lead)
+        if span is None or all(safe[cp] for cp in span if cp not in SURROGATES):
+            bits[lead // 64] |= 1 << (lead % 64)
+    return bits
+
+
+def words(values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join("0x%016x," % v for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def main():
+    ccc = [unicodedata.combining(chr(cp)) for cp in range(MAX)]
+
+    decompositions = []
+    compositions = []
+    seconds = set(HANGUL_V) | set(HANGUL_T)
+    for cp in range(MAX):
+        parts = canonical(cp)
+        if parts is None:
+            continue
+        decompositions.append(cp << 42 | parts[0] << 21 | (parts[1] if len(parts) == 2 else 0))
+        if len(parts) == 2 and unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+            compositions.append(parts[0] << 42 | parts[1] << 21 | cp)
+            seconds.add(parts[1])
+    compositions.sort()
+
+    nfc_safe = [False] * MAX
+    nfd_safe = [False] * MAX
+    for cp in range(MAX):
+        if cp in SURROGATES:
+            continue
+        c = chr(cp)
+        nfc_safe[cp] = ccc[cp] == 0 and cp not in seconds and unicodedata.normalize("NFC", c) == c
+        nfd_safe[cp] = ccc[cp] == 0 and unicodedata.normalize("NFD", c) == c
+
+    classes = []
+    for first, last in ranges(cp for cp in range(MAX) if ccc[cp] != 0):
+        # split runs where the class changes
+        start = first
+        for cp in range(first, last + 1):
+            if cp == last or ccc[cp + 1] != ccc[start]:
+                classes.append(start << 32 | cp << 8 | ccc[start])
+                start = cp + 1
+
+    def unsafe(safe):
+        return [first << 32 | last for first, last in
+                ranges(cp for cp in range(MAX) if not safe[cp] and cp not in SURROGATES)]
+
+    nfc_ranges = unsafe(nfc_safe)
+    nfd_ranges = unsafe(nfd_safe)
+
+    out = sys.stdout
+    out.write("""#pragma once
+
+/**
+ * @file zuu/unicode/tables.hpp
+ * @brief Canonical normalization data (generated, do not edit)
+ * @version 3.0.0
+ *
+ * Generated by tools/gen_unicode_tables.py from the Unicode %(version)s
+ * character database. Entries are packed into sorted 64-bit words for
+ * binary search; see the script for the layouts. Hangul syllables are
+ * handled algorithmically and are not listed.
+ */
+
+#include <cstdint>
+
+namespace zuu::unicode::detail {
+
+inline constexpr const char* unicode_version = "%(version)s";
+
+// first << 32 | last << 8 | canonical combining class (non-zero classes only)
+inline constexpr std::uint64_t combining_classes[] = {
+%(classes)s
+};
+
+// code << 42 | first << 21 | second (0 for singleton decompositions)
+inline constexpr std::uint64_t decompositions[] = {
+%(decompositions)s
+};
+
+// first << 42 | second << 21 | composite (primary composites)
+inline constexpr std::uint64_t compositions[] = {
+%(compositions)s
+};
+
+// first << 32 | last: code points that are not NFC quick-check safe
+// (combining, decomposing, or composing with the code point before)
+inline constexpr std::uint64_t nfc_unsafe[] = {
+%(nfc)s
+};
+
+// first << 32 | last: code points that are combining or decompose
+inline constexpr std::uint64_t nfd_unsafe[] = {
+%(nfd)s
+};
+
+// UTF-8 lead bytes (bit b of word b / 64) whose code points are all safe
+inline constexpr std::uint64_t nfc_safe_leads[4] = {%(nfc_leads)s};
+inline constexpr std::uint64_t nfd_safe_leads[4] = {%(nfd_leads)s};
+
+} // namespace zuu::unicode::detail
+""" % {
+        "version": unicodedata.unidata_version,
+        "classes": words(classes, 4),
+        "decompositions": words(decompositions, 4),
+        "compositions": words(compositions, 4),
+        "nfc": words(nfc_ranges, 4),
+        "nfd": words(nfd_ranges, 4),
+        "nfc_leads": ", ".join("0x%016x" % w for w in lead_set(nfc_safe)),
+        "nfd_leads": ", ".join("0x%016x" % w for w in lead_set(nfd_safe)),
+    })
+
+
+if __name__ == "__main__":
+    main()